@@ -0,0 +1,59 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "Release".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "join::join_core" for configuration "Release"
+set_property(TARGET join::join_core APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(join::join_core PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libjoin_core.so.5.0.0"
+  IMPORTED_SONAME_RELEASE "libjoin_core.so.5"
+  )
+
+list(APPEND _cmake_import_check_targets join::join_core )
+list(APPEND _cmake_import_check_files_for_join::join_core "${_IMPORT_PREFIX}/lib/libjoin_core.so.5.0.0" )
+
+# Import target "join::join_crypto" for configuration "Release"
+set_property(TARGET join::join_crypto APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(join::join_crypto PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libjoin_crypto.so.5.0.0"
+  IMPORTED_SONAME_RELEASE "libjoin_crypto.so.5"
+  )
+
+list(APPEND _cmake_import_check_targets join::join_crypto )
+list(APPEND _cmake_import_check_files_for_join::join_crypto "${_IMPORT_PREFIX}/lib/libjoin_crypto.so.5.0.0" )
+
+# Import target "join::join_data" for configuration "Release"
+set_property(TARGET join::join_data APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(join::join_data PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libjoin_data.so.5.0.0"
+  IMPORTED_SONAME_RELEASE "libjoin_data.so.5"
+  )
+
+list(APPEND _cmake_import_check_targets join::join_data )
+list(APPEND _cmake_import_check_files_for_join::join_data "${_IMPORT_PREFIX}/lib/libjoin_data.so.5.0.0" )
+
+# Import target "join::join_fabric" for configuration "Release"
+set_property(TARGET join::join_fabric APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(join::join_fabric PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libjoin_fabric.so.5.0.0"
+  IMPORTED_SONAME_RELEASE "libjoin_fabric.so.5"
+  )
+
+list(APPEND _cmake_import_check_targets join::join_fabric )
+list(APPEND _cmake_import_check_files_for_join::join_fabric "${_IMPORT_PREFIX}/lib/libjoin_fabric.so.5.0.0" )
+
+# Import target "join::join_services" for configuration "Release"
+set_property(TARGET join::join_services APPEND PROPERTY IMPORTED_CONFIGURATIONS RELEASE)
+set_target_properties(join::join_services PROPERTIES
+  IMPORTED_LOCATION_RELEASE "${_IMPORT_PREFIX}/lib/libjoin_services.so.5.0.0"
+  IMPORTED_SONAME_RELEASE "libjoin_services.so.5"
+  )
+
+list(APPEND _cmake_import_check_targets join::join_services )
+list(APPEND _cmake_import_check_files_for_join::join_services "${_IMPORT_PREFIX}/lib/libjoin_services.so.5.0.0" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
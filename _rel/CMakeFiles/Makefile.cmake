@@ -0,0 +1,248 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/GTest/GTestConfig.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestConfigVersion.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets-release.cmake"
+  "/root/miniconda/lib/cmake/GTest/GTestTargets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/joinConfig.cmake.in"
+  "/root/repo/core/CMakeLists.txt"
+  "/root/repo/core/join_core.pc.in"
+  "/root/repo/core/samples/CMakeLists.txt"
+  "/root/repo/core/tests/CMakeLists.txt"
+  "/root/repo/crypto/CMakeLists.txt"
+  "/root/repo/crypto/join_crypto.pc.in"
+  "/root/repo/crypto/tests/CMakeLists.txt"
+  "/root/repo/data/CMakeLists.txt"
+  "/root/repo/data/join_data.pc.in"
+  "/root/repo/data/tests/CMakeLists.txt"
+  "/root/repo/fabric/CMakeLists.txt"
+  "/root/repo/fabric/join_fabric.pc.in"
+  "/root/repo/fabric/samples/CMakeLists.txt"
+  "/root/repo/fabric/tests/CMakeLists.txt"
+  "/root/repo/services/CMakeLists.txt"
+  "/root/repo/services/join_services.pc.in"
+  "/root/repo/services/samples/CMakeLists.txt"
+  "/root/repo/services/tests/CMakeLists.txt"
+  "/root/repo/version.hpp.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGTest.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GoogleTest.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "/root/repo/core/include/join/version.hpp"
+  "joinConfig.cmake"
+  "joinConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "core/join_core.pc"
+  "core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "core/samples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "core/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "crypto/join_crypto.pc"
+  "crypto/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "crypto/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "data/join_data.pc"
+  "data/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "data/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fabric/join_fabric.pc"
+  "fabric/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fabric/samples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "fabric/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "services/join_services.pc"
+  "services/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "services/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "services/samples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "core/CMakeFiles/join_core.dir/DependInfo.cmake"
+  "core/samples/CMakeFiles/reactorbench.dir/DependInfo.cmake"
+  "core/samples/CMakeFiles/timerbench.dir/DependInfo.cmake"
+  "core/samples/CMakeFiles/sendzcbench.dir/DependInfo.cmake"
+  "core/samples/CMakeFiles/poolbench.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/error.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/utils.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/filesystem.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/traits.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/variant.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/reactor.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/reactor_group.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/io_operation.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/proactor.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/proactor_group.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/realtime_timer.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/monotonic_timer.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/timer_wheel.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/monotonic_stats.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/monotonicraw_stats.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/rdtsc_stats.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/counter_stats.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/local_mem.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/local_alloc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/local_spsc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/local_mpsc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/local_mpmc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shm_mem.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shm_alloc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shm_spsc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shm_mpsc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shm_mpmc.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/mutex.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/recursive_mutex.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shared_mutex.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/condition.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shared_condition.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/semaphore.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shared_semaphore.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/futex.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/shared_futex.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/function.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/thread.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/thread_pool.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/task_graph.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/mac_address.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/ip_address.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/endpoint.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/protocol.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/unix_datagram_socket.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/unix_stream_socket.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/unix_stream_acceptor.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/raw_socket.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/udp_socket.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/icmp_socket.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/tcp_socket.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/tcp_socket_stream.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/tcp_acceptor.gtest.dir/DependInfo.cmake"
+  "core/tests/CMakeFiles/cpu.gtest.dir/DependInfo.cmake"
+  "crypto/CMakeFiles/join_crypto.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/base64.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/openssl.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/digest_error.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/digest.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/hmac.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/tls_key.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/signature.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/tls_error.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/tls_context.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/tls_protocol.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/tls_wrapper.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/tls_stream.gtest.dir/DependInfo.cmake"
+  "crypto/tests/CMakeFiles/dtls_wrapper.gtest.dir/DependInfo.cmake"
+  "data/CMakeFiles/join_data.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/dtoa.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/string_view.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/stream_view.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/value.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/sax_error.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/pack_reader.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/pack_writer.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/json_error.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/json_reader.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/json_writer.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/json_canonicalizer.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/roundtrip.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/parse.gtest.dir/DependInfo.cmake"
+  "data/tests/CMakeFiles/zstream.gtest.dir/DependInfo.cmake"
+  "fabric/CMakeFiles/join_fabric.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/ifplugd.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/arping.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/ping.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/traceroute.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/nslookup.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/dhclient.dir/DependInfo.cmake"
+  "fabric/samples/CMakeFiles/dhcpd.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dns_message.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dns_protocol.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dns.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/mdns_protocol.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/mdns.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dot_protocol.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dot.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/netlink_protocol.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/netlink_endpoint.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/netlink_socket.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/neighbor.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/neighbor_manager.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/arp.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/ping.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/interface.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/interface_manager.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/route.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/route_manager.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dhcp_option.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dhcp_protocol.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dhcp_message.gtest.dir/DependInfo.cmake"
+  "fabric/tests/CMakeFiles/dhcp.gtest.dir/DependInfo.cmake"
+  "services/CMakeFiles/join_services.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/cache.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/chunk_stream.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_protocol.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_error.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_request.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_response.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_client_pool.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_parser.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_router.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_event.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/http_sharded.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/https.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/smtp_sender.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/smtp_protocol.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/smtp_recipient.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/smtp_message.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/smtp.gtest.dir/DependInfo.cmake"
+  "services/tests/CMakeFiles/smtps.gtest.dir/DependInfo.cmake"
+  "services/samples/CMakeFiles/webbench.dir/DependInfo.cmake"
+  )
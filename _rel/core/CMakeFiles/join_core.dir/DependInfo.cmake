@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/core/src/condition.cpp" "core/CMakeFiles/join_core.dir/src/condition.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/condition.cpp.o.d"
+  "/root/repo/core/src/cpu.cpp" "core/CMakeFiles/join_core.dir/src/cpu.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/cpu.cpp.o.d"
+  "/root/repo/core/src/error.cpp" "core/CMakeFiles/join_core.dir/src/error.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/error.cpp.o.d"
+  "/root/repo/core/src/io_operation.cpp" "core/CMakeFiles/join_core.dir/src/io_operation.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/io_operation.cpp.o.d"
+  "/root/repo/core/src/ip_address.cpp" "core/CMakeFiles/join_core.dir/src/ip_address.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/ip_address.cpp.o.d"
+  "/root/repo/core/src/mac_address.cpp" "core/CMakeFiles/join_core.dir/src/mac_address.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/mac_address.cpp.o.d"
+  "/root/repo/core/src/mutex.cpp" "core/CMakeFiles/join_core.dir/src/mutex.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/mutex.cpp.o.d"
+  "/root/repo/core/src/reactor.cpp" "core/CMakeFiles/join_core.dir/src/reactor.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/reactor.cpp.o.d"
+  "/root/repo/core/src/semaphore.cpp" "core/CMakeFiles/join_core.dir/src/semaphore.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/semaphore.cpp.o.d"
+  "/root/repo/core/src/thread.cpp" "core/CMakeFiles/join_core.dir/src/thread.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/thread.cpp.o.d"
+  "/root/repo/core/src/thread_pool.cpp" "core/CMakeFiles/join_core.dir/src/thread_pool.cpp.o" "gcc" "core/CMakeFiles/join_core.dir/src/thread_pool.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel/core/libjoin_core.so" "/root/repo/_rel/core/libjoin_core.so.5.0.0"
+  "/root/repo/_rel/core/libjoin_core.so.5" "/root/repo/_rel/core/libjoin_core.so.5.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/join_core.dir/src/condition.cpp.o"
+  "CMakeFiles/join_core.dir/src/condition.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/cpu.cpp.o"
+  "CMakeFiles/join_core.dir/src/cpu.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/error.cpp.o"
+  "CMakeFiles/join_core.dir/src/error.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/io_operation.cpp.o"
+  "CMakeFiles/join_core.dir/src/io_operation.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/ip_address.cpp.o"
+  "CMakeFiles/join_core.dir/src/ip_address.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/mac_address.cpp.o"
+  "CMakeFiles/join_core.dir/src/mac_address.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/mutex.cpp.o"
+  "CMakeFiles/join_core.dir/src/mutex.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/reactor.cpp.o"
+  "CMakeFiles/join_core.dir/src/reactor.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/semaphore.cpp.o"
+  "CMakeFiles/join_core.dir/src/semaphore.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/thread.cpp.o"
+  "CMakeFiles/join_core.dir/src/thread.cpp.o.d"
+  "CMakeFiles/join_core.dir/src/thread_pool.cpp.o"
+  "CMakeFiles/join_core.dir/src/thread_pool.cpp.o.d"
+  "libjoin_core.pdb"
+  "libjoin_core.so"
+  "libjoin_core.so.5"
+  "libjoin_core.so.5.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/core
+# Build directory: /root/repo/_rel/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("samples")
+subdirs("tests")
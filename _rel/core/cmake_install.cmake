@@ -0,0 +1,144 @@
+# Install script for directory: /root/repo/core
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "Release")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so.5.0.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so.5"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      file(RPATH_CHECK
+           FILE "${file}"
+           RPATH "")
+    endif()
+  endforeach()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES
+    "/root/repo/_rel/core/libjoin_core.so.5.0.0"
+    "/root/repo/_rel/core/libjoin_core.so.5"
+    )
+  foreach(file
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so.5.0.0"
+      "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so.5"
+      )
+    if(EXISTS "${file}" AND
+       NOT IS_SYMLINK "${file}")
+      if(CMAKE_INSTALL_DO_STRIP)
+        execute_process(COMMAND "/usr/bin/strip" "${file}")
+      endif()
+    endif()
+  endforeach()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so"
+         RPATH "")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_rel/core/libjoin_core.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libjoin_core.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/join" TYPE FILE FILES
+    "/root/repo/core/include/join/version.hpp"
+    "/root/repo/core/include/join/error.hpp"
+    "/root/repo/core/include/join/utils.hpp"
+    "/root/repo/core/include/join/filesystem.hpp"
+    "/root/repo/core/include/join/traits.hpp"
+    "/root/repo/core/include/join/variant.hpp"
+    "/root/repo/core/include/join/reactor.hpp"
+    "/root/repo/core/include/join/io_operation.hpp"
+    "/root/repo/core/include/join/proactor.hpp"
+    "/root/repo/core/include/join/memory.hpp"
+    "/root/repo/core/include/join/allocator.hpp"
+    "/root/repo/core/include/join/queue.hpp"
+    "/root/repo/core/include/join/backoff.hpp"
+    "/root/repo/core/include/join/mutex.hpp"
+    "/root/repo/core/include/join/condition.hpp"
+    "/root/repo/core/include/join/semaphore.hpp"
+    "/root/repo/core/include/join/futex.hpp"
+    "/root/repo/core/include/join/function.hpp"
+    "/root/repo/core/include/join/thread.hpp"
+    "/root/repo/core/include/join/thread_pool.hpp"
+    "/root/repo/core/include/join/task_graph.hpp"
+    "/root/repo/core/include/join/mac_address.hpp"
+    "/root/repo/core/include/join/ip_address.hpp"
+    "/root/repo/core/include/join/endpoint.hpp"
+    "/root/repo/core/include/join/protocol.hpp"
+    "/root/repo/core/include/join/socket.hpp"
+    "/root/repo/core/include/join/datagram_socket.hpp"
+    "/root/repo/core/include/join/stream_socket.hpp"
+    "/root/repo/core/include/join/socket_stream.hpp"
+    "/root/repo/core/include/join/acceptor.hpp"
+    "/root/repo/core/include/join/cpu.hpp"
+    "/root/repo/core/include/join/clock.hpp"
+    "/root/repo/core/include/join/timer.hpp"
+    "/root/repo/core/include/join/timer_wheel.hpp"
+    "/root/repo/core/include/join/statistics.hpp"
+    "/root/repo/core/include/join/proactor_epoll_impl.hpp"
+    )
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib/pkgconfig" TYPE FILE FILES "/root/repo/_rel/core/join_core.pc")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_rel/core/samples/cmake_install.cmake")
+endif()
+
+if(NOT CMAKE_INSTALL_LOCAL_ONLY)
+  # Include the install script for the subdirectory.
+  include("/root/repo/_rel/core/tests/cmake_install.cmake")
+endif()
+
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/poolbench.dir/poolbench.cpp.o"
+  "CMakeFiles/poolbench.dir/poolbench.cpp.o.d"
+  "poolbench"
+  "poolbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/poolbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reactorbench.dir/reactorbench.cpp.o"
+  "CMakeFiles/reactorbench.dir/reactorbench.cpp.o.d"
+  "reactorbench"
+  "reactorbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reactorbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
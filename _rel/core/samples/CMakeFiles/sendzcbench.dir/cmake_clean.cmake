@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sendzcbench.dir/sendzcbench.cpp.o"
+  "CMakeFiles/sendzcbench.dir/sendzcbench.cpp.o.d"
+  "sendzcbench"
+  "sendzcbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sendzcbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timerbench.dir/timerbench.cpp.o"
+  "CMakeFiles/timerbench.dir/timerbench.cpp.o.d"
+  "timerbench"
+  "timerbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timerbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
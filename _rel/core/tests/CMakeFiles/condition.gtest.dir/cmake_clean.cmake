@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/condition.gtest.dir/condition_test.cpp.o"
+  "CMakeFiles/condition.gtest.dir/condition_test.cpp.o.d"
+  "condition.gtest"
+  "condition.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/condition.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/counter_stats.gtest.dir/counter_stats_test.cpp.o"
+  "CMakeFiles/counter_stats.gtest.dir/counter_stats_test.cpp.o.d"
+  "counter_stats.gtest"
+  "counter_stats.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/counter_stats.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpu.gtest.dir/cpu_test.cpp.o"
+  "CMakeFiles/cpu.gtest.dir/cpu_test.cpp.o.d"
+  "cpu.gtest"
+  "cpu.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cpu.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
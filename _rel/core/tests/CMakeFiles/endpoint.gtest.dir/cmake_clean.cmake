@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/endpoint.gtest.dir/endpoint_test.cpp.o"
+  "CMakeFiles/endpoint.gtest.dir/endpoint_test.cpp.o.d"
+  "endpoint.gtest"
+  "endpoint.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/endpoint.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
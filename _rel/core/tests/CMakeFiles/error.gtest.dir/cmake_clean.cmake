@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/error.gtest.dir/error_test.cpp.o"
+  "CMakeFiles/error.gtest.dir/error_test.cpp.o.d"
+  "error.gtest"
+  "error.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/error.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
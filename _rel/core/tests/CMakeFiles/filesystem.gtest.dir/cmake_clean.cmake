@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/filesystem.gtest.dir/filesystem_test.cpp.o"
+  "CMakeFiles/filesystem.gtest.dir/filesystem_test.cpp.o.d"
+  "filesystem.gtest"
+  "filesystem.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/filesystem.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/function.gtest.dir/function_test.cpp.o"
+  "CMakeFiles/function.gtest.dir/function_test.cpp.o.d"
+  "function.gtest"
+  "function.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/function.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
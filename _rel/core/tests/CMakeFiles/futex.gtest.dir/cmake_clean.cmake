@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/futex.gtest.dir/futex_test.cpp.o"
+  "CMakeFiles/futex.gtest.dir/futex_test.cpp.o.d"
+  "futex.gtest"
+  "futex.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/futex.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/icmp_socket.gtest.dir/icmp_socket_test.cpp.o"
+  "CMakeFiles/icmp_socket.gtest.dir/icmp_socket_test.cpp.o.d"
+  "icmp_socket.gtest"
+  "icmp_socket.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/icmp_socket.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/io_operation.gtest.dir/io_operation_test.cpp.o"
+  "CMakeFiles/io_operation.gtest.dir/io_operation_test.cpp.o.d"
+  "io_operation.gtest"
+  "io_operation.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/io_operation.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ip_address.gtest.dir/ip_address_test.cpp.o"
+  "CMakeFiles/ip_address.gtest.dir/ip_address_test.cpp.o.d"
+  "ip_address.gtest"
+  "ip_address.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ip_address.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_alloc.gtest.dir/local_alloc_test.cpp.o"
+  "CMakeFiles/local_alloc.gtest.dir/local_alloc_test.cpp.o.d"
+  "local_alloc.gtest"
+  "local_alloc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_alloc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_mem.gtest.dir/local_mem_test.cpp.o"
+  "CMakeFiles/local_mem.gtest.dir/local_mem_test.cpp.o.d"
+  "local_mem.gtest"
+  "local_mem.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_mem.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_mpmc.gtest.dir/local_mpmc_test.cpp.o"
+  "CMakeFiles/local_mpmc.gtest.dir/local_mpmc_test.cpp.o.d"
+  "local_mpmc.gtest"
+  "local_mpmc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_mpmc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
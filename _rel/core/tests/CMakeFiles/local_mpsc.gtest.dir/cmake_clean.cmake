@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_mpsc.gtest.dir/local_mpsc_test.cpp.o"
+  "CMakeFiles/local_mpsc.gtest.dir/local_mpsc_test.cpp.o.d"
+  "local_mpsc.gtest"
+  "local_mpsc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_mpsc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/local_spsc.gtest.dir/local_spsc_test.cpp.o"
+  "CMakeFiles/local_spsc.gtest.dir/local_spsc_test.cpp.o.d"
+  "local_spsc.gtest"
+  "local_spsc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/local_spsc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mac_address.gtest.dir/mac_address_test.cpp.o"
+  "CMakeFiles/mac_address.gtest.dir/mac_address_test.cpp.o.d"
+  "mac_address.gtest"
+  "mac_address.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mac_address.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
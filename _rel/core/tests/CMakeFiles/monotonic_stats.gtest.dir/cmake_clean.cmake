@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/monotonic_stats.gtest.dir/monotonic_stats_test.cpp.o"
+  "CMakeFiles/monotonic_stats.gtest.dir/monotonic_stats_test.cpp.o.d"
+  "monotonic_stats.gtest"
+  "monotonic_stats.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/monotonic_stats.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/monotonic_timer.gtest.dir/monotonic_timer_test.cpp.o"
+  "CMakeFiles/monotonic_timer.gtest.dir/monotonic_timer_test.cpp.o.d"
+  "monotonic_timer.gtest"
+  "monotonic_timer.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/monotonic_timer.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
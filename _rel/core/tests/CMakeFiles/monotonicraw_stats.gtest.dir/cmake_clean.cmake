@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/monotonicraw_stats.gtest.dir/monotonicraw_stats_test.cpp.o"
+  "CMakeFiles/monotonicraw_stats.gtest.dir/monotonicraw_stats_test.cpp.o.d"
+  "monotonicraw_stats.gtest"
+  "monotonicraw_stats.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/monotonicraw_stats.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mutex.gtest.dir/mutex_test.cpp.o"
+  "CMakeFiles/mutex.gtest.dir/mutex_test.cpp.o.d"
+  "mutex.gtest"
+  "mutex.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mutex.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/proactor.gtest.dir/proactor_test.cpp.o"
+  "CMakeFiles/proactor.gtest.dir/proactor_test.cpp.o.d"
+  "proactor.gtest"
+  "proactor.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/proactor.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/proactor_group.gtest.dir/proactor_group_test.cpp.o"
+  "CMakeFiles/proactor_group.gtest.dir/proactor_group_test.cpp.o.d"
+  "proactor_group.gtest"
+  "proactor_group.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/proactor_group.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
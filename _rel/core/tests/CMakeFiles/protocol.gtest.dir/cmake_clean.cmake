@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/protocol.gtest.dir/protocol_test.cpp.o"
+  "CMakeFiles/protocol.gtest.dir/protocol_test.cpp.o.d"
+  "protocol.gtest"
+  "protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/raw_socket.gtest.dir/raw_socket_test.cpp.o"
+  "CMakeFiles/raw_socket.gtest.dir/raw_socket_test.cpp.o.d"
+  "raw_socket.gtest"
+  "raw_socket.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/raw_socket.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/rdtsc_stats.gtest.dir/rdtsc_stats_test.cpp.o"
+  "CMakeFiles/rdtsc_stats.gtest.dir/rdtsc_stats_test.cpp.o.d"
+  "rdtsc_stats.gtest"
+  "rdtsc_stats.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/rdtsc_stats.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reactor.gtest.dir/reactor_test.cpp.o"
+  "CMakeFiles/reactor.gtest.dir/reactor_test.cpp.o.d"
+  "reactor.gtest"
+  "reactor.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reactor.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
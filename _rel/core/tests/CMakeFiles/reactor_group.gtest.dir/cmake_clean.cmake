@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/reactor_group.gtest.dir/reactor_group_test.cpp.o"
+  "CMakeFiles/reactor_group.gtest.dir/reactor_group_test.cpp.o.d"
+  "reactor_group.gtest"
+  "reactor_group.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/reactor_group.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
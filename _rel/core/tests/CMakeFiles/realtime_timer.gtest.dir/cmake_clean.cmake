@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/realtime_timer.gtest.dir/realtime_timer_test.cpp.o"
+  "CMakeFiles/realtime_timer.gtest.dir/realtime_timer_test.cpp.o.d"
+  "realtime_timer.gtest"
+  "realtime_timer.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/realtime_timer.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/recursive_mutex.gtest.dir/recursive_mutex_test.cpp.o"
+  "CMakeFiles/recursive_mutex.gtest.dir/recursive_mutex_test.cpp.o.d"
+  "recursive_mutex.gtest"
+  "recursive_mutex.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/recursive_mutex.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
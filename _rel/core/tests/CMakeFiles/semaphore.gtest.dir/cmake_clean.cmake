@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/semaphore.gtest.dir/semaphore_test.cpp.o"
+  "CMakeFiles/semaphore.gtest.dir/semaphore_test.cpp.o.d"
+  "semaphore.gtest"
+  "semaphore.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/semaphore.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
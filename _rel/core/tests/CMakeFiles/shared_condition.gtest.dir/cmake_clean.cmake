@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shared_condition.gtest.dir/shared_condition_test.cpp.o"
+  "CMakeFiles/shared_condition.gtest.dir/shared_condition_test.cpp.o.d"
+  "shared_condition.gtest"
+  "shared_condition.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_condition.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
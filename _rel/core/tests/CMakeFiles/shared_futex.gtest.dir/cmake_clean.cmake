@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shared_futex.gtest.dir/shared_futex_test.cpp.o"
+  "CMakeFiles/shared_futex.gtest.dir/shared_futex_test.cpp.o.d"
+  "shared_futex.gtest"
+  "shared_futex.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_futex.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shared_mutex.gtest.dir/shared_mutex_test.cpp.o"
+  "CMakeFiles/shared_mutex.gtest.dir/shared_mutex_test.cpp.o.d"
+  "shared_mutex.gtest"
+  "shared_mutex.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_mutex.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
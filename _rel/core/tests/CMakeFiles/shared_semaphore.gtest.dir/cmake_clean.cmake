@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shared_semaphore.gtest.dir/shared_semaphore_test.cpp.o"
+  "CMakeFiles/shared_semaphore.gtest.dir/shared_semaphore_test.cpp.o.d"
+  "shared_semaphore.gtest"
+  "shared_semaphore.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shared_semaphore.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_alloc.gtest.dir/shm_alloc_test.cpp.o"
+  "CMakeFiles/shm_alloc.gtest.dir/shm_alloc_test.cpp.o.d"
+  "shm_alloc.gtest"
+  "shm_alloc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_alloc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_mem.gtest.dir/shm_mem_test.cpp.o"
+  "CMakeFiles/shm_mem.gtest.dir/shm_mem_test.cpp.o.d"
+  "shm_mem.gtest"
+  "shm_mem.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_mem.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
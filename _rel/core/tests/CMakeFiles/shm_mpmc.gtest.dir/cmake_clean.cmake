@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_mpmc.gtest.dir/shm_mpmc_test.cpp.o"
+  "CMakeFiles/shm_mpmc.gtest.dir/shm_mpmc_test.cpp.o.d"
+  "shm_mpmc.gtest"
+  "shm_mpmc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_mpmc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_mpsc.gtest.dir/shm_mpsc_test.cpp.o"
+  "CMakeFiles/shm_mpsc.gtest.dir/shm_mpsc_test.cpp.o.d"
+  "shm_mpsc.gtest"
+  "shm_mpsc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_mpsc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
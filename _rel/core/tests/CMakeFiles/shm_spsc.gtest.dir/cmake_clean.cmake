@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/shm_spsc.gtest.dir/shm_spsc_test.cpp.o"
+  "CMakeFiles/shm_spsc.gtest.dir/shm_spsc_test.cpp.o.d"
+  "shm_spsc.gtest"
+  "shm_spsc.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/shm_spsc.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/task_graph.gtest.dir/task_graph_test.cpp.o"
+  "CMakeFiles/task_graph.gtest.dir/task_graph_test.cpp.o.d"
+  "task_graph.gtest"
+  "task_graph.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/task_graph.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
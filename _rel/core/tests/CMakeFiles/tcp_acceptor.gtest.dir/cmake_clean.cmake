@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_acceptor.gtest.dir/tcp_acceptor_test.cpp.o"
+  "CMakeFiles/tcp_acceptor.gtest.dir/tcp_acceptor_test.cpp.o.d"
+  "tcp_acceptor.gtest"
+  "tcp_acceptor.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp_acceptor.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tcp_socket.gtest.dir/tcp_socket_test.cpp.o"
+  "CMakeFiles/tcp_socket.gtest.dir/tcp_socket_test.cpp.o.d"
+  "tcp_socket.gtest"
+  "tcp_socket.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tcp_socket.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread.gtest.dir/thread_test.cpp.o"
+  "CMakeFiles/thread.gtest.dir/thread_test.cpp.o.d"
+  "thread.gtest"
+  "thread.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/thread_pool.gtest.dir/thread_pool_test.cpp.o"
+  "CMakeFiles/thread_pool.gtest.dir/thread_pool_test.cpp.o.d"
+  "thread_pool.gtest"
+  "thread_pool.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/thread_pool.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timer_wheel.gtest.dir/timer_wheel_test.cpp.o"
+  "CMakeFiles/timer_wheel.gtest.dir/timer_wheel_test.cpp.o.d"
+  "timer_wheel.gtest"
+  "timer_wheel.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timer_wheel.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
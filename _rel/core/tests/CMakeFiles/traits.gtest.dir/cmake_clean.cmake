@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/traits.gtest.dir/traits_test.cpp.o"
+  "CMakeFiles/traits.gtest.dir/traits_test.cpp.o.d"
+  "traits.gtest"
+  "traits.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/traits.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
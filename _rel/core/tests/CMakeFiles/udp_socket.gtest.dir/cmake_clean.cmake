@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/udp_socket.gtest.dir/udp_socket_test.cpp.o"
+  "CMakeFiles/udp_socket.gtest.dir/udp_socket_test.cpp.o.d"
+  "udp_socket.gtest"
+  "udp_socket.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/udp_socket.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
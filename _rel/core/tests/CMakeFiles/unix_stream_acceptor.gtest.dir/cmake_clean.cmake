@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unix_stream_acceptor.gtest.dir/unix_stream_acceptor_test.cpp.o"
+  "CMakeFiles/unix_stream_acceptor.gtest.dir/unix_stream_acceptor_test.cpp.o.d"
+  "unix_stream_acceptor.gtest"
+  "unix_stream_acceptor.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unix_stream_acceptor.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
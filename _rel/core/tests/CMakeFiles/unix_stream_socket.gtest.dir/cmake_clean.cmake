@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unix_stream_socket.gtest.dir/unix_stream_socket_test.cpp.o"
+  "CMakeFiles/unix_stream_socket.gtest.dir/unix_stream_socket_test.cpp.o.d"
+  "unix_stream_socket.gtest"
+  "unix_stream_socket.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/unix_stream_socket.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
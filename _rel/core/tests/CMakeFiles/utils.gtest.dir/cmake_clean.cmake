@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils.gtest.dir/utils_test.cpp.o"
+  "CMakeFiles/utils.gtest.dir/utils_test.cpp.o.d"
+  "utils.gtest"
+  "utils.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/utils.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/variant.gtest.dir/variant_test.cpp.o"
+  "CMakeFiles/variant.gtest.dir/variant_test.cpp.o.d"
+  "variant.gtest"
+  "variant.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/variant.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
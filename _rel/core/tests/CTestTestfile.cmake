@@ -0,0 +1,114 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/core/tests
+# Build directory: /root/repo/_rel/core/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[error.gtest]=] "/root/repo/_rel/core/tests/error.gtest")
+set_tests_properties([=[error.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;7;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[utils.gtest]=] "/root/repo/_rel/core/tests/utils.gtest")
+set_tests_properties([=[utils.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;12;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[filesystem.gtest]=] "/root/repo/_rel/core/tests/filesystem.gtest")
+set_tests_properties([=[filesystem.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;17;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[traits.gtest]=] "/root/repo/_rel/core/tests/traits.gtest")
+set_tests_properties([=[traits.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;22;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[variant.gtest]=] "/root/repo/_rel/core/tests/variant.gtest")
+set_tests_properties([=[variant.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;27;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[reactor.gtest]=] "/root/repo/_rel/core/tests/reactor.gtest")
+set_tests_properties([=[reactor.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;32;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[reactor_group.gtest]=] "/root/repo/_rel/core/tests/reactor_group.gtest")
+set_tests_properties([=[reactor_group.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;37;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[io_operation.gtest]=] "/root/repo/_rel/core/tests/io_operation.gtest")
+set_tests_properties([=[io_operation.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;42;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[proactor.gtest]=] "/root/repo/_rel/core/tests/proactor.gtest")
+set_tests_properties([=[proactor.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;54;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[proactor_group.gtest]=] "/root/repo/_rel/core/tests/proactor_group.gtest")
+set_tests_properties([=[proactor_group.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;59;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[realtime_timer.gtest]=] "/root/repo/_rel/core/tests/realtime_timer.gtest")
+set_tests_properties([=[realtime_timer.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;76;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[monotonic_timer.gtest]=] "/root/repo/_rel/core/tests/monotonic_timer.gtest")
+set_tests_properties([=[monotonic_timer.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;81;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[timer_wheel.gtest]=] "/root/repo/_rel/core/tests/timer_wheel.gtest")
+set_tests_properties([=[timer_wheel.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;86;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[monotonic_stats.gtest]=] "/root/repo/_rel/core/tests/monotonic_stats.gtest")
+set_tests_properties([=[monotonic_stats.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;91;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[monotonicraw_stats.gtest]=] "/root/repo/_rel/core/tests/monotonicraw_stats.gtest")
+set_tests_properties([=[monotonicraw_stats.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;96;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[rdtsc_stats.gtest]=] "/root/repo/_rel/core/tests/rdtsc_stats.gtest")
+set_tests_properties([=[rdtsc_stats.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;101;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[counter_stats.gtest]=] "/root/repo/_rel/core/tests/counter_stats.gtest")
+set_tests_properties([=[counter_stats.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;106;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[local_mem.gtest]=] "/root/repo/_rel/core/tests/local_mem.gtest")
+set_tests_properties([=[local_mem.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;111;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[local_alloc.gtest]=] "/root/repo/_rel/core/tests/local_alloc.gtest")
+set_tests_properties([=[local_alloc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;116;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[local_spsc.gtest]=] "/root/repo/_rel/core/tests/local_spsc.gtest")
+set_tests_properties([=[local_spsc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;121;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[local_mpsc.gtest]=] "/root/repo/_rel/core/tests/local_mpsc.gtest")
+set_tests_properties([=[local_mpsc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;126;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[local_mpmc.gtest]=] "/root/repo/_rel/core/tests/local_mpmc.gtest")
+set_tests_properties([=[local_mpmc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;131;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shm_mem.gtest]=] "/root/repo/_rel/core/tests/shm_mem.gtest")
+set_tests_properties([=[shm_mem.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;136;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shm_alloc.gtest]=] "/root/repo/_rel/core/tests/shm_alloc.gtest")
+set_tests_properties([=[shm_alloc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;141;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shm_spsc.gtest]=] "/root/repo/_rel/core/tests/shm_spsc.gtest")
+set_tests_properties([=[shm_spsc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;146;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shm_mpsc.gtest]=] "/root/repo/_rel/core/tests/shm_mpsc.gtest")
+set_tests_properties([=[shm_mpsc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;151;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shm_mpmc.gtest]=] "/root/repo/_rel/core/tests/shm_mpmc.gtest")
+set_tests_properties([=[shm_mpmc.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;156;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[mutex.gtest]=] "/root/repo/_rel/core/tests/mutex.gtest")
+set_tests_properties([=[mutex.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;161;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[recursive_mutex.gtest]=] "/root/repo/_rel/core/tests/recursive_mutex.gtest")
+set_tests_properties([=[recursive_mutex.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;166;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shared_mutex.gtest]=] "/root/repo/_rel/core/tests/shared_mutex.gtest")
+set_tests_properties([=[shared_mutex.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;171;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[condition.gtest]=] "/root/repo/_rel/core/tests/condition.gtest")
+set_tests_properties([=[condition.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;176;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shared_condition.gtest]=] "/root/repo/_rel/core/tests/shared_condition.gtest")
+set_tests_properties([=[shared_condition.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;181;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[semaphore.gtest]=] "/root/repo/_rel/core/tests/semaphore.gtest")
+set_tests_properties([=[semaphore.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;186;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shared_semaphore.gtest]=] "/root/repo/_rel/core/tests/shared_semaphore.gtest")
+set_tests_properties([=[shared_semaphore.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;191;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[futex.gtest]=] "/root/repo/_rel/core/tests/futex.gtest")
+set_tests_properties([=[futex.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;196;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[shared_futex.gtest]=] "/root/repo/_rel/core/tests/shared_futex.gtest")
+set_tests_properties([=[shared_futex.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;201;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[function.gtest]=] "/root/repo/_rel/core/tests/function.gtest")
+set_tests_properties([=[function.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;206;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[thread.gtest]=] "/root/repo/_rel/core/tests/thread.gtest")
+set_tests_properties([=[thread.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;211;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[thread_pool.gtest]=] "/root/repo/_rel/core/tests/thread_pool.gtest")
+set_tests_properties([=[thread_pool.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;216;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[task_graph.gtest]=] "/root/repo/_rel/core/tests/task_graph.gtest")
+set_tests_properties([=[task_graph.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;221;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[mac_address.gtest]=] "/root/repo/_rel/core/tests/mac_address.gtest")
+set_tests_properties([=[mac_address.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;226;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[ip_address.gtest]=] "/root/repo/_rel/core/tests/ip_address.gtest")
+set_tests_properties([=[ip_address.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;231;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[endpoint.gtest]=] "/root/repo/_rel/core/tests/endpoint.gtest")
+set_tests_properties([=[endpoint.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;236;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[protocol.gtest]=] "/root/repo/_rel/core/tests/protocol.gtest")
+set_tests_properties([=[protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;241;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[unix_datagram_socket.gtest]=] "/root/repo/_rel/core/tests/unix_datagram_socket.gtest")
+set_tests_properties([=[unix_datagram_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;246;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[unix_stream_socket.gtest]=] "/root/repo/_rel/core/tests/unix_stream_socket.gtest")
+set_tests_properties([=[unix_stream_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;251;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[unix_stream_acceptor.gtest]=] "/root/repo/_rel/core/tests/unix_stream_acceptor.gtest")
+set_tests_properties([=[unix_stream_acceptor.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;256;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[raw_socket.gtest]=] "/root/repo/_rel/core/tests/raw_socket.gtest")
+set_tests_properties([=[raw_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;261;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[udp_socket.gtest]=] "/root/repo/_rel/core/tests/udp_socket.gtest")
+set_tests_properties([=[udp_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;266;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[icmp_socket.gtest]=] "/root/repo/_rel/core/tests/icmp_socket.gtest")
+set_tests_properties([=[icmp_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;271;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[tcp_socket.gtest]=] "/root/repo/_rel/core/tests/tcp_socket.gtest")
+set_tests_properties([=[tcp_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;276;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[tcp_socket_stream.gtest]=] "/root/repo/_rel/core/tests/tcp_socket_stream.gtest")
+set_tests_properties([=[tcp_socket_stream.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;281;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[tcp_acceptor.gtest]=] "/root/repo/_rel/core/tests/tcp_acceptor.gtest")
+set_tests_properties([=[tcp_acceptor.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;286;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
+add_test([=[cpu.gtest]=] "/root/repo/_rel/core/tests/cpu.gtest")
+set_tests_properties([=[cpu.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/core/tests/CMakeLists.txt;291;add_test;/root/repo/core/tests/CMakeLists.txt;0;")
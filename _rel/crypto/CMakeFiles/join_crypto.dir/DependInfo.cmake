@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/crypto/src/base64.cpp" "crypto/CMakeFiles/join_crypto.dir/src/base64.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/base64.cpp.o.d"
+  "/root/repo/crypto/src/digest.cpp" "crypto/CMakeFiles/join_crypto.dir/src/digest.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/digest.cpp.o.d"
+  "/root/repo/crypto/src/hmac.cpp" "crypto/CMakeFiles/join_crypto.dir/src/hmac.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/hmac.cpp.o.d"
+  "/root/repo/crypto/src/openssl.cpp" "crypto/CMakeFiles/join_crypto.dir/src/openssl.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/openssl.cpp.o.d"
+  "/root/repo/crypto/src/signature.cpp" "crypto/CMakeFiles/join_crypto.dir/src/signature.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/signature.cpp.o.d"
+  "/root/repo/crypto/src/tls_context.cpp" "crypto/CMakeFiles/join_crypto.dir/src/tls_context.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/tls_context.cpp.o.d"
+  "/root/repo/crypto/src/tls_error.cpp" "crypto/CMakeFiles/join_crypto.dir/src/tls_error.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/tls_error.cpp.o.d"
+  "/root/repo/crypto/src/tls_key.cpp" "crypto/CMakeFiles/join_crypto.dir/src/tls_key.cpp.o" "gcc" "crypto/CMakeFiles/join_crypto.dir/src/tls_key.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel/crypto/libjoin_crypto.so" "/root/repo/_rel/crypto/libjoin_crypto.so.5.0.0"
+  "/root/repo/_rel/crypto/libjoin_crypto.so.5" "/root/repo/_rel/crypto/libjoin_crypto.so.5.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel/core/CMakeFiles/join_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
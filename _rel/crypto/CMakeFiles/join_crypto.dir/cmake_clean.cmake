@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/join_crypto.dir/src/base64.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/base64.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/digest.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/digest.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/hmac.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/hmac.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/openssl.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/openssl.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/signature.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/signature.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/tls_context.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/tls_context.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/tls_error.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/tls_error.cpp.o.d"
+  "CMakeFiles/join_crypto.dir/src/tls_key.cpp.o"
+  "CMakeFiles/join_crypto.dir/src/tls_key.cpp.o.d"
+  "libjoin_crypto.pdb"
+  "libjoin_crypto.so"
+  "libjoin_crypto.so.5"
+  "libjoin_crypto.so.5.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join_crypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
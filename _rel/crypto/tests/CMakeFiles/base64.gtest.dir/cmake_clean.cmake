@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/base64.gtest.dir/base64_test.cpp.o"
+  "CMakeFiles/base64.gtest.dir/base64_test.cpp.o.d"
+  "base64.gtest"
+  "base64.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/base64.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
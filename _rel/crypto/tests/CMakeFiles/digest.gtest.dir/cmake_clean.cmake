@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/digest.gtest.dir/digest_test.cpp.o"
+  "CMakeFiles/digest.gtest.dir/digest_test.cpp.o.d"
+  "digest.gtest"
+  "digest.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/digest.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
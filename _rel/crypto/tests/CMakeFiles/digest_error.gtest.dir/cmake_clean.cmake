@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/digest_error.gtest.dir/digest_error_test.cpp.o"
+  "CMakeFiles/digest_error.gtest.dir/digest_error_test.cpp.o.d"
+  "digest_error.gtest"
+  "digest_error.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/digest_error.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtls_wrapper.gtest.dir/dtls_wrapper_test.cpp.o"
+  "CMakeFiles/dtls_wrapper.gtest.dir/dtls_wrapper_test.cpp.o.d"
+  "dtls_wrapper.gtest"
+  "dtls_wrapper.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dtls_wrapper.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
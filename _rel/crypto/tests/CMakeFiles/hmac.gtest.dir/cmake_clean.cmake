@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hmac.gtest.dir/hmac_test.cpp.o"
+  "CMakeFiles/hmac.gtest.dir/hmac_test.cpp.o.d"
+  "hmac.gtest"
+  "hmac.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hmac.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
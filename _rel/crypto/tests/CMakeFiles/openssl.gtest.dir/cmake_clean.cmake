@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/openssl.gtest.dir/openssl_test.cpp.o"
+  "CMakeFiles/openssl.gtest.dir/openssl_test.cpp.o.d"
+  "openssl.gtest"
+  "openssl.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/openssl.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
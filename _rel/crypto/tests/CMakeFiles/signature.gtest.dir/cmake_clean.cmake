@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/signature.gtest.dir/signature_test.cpp.o"
+  "CMakeFiles/signature.gtest.dir/signature_test.cpp.o.d"
+  "signature.gtest"
+  "signature.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/signature.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_context.gtest.dir/tls_context_test.cpp.o"
+  "CMakeFiles/tls_context.gtest.dir/tls_context_test.cpp.o.d"
+  "tls_context.gtest"
+  "tls_context.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tls_context.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
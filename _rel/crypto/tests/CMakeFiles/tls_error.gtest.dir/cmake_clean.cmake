@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_error.gtest.dir/tls_error_test.cpp.o"
+  "CMakeFiles/tls_error.gtest.dir/tls_error_test.cpp.o.d"
+  "tls_error.gtest"
+  "tls_error.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tls_error.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_key.gtest.dir/tls_key_test.cpp.o"
+  "CMakeFiles/tls_key.gtest.dir/tls_key_test.cpp.o.d"
+  "tls_key.gtest"
+  "tls_key.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tls_key.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
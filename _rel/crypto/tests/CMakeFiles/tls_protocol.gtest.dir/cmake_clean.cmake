@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_protocol.gtest.dir/tls_protocol_test.cpp.o"
+  "CMakeFiles/tls_protocol.gtest.dir/tls_protocol_test.cpp.o.d"
+  "tls_protocol.gtest"
+  "tls_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tls_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
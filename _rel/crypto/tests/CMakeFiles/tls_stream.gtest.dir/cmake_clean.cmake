@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_stream.gtest.dir/tls_stream_test.cpp.o"
+  "CMakeFiles/tls_stream.gtest.dir/tls_stream_test.cpp.o.d"
+  "tls_stream.gtest"
+  "tls_stream.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tls_stream.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
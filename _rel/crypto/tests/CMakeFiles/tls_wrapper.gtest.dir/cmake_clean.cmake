@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tls_wrapper.gtest.dir/tls_wrapper_test.cpp.o"
+  "CMakeFiles/tls_wrapper.gtest.dir/tls_wrapper_test.cpp.o.d"
+  "tls_wrapper.gtest"
+  "tls_wrapper.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tls_wrapper.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,32 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/crypto/tests
+# Build directory: /root/repo/_rel/crypto/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[base64.gtest]=] "/root/repo/_rel/crypto/tests/base64.gtest")
+set_tests_properties([=[base64.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;7;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[openssl.gtest]=] "/root/repo/_rel/crypto/tests/openssl.gtest")
+set_tests_properties([=[openssl.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;12;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[digest_error.gtest]=] "/root/repo/_rel/crypto/tests/digest_error.gtest")
+set_tests_properties([=[digest_error.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;17;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[digest.gtest]=] "/root/repo/_rel/crypto/tests/digest.gtest")
+set_tests_properties([=[digest.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;22;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[hmac.gtest]=] "/root/repo/_rel/crypto/tests/hmac.gtest")
+set_tests_properties([=[hmac.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;27;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[tls_key.gtest]=] "/root/repo/_rel/crypto/tests/tls_key.gtest")
+set_tests_properties([=[tls_key.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;32;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[signature.gtest]=] "/root/repo/_rel/crypto/tests/signature.gtest")
+set_tests_properties([=[signature.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;37;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[tls_error.gtest]=] "/root/repo/_rel/crypto/tests/tls_error.gtest")
+set_tests_properties([=[tls_error.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;42;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[tls_context.gtest]=] "/root/repo/_rel/crypto/tests/tls_context.gtest")
+set_tests_properties([=[tls_context.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;47;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[tls_protocol.gtest]=] "/root/repo/_rel/crypto/tests/tls_protocol.gtest")
+set_tests_properties([=[tls_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;52;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[tls_wrapper.gtest]=] "/root/repo/_rel/crypto/tests/tls_wrapper.gtest")
+set_tests_properties([=[tls_wrapper.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;57;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[tls_stream.gtest]=] "/root/repo/_rel/crypto/tests/tls_stream.gtest")
+set_tests_properties([=[tls_stream.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;62;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
+add_test([=[dtls_wrapper.gtest]=] "/root/repo/_rel/crypto/tests/dtls_wrapper.gtest")
+set_tests_properties([=[dtls_wrapper.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/crypto/tests/CMakeLists.txt;67;add_test;/root/repo/crypto/tests/CMakeLists.txt;0;")
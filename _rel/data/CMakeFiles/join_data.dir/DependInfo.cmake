@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/data/src/json.cpp" "data/CMakeFiles/join_data.dir/src/json.cpp.o" "gcc" "data/CMakeFiles/join_data.dir/src/json.cpp.o.d"
+  "/root/repo/data/src/sax.cpp" "data/CMakeFiles/join_data.dir/src/sax.cpp.o" "gcc" "data/CMakeFiles/join_data.dir/src/sax.cpp.o.d"
+  "/root/repo/data/src/value.cpp" "data/CMakeFiles/join_data.dir/src/value.cpp.o" "gcc" "data/CMakeFiles/join_data.dir/src/value.cpp.o.d"
+  "/root/repo/data/src/zstream.cpp" "data/CMakeFiles/join_data.dir/src/zstream.cpp.o" "gcc" "data/CMakeFiles/join_data.dir/src/zstream.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel/data/libjoin_data.so" "/root/repo/_rel/data/libjoin_data.so.5.0.0"
+  "/root/repo/_rel/data/libjoin_data.so.5" "/root/repo/_rel/data/libjoin_data.so.5.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel/core/CMakeFiles/join_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
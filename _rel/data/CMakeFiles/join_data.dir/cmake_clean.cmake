@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/join_data.dir/src/json.cpp.o"
+  "CMakeFiles/join_data.dir/src/json.cpp.o.d"
+  "CMakeFiles/join_data.dir/src/sax.cpp.o"
+  "CMakeFiles/join_data.dir/src/sax.cpp.o.d"
+  "CMakeFiles/join_data.dir/src/value.cpp.o"
+  "CMakeFiles/join_data.dir/src/value.cpp.o.d"
+  "CMakeFiles/join_data.dir/src/zstream.cpp.o"
+  "CMakeFiles/join_data.dir/src/zstream.cpp.o.d"
+  "libjoin_data.pdb"
+  "libjoin_data.so"
+  "libjoin_data.so.5"
+  "libjoin_data.so.5.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join_data.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
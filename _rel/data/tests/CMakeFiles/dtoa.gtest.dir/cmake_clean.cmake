@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dtoa.gtest.dir/dtoa_test.cpp.o"
+  "CMakeFiles/dtoa.gtest.dir/dtoa_test.cpp.o.d"
+  "dtoa.gtest"
+  "dtoa.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dtoa.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
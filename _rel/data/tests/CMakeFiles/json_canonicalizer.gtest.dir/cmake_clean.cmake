@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json_canonicalizer.gtest.dir/json_canonicalizer_test.cpp.o"
+  "CMakeFiles/json_canonicalizer.gtest.dir/json_canonicalizer_test.cpp.o.d"
+  "json_canonicalizer.gtest"
+  "json_canonicalizer.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_canonicalizer.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
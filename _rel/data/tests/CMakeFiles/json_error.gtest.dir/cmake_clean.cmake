@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json_error.gtest.dir/json_error_test.cpp.o"
+  "CMakeFiles/json_error.gtest.dir/json_error_test.cpp.o.d"
+  "json_error.gtest"
+  "json_error.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_error.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
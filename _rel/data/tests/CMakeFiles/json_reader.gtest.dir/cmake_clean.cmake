@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json_reader.gtest.dir/json_reader_test.cpp.o"
+  "CMakeFiles/json_reader.gtest.dir/json_reader_test.cpp.o.d"
+  "json_reader.gtest"
+  "json_reader.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_reader.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
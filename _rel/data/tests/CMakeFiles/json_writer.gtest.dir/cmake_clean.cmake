@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/json_writer.gtest.dir/json_writer_test.cpp.o"
+  "CMakeFiles/json_writer.gtest.dir/json_writer_test.cpp.o.d"
+  "json_writer.gtest"
+  "json_writer.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/json_writer.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pack_reader.gtest.dir/pack_reader_test.cpp.o"
+  "CMakeFiles/pack_reader.gtest.dir/pack_reader_test.cpp.o.d"
+  "pack_reader.gtest"
+  "pack_reader.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pack_reader.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/pack_writer.gtest.dir/pack_writer_test.cpp.o"
+  "CMakeFiles/pack_writer.gtest.dir/pack_writer_test.cpp.o.d"
+  "pack_writer.gtest"
+  "pack_writer.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pack_writer.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/parse.gtest.dir/parse_test.cpp.o"
+  "CMakeFiles/parse.gtest.dir/parse_test.cpp.o.d"
+  "parse.gtest"
+  "parse.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parse.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/roundtrip.gtest.dir/roundtrip_test.cpp.o"
+  "CMakeFiles/roundtrip.gtest.dir/roundtrip_test.cpp.o.d"
+  "roundtrip.gtest"
+  "roundtrip.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/roundtrip.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
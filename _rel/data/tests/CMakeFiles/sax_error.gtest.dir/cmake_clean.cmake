@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sax_error.gtest.dir/sax_error_test.cpp.o"
+  "CMakeFiles/sax_error.gtest.dir/sax_error_test.cpp.o.d"
+  "sax_error.gtest"
+  "sax_error.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/sax_error.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stream_view.gtest.dir/stream_view_test.cpp.o"
+  "CMakeFiles/stream_view.gtest.dir/stream_view_test.cpp.o.d"
+  "stream_view.gtest"
+  "stream_view.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stream_view.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/string_view.gtest.dir/string_view_test.cpp.o"
+  "CMakeFiles/string_view.gtest.dir/string_view_test.cpp.o.d"
+  "string_view.gtest"
+  "string_view.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/string_view.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
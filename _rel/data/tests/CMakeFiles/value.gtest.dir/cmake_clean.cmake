@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/value.gtest.dir/value_test.cpp.o"
+  "CMakeFiles/value.gtest.dir/value_test.cpp.o.d"
+  "value.gtest"
+  "value.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/value.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zstream.gtest.dir/zstream_test.cpp.o"
+  "CMakeFiles/zstream.gtest.dir/zstream_test.cpp.o.d"
+  "zstream.gtest"
+  "zstream.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/zstream.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
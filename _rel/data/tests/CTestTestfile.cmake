@@ -0,0 +1,34 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/data/tests
+# Build directory: /root/repo/_rel/data/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[base64.gtest]=] "/root/repo/_rel/crypto/tests/base64.gtest")
+set_tests_properties([=[base64.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;7;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[string_view.gtest]=] "/root/repo/_rel/data/tests/string_view.gtest")
+set_tests_properties([=[string_view.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;12;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[stream_view.gtest]=] "/root/repo/_rel/data/tests/stream_view.gtest")
+set_tests_properties([=[stream_view.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;17;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[value.gtest]=] "/root/repo/_rel/data/tests/value.gtest")
+set_tests_properties([=[value.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;22;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[sax_error.gtest]=] "/root/repo/_rel/data/tests/sax_error.gtest")
+set_tests_properties([=[sax_error.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;27;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[pack_reader.gtest]=] "/root/repo/_rel/data/tests/pack_reader.gtest")
+set_tests_properties([=[pack_reader.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;32;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[pack_writer.gtest]=] "/root/repo/_rel/data/tests/pack_writer.gtest")
+set_tests_properties([=[pack_writer.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;37;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[json_error.gtest]=] "/root/repo/_rel/data/tests/json_error.gtest")
+set_tests_properties([=[json_error.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;42;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[json_reader.gtest]=] "/root/repo/_rel/data/tests/json_reader.gtest")
+set_tests_properties([=[json_reader.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;47;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[json_writer.gtest]=] "/root/repo/_rel/data/tests/json_writer.gtest")
+set_tests_properties([=[json_writer.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;52;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[json_canonicalizer.gtest]=] "/root/repo/_rel/data/tests/json_canonicalizer.gtest")
+set_tests_properties([=[json_canonicalizer.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;57;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[roundtrip.gtest]=] "/root/repo/_rel/data/tests/roundtrip.gtest")
+set_tests_properties([=[roundtrip.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;62;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[parse.gtest]=] "/root/repo/_rel/data/tests/parse.gtest")
+set_tests_properties([=[parse.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;67;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
+add_test([=[zstream.gtest]=] "/root/repo/_rel/data/tests/zstream.gtest")
+set_tests_properties([=[zstream.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/data/tests/CMakeLists.txt;75;add_test;/root/repo/data/tests/CMakeLists.txt;0;")
@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/fabric/src/arp.cpp" "fabric/CMakeFiles/join_fabric.dir/src/arp.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/arp.cpp.o.d"
+  "/root/repo/fabric/src/dhcp_message.cpp" "fabric/CMakeFiles/join_fabric.dir/src/dhcp_message.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/dhcp_message.cpp.o.d"
+  "/root/repo/fabric/src/dhcp_option.cpp" "fabric/CMakeFiles/join_fabric.dir/src/dhcp_option.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/dhcp_option.cpp.o.d"
+  "/root/repo/fabric/src/interface.cpp" "fabric/CMakeFiles/join_fabric.dir/src/interface.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/interface.cpp.o.d"
+  "/root/repo/fabric/src/interface_manager.cpp" "fabric/CMakeFiles/join_fabric.dir/src/interface_manager.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/interface_manager.cpp.o.d"
+  "/root/repo/fabric/src/neighbor.cpp" "fabric/CMakeFiles/join_fabric.dir/src/neighbor.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/neighbor.cpp.o.d"
+  "/root/repo/fabric/src/neighbor_manager.cpp" "fabric/CMakeFiles/join_fabric.dir/src/neighbor_manager.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/neighbor_manager.cpp.o.d"
+  "/root/repo/fabric/src/netlink_manager.cpp" "fabric/CMakeFiles/join_fabric.dir/src/netlink_manager.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/netlink_manager.cpp.o.d"
+  "/root/repo/fabric/src/ping.cpp" "fabric/CMakeFiles/join_fabric.dir/src/ping.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/ping.cpp.o.d"
+  "/root/repo/fabric/src/route.cpp" "fabric/CMakeFiles/join_fabric.dir/src/route.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/route.cpp.o.d"
+  "/root/repo/fabric/src/route_manager.cpp" "fabric/CMakeFiles/join_fabric.dir/src/route_manager.cpp.o" "gcc" "fabric/CMakeFiles/join_fabric.dir/src/route_manager.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel/fabric/libjoin_fabric.so" "/root/repo/_rel/fabric/libjoin_fabric.so.5.0.0"
+  "/root/repo/_rel/fabric/libjoin_fabric.so.5" "/root/repo/_rel/fabric/libjoin_fabric.so.5.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel/crypto/CMakeFiles/join_crypto.dir/DependInfo.cmake"
+  "/root/repo/_rel/core/CMakeFiles/join_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
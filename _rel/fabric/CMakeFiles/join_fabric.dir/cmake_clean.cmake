@@ -0,0 +1,33 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/join_fabric.dir/src/arp.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/arp.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/dhcp_message.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/dhcp_message.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/dhcp_option.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/dhcp_option.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/interface.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/interface.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/interface_manager.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/interface_manager.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/neighbor.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/neighbor.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/neighbor_manager.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/neighbor_manager.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/netlink_manager.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/netlink_manager.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/ping.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/ping.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/route.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/route.cpp.o.d"
+  "CMakeFiles/join_fabric.dir/src/route_manager.cpp.o"
+  "CMakeFiles/join_fabric.dir/src/route_manager.cpp.o.d"
+  "libjoin_fabric.pdb"
+  "libjoin_fabric.so"
+  "libjoin_fabric.so.5"
+  "libjoin_fabric.so.5.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join_fabric.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
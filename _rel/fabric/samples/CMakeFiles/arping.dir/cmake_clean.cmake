@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arping.dir/arping.cpp.o"
+  "CMakeFiles/arping.dir/arping.cpp.o.d"
+  "arping"
+  "arping.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arping.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
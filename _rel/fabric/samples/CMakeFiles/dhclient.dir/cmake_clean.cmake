@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dhclient.dir/dhclient.cpp.o"
+  "CMakeFiles/dhclient.dir/dhclient.cpp.o.d"
+  "dhclient"
+  "dhclient.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dhclient.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dhcpd.dir/dhcpd.cpp.o"
+  "CMakeFiles/dhcpd.dir/dhcpd.cpp.o.d"
+  "dhcpd"
+  "dhcpd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dhcpd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
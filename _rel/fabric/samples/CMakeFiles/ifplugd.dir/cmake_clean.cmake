@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ifplugd.dir/ifplugd.cpp.o"
+  "CMakeFiles/ifplugd.dir/ifplugd.cpp.o.d"
+  "ifplugd"
+  "ifplugd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ifplugd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
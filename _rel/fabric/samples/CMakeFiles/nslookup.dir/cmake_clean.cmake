@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nslookup.dir/nslookup.cpp.o"
+  "CMakeFiles/nslookup.dir/nslookup.cpp.o.d"
+  "nslookup"
+  "nslookup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nslookup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
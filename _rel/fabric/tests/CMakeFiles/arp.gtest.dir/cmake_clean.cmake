@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/arp.gtest.dir/arp_test.cpp.o"
+  "CMakeFiles/arp.gtest.dir/arp_test.cpp.o.d"
+  "arp.gtest"
+  "arp.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/arp.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dhcp.gtest.dir/dhcp_test.cpp.o"
+  "CMakeFiles/dhcp.gtest.dir/dhcp_test.cpp.o.d"
+  "dhcp.gtest"
+  "dhcp.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dhcp.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dhcp_message.gtest.dir/dhcp_message_test.cpp.o"
+  "CMakeFiles/dhcp_message.gtest.dir/dhcp_message_test.cpp.o.d"
+  "dhcp_message.gtest"
+  "dhcp_message.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dhcp_message.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dhcp_option.gtest.dir/dhcp_option_test.cpp.o"
+  "CMakeFiles/dhcp_option.gtest.dir/dhcp_option_test.cpp.o.d"
+  "dhcp_option.gtest"
+  "dhcp_option.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dhcp_option.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dhcp_protocol.gtest.dir/dhcp_protocol_test.cpp.o"
+  "CMakeFiles/dhcp_protocol.gtest.dir/dhcp_protocol_test.cpp.o.d"
+  "dhcp_protocol.gtest"
+  "dhcp_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dhcp_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
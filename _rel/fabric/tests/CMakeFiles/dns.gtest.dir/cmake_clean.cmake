@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dns.gtest.dir/dns_test.cpp.o"
+  "CMakeFiles/dns.gtest.dir/dns_test.cpp.o.d"
+  "dns.gtest"
+  "dns.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dns.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dns_message.gtest.dir/dns_message_test.cpp.o"
+  "CMakeFiles/dns_message.gtest.dir/dns_message_test.cpp.o.d"
+  "dns_message.gtest"
+  "dns_message.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dns_message.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
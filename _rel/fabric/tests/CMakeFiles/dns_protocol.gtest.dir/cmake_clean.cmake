@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dns_protocol.gtest.dir/dns_protocol_test.cpp.o"
+  "CMakeFiles/dns_protocol.gtest.dir/dns_protocol_test.cpp.o.d"
+  "dns_protocol.gtest"
+  "dns_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dns_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dot.gtest.dir/dot_test.cpp.o"
+  "CMakeFiles/dot.gtest.dir/dot_test.cpp.o.d"
+  "dot.gtest"
+  "dot.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dot.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dot_protocol.gtest.dir/dot_protocol_test.cpp.o"
+  "CMakeFiles/dot_protocol.gtest.dir/dot_protocol_test.cpp.o.d"
+  "dot_protocol.gtest"
+  "dot_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dot_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
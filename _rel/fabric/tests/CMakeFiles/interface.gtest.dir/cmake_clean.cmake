@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interface.gtest.dir/interface_test.cpp.o"
+  "CMakeFiles/interface.gtest.dir/interface_test.cpp.o.d"
+  "interface.gtest"
+  "interface.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interface.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
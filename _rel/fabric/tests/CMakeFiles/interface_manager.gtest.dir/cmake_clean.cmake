@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/interface_manager.gtest.dir/interface_manager_test.cpp.o"
+  "CMakeFiles/interface_manager.gtest.dir/interface_manager_test.cpp.o.d"
+  "interface_manager.gtest"
+  "interface_manager.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/interface_manager.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdns.gtest.dir/mdns_test.cpp.o"
+  "CMakeFiles/mdns.gtest.dir/mdns_test.cpp.o.d"
+  "mdns.gtest"
+  "mdns.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdns.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
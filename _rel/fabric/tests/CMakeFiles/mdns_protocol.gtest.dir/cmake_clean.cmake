@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mdns_protocol.gtest.dir/mdns_protocol_test.cpp.o"
+  "CMakeFiles/mdns_protocol.gtest.dir/mdns_protocol_test.cpp.o.d"
+  "mdns_protocol.gtest"
+  "mdns_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mdns_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/neighbor.gtest.dir/neighbor_test.cpp.o"
+  "CMakeFiles/neighbor.gtest.dir/neighbor_test.cpp.o.d"
+  "neighbor.gtest"
+  "neighbor.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/neighbor.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
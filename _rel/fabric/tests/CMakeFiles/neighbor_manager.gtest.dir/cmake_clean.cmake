@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/neighbor_manager.gtest.dir/neighbor_manager_test.cpp.o"
+  "CMakeFiles/neighbor_manager.gtest.dir/neighbor_manager_test.cpp.o.d"
+  "neighbor_manager.gtest"
+  "neighbor_manager.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/neighbor_manager.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
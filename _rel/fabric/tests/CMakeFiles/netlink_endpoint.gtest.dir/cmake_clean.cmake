@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netlink_endpoint.gtest.dir/netlink_endpoint_test.cpp.o"
+  "CMakeFiles/netlink_endpoint.gtest.dir/netlink_endpoint_test.cpp.o.d"
+  "netlink_endpoint.gtest"
+  "netlink_endpoint.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netlink_endpoint.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netlink_protocol.gtest.dir/netlink_protocol_test.cpp.o"
+  "CMakeFiles/netlink_protocol.gtest.dir/netlink_protocol_test.cpp.o.d"
+  "netlink_protocol.gtest"
+  "netlink_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netlink_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/netlink_socket.gtest.dir/netlink_socket_test.cpp.o"
+  "CMakeFiles/netlink_socket.gtest.dir/netlink_socket_test.cpp.o.d"
+  "netlink_socket.gtest"
+  "netlink_socket.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/netlink_socket.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
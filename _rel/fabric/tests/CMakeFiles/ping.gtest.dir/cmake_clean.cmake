@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ping.gtest.dir/ping_test.cpp.o"
+  "CMakeFiles/ping.gtest.dir/ping_test.cpp.o.d"
+  "ping.gtest"
+  "ping.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ping.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
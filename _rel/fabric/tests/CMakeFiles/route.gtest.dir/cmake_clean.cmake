@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/route.gtest.dir/route_test.cpp.o"
+  "CMakeFiles/route.gtest.dir/route_test.cpp.o.d"
+  "route.gtest"
+  "route.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/route.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/route_manager.gtest.dir/route_manager_test.cpp.o"
+  "CMakeFiles/route_manager.gtest.dir/route_manager_test.cpp.o.d"
+  "route_manager.gtest"
+  "route_manager.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/route_manager.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,50 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/fabric/tests
+# Build directory: /root/repo/_rel/fabric/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[dns_message.gtest]=] "/root/repo/_rel/fabric/tests/dns_message.gtest")
+set_tests_properties([=[dns_message.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;7;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dns_protocol.gtest]=] "/root/repo/_rel/fabric/tests/dns_protocol.gtest")
+set_tests_properties([=[dns_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;12;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dns.gtest]=] "/root/repo/_rel/fabric/tests/dns.gtest")
+set_tests_properties([=[dns.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;17;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[mdns_protocol.gtest]=] "/root/repo/_rel/fabric/tests/mdns_protocol.gtest")
+set_tests_properties([=[mdns_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;22;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[mdns.gtest]=] "/root/repo/_rel/fabric/tests/mdns.gtest")
+set_tests_properties([=[mdns.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;27;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dot_protocol.gtest]=] "/root/repo/_rel/fabric/tests/dot_protocol.gtest")
+set_tests_properties([=[dot_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;32;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dot.gtest]=] "/root/repo/_rel/fabric/tests/dot.gtest")
+set_tests_properties([=[dot.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;37;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[netlink_protocol.gtest]=] "/root/repo/_rel/fabric/tests/netlink_protocol.gtest")
+set_tests_properties([=[netlink_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;42;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[netlink_endpoint.gtest]=] "/root/repo/_rel/fabric/tests/netlink_endpoint.gtest")
+set_tests_properties([=[netlink_endpoint.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;47;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[netlink_socket.gtest]=] "/root/repo/_rel/fabric/tests/netlink_socket.gtest")
+set_tests_properties([=[netlink_socket.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;52;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[neighbor.gtest]=] "/root/repo/_rel/fabric/tests/neighbor.gtest")
+set_tests_properties([=[neighbor.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;57;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[neighbor_manager.gtest]=] "/root/repo/_rel/fabric/tests/neighbor_manager.gtest")
+set_tests_properties([=[neighbor_manager.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;62;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[arp.gtest]=] "/root/repo/_rel/fabric/tests/arp.gtest")
+set_tests_properties([=[arp.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;67;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[ping.gtest]=] "/root/repo/_rel/fabric/tests/ping.gtest")
+set_tests_properties([=[ping.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;72;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[interface.gtest]=] "/root/repo/_rel/fabric/tests/interface.gtest")
+set_tests_properties([=[interface.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;77;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[interface_manager.gtest]=] "/root/repo/_rel/fabric/tests/interface_manager.gtest")
+set_tests_properties([=[interface_manager.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;82;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[route.gtest]=] "/root/repo/_rel/fabric/tests/route.gtest")
+set_tests_properties([=[route.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;87;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[route_manager.gtest]=] "/root/repo/_rel/fabric/tests/route_manager.gtest")
+set_tests_properties([=[route_manager.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;92;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dhcp_option.gtest]=] "/root/repo/_rel/fabric/tests/dhcp_option.gtest")
+set_tests_properties([=[dhcp_option.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;97;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dhcp_protocol.gtest]=] "/root/repo/_rel/fabric/tests/dhcp_protocol.gtest")
+set_tests_properties([=[dhcp_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;102;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dhcp_message.gtest]=] "/root/repo/_rel/fabric/tests/dhcp_message.gtest")
+set_tests_properties([=[dhcp_message.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;107;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
+add_test([=[dhcp.gtest]=] "/root/repo/_rel/fabric/tests/dhcp.gtest")
+set_tests_properties([=[dhcp.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/fabric/tests/CMakeLists.txt;112;add_test;/root/repo/fabric/tests/CMakeLists.txt;0;")
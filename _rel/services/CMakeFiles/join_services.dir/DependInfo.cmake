@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/services/src/cache.cpp" "services/CMakeFiles/join_services.dir/src/cache.cpp.o" "gcc" "services/CMakeFiles/join_services.dir/src/cache.cpp.o.d"
+  "/root/repo/services/src/chunk_stream.cpp" "services/CMakeFiles/join_services.dir/src/chunk_stream.cpp.o" "gcc" "services/CMakeFiles/join_services.dir/src/chunk_stream.cpp.o.d"
+  "/root/repo/services/src/http_message.cpp" "services/CMakeFiles/join_services.dir/src/http_message.cpp.o" "gcc" "services/CMakeFiles/join_services.dir/src/http_message.cpp.o.d"
+  "/root/repo/services/src/http_parser.cpp" "services/CMakeFiles/join_services.dir/src/http_parser.cpp.o" "gcc" "services/CMakeFiles/join_services.dir/src/http_parser.cpp.o.d"
+  "/root/repo/services/src/smtp_message.cpp" "services/CMakeFiles/join_services.dir/src/smtp_message.cpp.o" "gcc" "services/CMakeFiles/join_services.dir/src/smtp_message.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_rel/services/libjoin_services.so" "/root/repo/_rel/services/libjoin_services.so.5.0.0"
+  "/root/repo/_rel/services/libjoin_services.so.5" "/root/repo/_rel/services/libjoin_services.so.5.0.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_rel/fabric/CMakeFiles/join_fabric.dir/DependInfo.cmake"
+  "/root/repo/_rel/data/CMakeFiles/join_data.dir/DependInfo.cmake"
+  "/root/repo/_rel/crypto/CMakeFiles/join_crypto.dir/DependInfo.cmake"
+  "/root/repo/_rel/core/CMakeFiles/join_core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
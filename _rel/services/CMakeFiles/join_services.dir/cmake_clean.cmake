@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/join_services.dir/src/cache.cpp.o"
+  "CMakeFiles/join_services.dir/src/cache.cpp.o.d"
+  "CMakeFiles/join_services.dir/src/chunk_stream.cpp.o"
+  "CMakeFiles/join_services.dir/src/chunk_stream.cpp.o.d"
+  "CMakeFiles/join_services.dir/src/http_message.cpp.o"
+  "CMakeFiles/join_services.dir/src/http_message.cpp.o.d"
+  "CMakeFiles/join_services.dir/src/http_parser.cpp.o"
+  "CMakeFiles/join_services.dir/src/http_parser.cpp.o.d"
+  "CMakeFiles/join_services.dir/src/smtp_message.cpp.o"
+  "CMakeFiles/join_services.dir/src/smtp_message.cpp.o.d"
+  "libjoin_services.pdb"
+  "libjoin_services.so"
+  "libjoin_services.so.5"
+  "libjoin_services.so.5.0.0"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/join_services.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
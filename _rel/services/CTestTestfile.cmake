@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/services
+# Build directory: /root/repo/_rel/services
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
+subdirs("samples")
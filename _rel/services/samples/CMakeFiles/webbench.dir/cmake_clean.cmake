@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/webbench.dir/webbench.cpp.o"
+  "CMakeFiles/webbench.dir/webbench.cpp.o.d"
+  "webbench"
+  "webbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/webbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cache.gtest.dir/cache_test.cpp.o"
+  "CMakeFiles/cache.gtest.dir/cache_test.cpp.o.d"
+  "cache.gtest"
+  "cache.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cache.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
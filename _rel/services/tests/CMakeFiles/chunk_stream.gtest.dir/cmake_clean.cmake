@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/chunk_stream.gtest.dir/chunk_stream_test.cpp.o"
+  "CMakeFiles/chunk_stream.gtest.dir/chunk_stream_test.cpp.o.d"
+  "chunk_stream.gtest"
+  "chunk_stream.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/chunk_stream.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http.gtest.dir/http_test.cpp.o"
+  "CMakeFiles/http.gtest.dir/http_test.cpp.o.d"
+  "http.gtest"
+  "http.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_client_pool.gtest.dir/http_client_pool_test.cpp.o"
+  "CMakeFiles/http_client_pool.gtest.dir/http_client_pool_test.cpp.o.d"
+  "http_client_pool.gtest"
+  "http_client_pool.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_client_pool.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
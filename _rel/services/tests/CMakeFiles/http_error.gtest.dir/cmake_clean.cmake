@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_error.gtest.dir/http_error_test.cpp.o"
+  "CMakeFiles/http_error.gtest.dir/http_error_test.cpp.o.d"
+  "http_error.gtest"
+  "http_error.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_error.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
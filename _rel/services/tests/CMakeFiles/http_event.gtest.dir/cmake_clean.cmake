@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_event.gtest.dir/http_event_test.cpp.o"
+  "CMakeFiles/http_event.gtest.dir/http_event_test.cpp.o.d"
+  "http_event.gtest"
+  "http_event.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_event.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
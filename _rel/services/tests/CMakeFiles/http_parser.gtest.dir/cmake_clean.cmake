@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_parser.gtest.dir/allocation_counter.cpp.o"
+  "CMakeFiles/http_parser.gtest.dir/allocation_counter.cpp.o.d"
+  "CMakeFiles/http_parser.gtest.dir/http_parser_test.cpp.o"
+  "CMakeFiles/http_parser.gtest.dir/http_parser_test.cpp.o.d"
+  "http_parser.gtest"
+  "http_parser.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_parser.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
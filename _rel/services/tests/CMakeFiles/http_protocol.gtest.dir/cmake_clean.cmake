@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_protocol.gtest.dir/http_protocol_test.cpp.o"
+  "CMakeFiles/http_protocol.gtest.dir/http_protocol_test.cpp.o.d"
+  "http_protocol.gtest"
+  "http_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_request.gtest.dir/http_request_test.cpp.o"
+  "CMakeFiles/http_request.gtest.dir/http_request_test.cpp.o.d"
+  "http_request.gtest"
+  "http_request.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_request.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
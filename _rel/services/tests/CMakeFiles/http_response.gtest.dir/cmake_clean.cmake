@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_response.gtest.dir/http_response_test.cpp.o"
+  "CMakeFiles/http_response.gtest.dir/http_response_test.cpp.o.d"
+  "http_response.gtest"
+  "http_response.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_response.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_router.gtest.dir/http_router_test.cpp.o"
+  "CMakeFiles/http_router.gtest.dir/http_router_test.cpp.o.d"
+  "http_router.gtest"
+  "http_router.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_router.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
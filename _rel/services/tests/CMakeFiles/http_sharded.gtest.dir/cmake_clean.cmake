@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_sharded.gtest.dir/http_sharded_test.cpp.o"
+  "CMakeFiles/http_sharded.gtest.dir/http_sharded_test.cpp.o.d"
+  "http_sharded.gtest"
+  "http_sharded.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/http_sharded.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/https.gtest.dir/https_test.cpp.o"
+  "CMakeFiles/https.gtest.dir/https_test.cpp.o.d"
+  "https.gtest"
+  "https.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/https.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtp.gtest.dir/smtp_test.cpp.o"
+  "CMakeFiles/smtp.gtest.dir/smtp_test.cpp.o.d"
+  "smtp.gtest"
+  "smtp.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtp.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
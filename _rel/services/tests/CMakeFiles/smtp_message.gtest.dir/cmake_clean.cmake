@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtp_message.gtest.dir/smtp_message_test.cpp.o"
+  "CMakeFiles/smtp_message.gtest.dir/smtp_message_test.cpp.o.d"
+  "smtp_message.gtest"
+  "smtp_message.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtp_message.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtp_protocol.gtest.dir/smtp_protocol_test.cpp.o"
+  "CMakeFiles/smtp_protocol.gtest.dir/smtp_protocol_test.cpp.o.d"
+  "smtp_protocol.gtest"
+  "smtp_protocol.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtp_protocol.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
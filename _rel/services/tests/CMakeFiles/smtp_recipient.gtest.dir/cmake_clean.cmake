@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtp_recipient.gtest.dir/smtp_recipient_test.cpp.o"
+  "CMakeFiles/smtp_recipient.gtest.dir/smtp_recipient_test.cpp.o.d"
+  "smtp_recipient.gtest"
+  "smtp_recipient.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtp_recipient.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtp_sender.gtest.dir/smtp_sender_test.cpp.o"
+  "CMakeFiles/smtp_sender.gtest.dir/smtp_sender_test.cpp.o.d"
+  "smtp_sender.gtest"
+  "smtp_sender.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtp_sender.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/smtps.gtest.dir/smtps_test.cpp.o"
+  "CMakeFiles/smtps.gtest.dir/smtps_test.cpp.o.d"
+  "smtps.gtest"
+  "smtps.gtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smtps.gtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
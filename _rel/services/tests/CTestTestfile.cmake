@@ -0,0 +1,44 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/services/tests
+# Build directory: /root/repo/_rel/services/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[cache.gtest]=] "/root/repo/_rel/services/tests/cache.gtest")
+set_tests_properties([=[cache.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;7;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[chunk_stream.gtest]=] "/root/repo/_rel/services/tests/chunk_stream.gtest")
+set_tests_properties([=[chunk_stream.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;12;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_protocol.gtest]=] "/root/repo/_rel/services/tests/http_protocol.gtest")
+set_tests_properties([=[http_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;17;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_error.gtest]=] "/root/repo/_rel/services/tests/http_error.gtest")
+set_tests_properties([=[http_error.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;22;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_request.gtest]=] "/root/repo/_rel/services/tests/http_request.gtest")
+set_tests_properties([=[http_request.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;27;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_response.gtest]=] "/root/repo/_rel/services/tests/http_response.gtest")
+set_tests_properties([=[http_response.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;32;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_client_pool.gtest]=] "/root/repo/_rel/services/tests/http_client_pool.gtest")
+set_tests_properties([=[http_client_pool.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;37;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_parser.gtest]=] "/root/repo/_rel/services/tests/http_parser.gtest")
+set_tests_properties([=[http_parser.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;42;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_router.gtest]=] "/root/repo/_rel/services/tests/http_router.gtest")
+set_tests_properties([=[http_router.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;47;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http.gtest]=] "/root/repo/_rel/services/tests/http.gtest")
+set_tests_properties([=[http.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;52;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_event.gtest]=] "/root/repo/_rel/services/tests/http_event.gtest")
+set_tests_properties([=[http_event.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;57;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[http_sharded.gtest]=] "/root/repo/_rel/services/tests/http_sharded.gtest")
+set_tests_properties([=[http_sharded.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;62;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[https.gtest]=] "/root/repo/_rel/services/tests/https.gtest")
+set_tests_properties([=[https.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;67;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[smtp_sender.gtest]=] "/root/repo/_rel/services/tests/smtp_sender.gtest")
+set_tests_properties([=[smtp_sender.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;72;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[smtp_protocol.gtest]=] "/root/repo/_rel/services/tests/smtp_protocol.gtest")
+set_tests_properties([=[smtp_protocol.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;77;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[smtp_recipient.gtest]=] "/root/repo/_rel/services/tests/smtp_recipient.gtest")
+set_tests_properties([=[smtp_recipient.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;82;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[smtp_message.gtest]=] "/root/repo/_rel/services/tests/smtp_message.gtest")
+set_tests_properties([=[smtp_message.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;87;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[smtp.gtest]=] "/root/repo/_rel/services/tests/smtp.gtest")
+set_tests_properties([=[smtp.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;92;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
+add_test([=[smtps.gtest]=] "/root/repo/_rel/services/tests/smtps.gtest")
+set_tests_properties([=[smtps.gtest]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/services/tests/CMakeLists.txt;97;add_test;/root/repo/services/tests/CMakeLists.txt;0;")
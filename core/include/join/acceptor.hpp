@@ -100,9 +100,10 @@ namespace join
         /**
          * @brief create acceptor
          * @param endpoint endpoint to assign to the acceptor.
+         * @param reusePort allow other acceptors to bind the same endpoint (SO_REUSEPORT).
          * @return 0 on success, -1 on failure.
          */
-        virtual int create (const Endpoint& endpoint) noexcept
+        virtual int create (const Endpoint& endpoint, bool reusePort = false) noexcept
         {
             if (this->opened ())
             {
@@ -145,6 +146,13 @@ namespace join
                     this->close ();
                     return -1;
                 }
+
+                if (reusePort && (::setsockopt (this->_handle, SOL_SOCKET, SO_REUSEPORT, &on, sizeof (on)) == -1))
+                {
+                    lastError = std::error_code (errno, std::generic_category ());
+                    this->close ();
+                    return -1;
+                }
             }
 
             if ((::bind (this->_handle, endpoint.addr (), endpoint.length ()) == -1) ||
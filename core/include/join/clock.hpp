@@ -37,9 +37,18 @@ namespace join
     template <class ClockPolicy>
     class BasicTimer;
 
+    template <class ClockPolicy>
+    class BasicTimerWheel;
+
+    template <class ClockPolicy>
+    class BasicWheelTimer;
+
     template <class ClockPolicy>
     class BasicStats;
 
+    template <class ClockPolicy>
+    class BasicTaskGraph;
+
     /**
      * @brief minimal clock type used as a type tag for time_point parameterization.
      */
@@ -85,7 +94,10 @@ namespace join
         using Duration = std::chrono::nanoseconds;
         using TimePoint = std::chrono::time_point<NanoClock>;
         using Timer = BasicTimer<Monotonic>;
+        using TimerWheel = BasicTimerWheel<Monotonic>;
+        using WheelTimer = BasicWheelTimer<Monotonic>;
         using Stats = BasicStats<Monotonic>;
+        using TaskGraph = BasicTaskGraph<Monotonic>;
 
         /**
          * @brief default constructor.
@@ -122,6 +134,7 @@ namespace join
         using Duration = std::chrono::nanoseconds;
         using TimePoint = std::chrono::time_point<NanoClock>;
         using Stats = BasicStats<MonotonicRaw>;
+        using TaskGraph = BasicTaskGraph<MonotonicRaw>;
 
         /**
          * @brief default constructor.
@@ -158,6 +171,7 @@ namespace join
         using Duration = std::chrono::nanoseconds;
         using TimePoint = std::chrono::time_point<NanoClock>;
         using Stats = BasicStats<Rdtsc>;
+        using TaskGraph = BasicTaskGraph<Rdtsc>;
 
         /**
          * @brief default constructor.
@@ -232,6 +246,32 @@ namespace join
             });
         }
     };
+
+    /**
+     * @brief dimensionless policy, used to collect statistics on counts (batch sizes, queue depths) with record().
+     * @note throughput() has no meaning for counts.
+     */
+    class Counter
+    {
+    public:
+        using Duration = std::chrono::duration<int64_t>;
+        using TimePoint = std::chrono::time_point<NanoClock, Duration>;
+        using Stats = BasicStats<Counter>;
+
+        /**
+         * @brief default constructor.
+         */
+        constexpr Counter () noexcept = default;
+
+        /**
+         * @brief counts have no time base.
+         * @return epoch.
+         */
+        static TimePoint now () noexcept
+        {
+            return TimePoint ();
+        }
+    };
 }
 
 #endif
@@ -25,8 +25,13 @@
 #ifndef JOIN_CORE_IO_OPERATION_HPP
 #define JOIN_CORE_IO_OPERATION_HPP
 
+// C++.
+#include <chrono>
+
 // C.
+#include <linux/time_types.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <cstdint>
 
 namespace join
@@ -54,16 +59,23 @@ namespace join
          */
         enum class Opcode : uint8_t
         {
-            Accept,     /**< accept an incoming connection. */
-            Connect,    /**< initiate an outgoing connection. */
-            Read,       /**< read from a file descriptor. */
-            Write,      /**< write to a file descriptor. */
-            ReadFixed,  /**< read using a registered buffer. */
-            WriteFixed, /**< write using a registered buffer. */
-            RecvMsg,    /**< receive a message with ancillary data. */
-            SendMsg,    /**< send a message with ancillary data. */
-            Recv,       /**< receive data from a socket. */
-            Send,       /**< send data on a socket. */
+            Accept,          /**< accept an incoming connection. */
+            Connect,         /**< initiate an outgoing connection. */
+            Read,            /**< read from a file descriptor. */
+            Write,           /**< write to a file descriptor. */
+            ReadFixed,       /**< read using a registered buffer. */
+            WriteFixed,      /**< write using a registered buffer. */
+            RecvMsg,         /**< receive a message with ancillary data. */
+            SendMsg,         /**< send a message with ancillary data. */
+            Recv,            /**< receive data from a socket. */
+            Send,            /**< send data on a socket. */
+            AcceptMultishot, /**< accept incoming connections until cancelled. */
+            RecvMultishot,   /**< receive data into provided buffers until cancelled. */
+            Readv,           /**< read from a file descriptor into several buffers. */
+            Writev,          /**< write to a file descriptor from several buffers. */
+            Timeout,         /**< complete after a delay. */
+            LinkTimeout,     /**< cancel the previous linked operation after a delay. */
+            SendZc,          /**< send data on a socket without copying it. */
         };
 
         /**
@@ -82,6 +94,12 @@ namespace join
 
             /// accept flags.
             int flags;
+
+            /// install the accepted socket in the registered file table.
+            bool direct;
+
+            /// registered file table slot (direct accept only).
+            uint32_t slot;
         };
 
         /**
@@ -96,6 +114,23 @@ namespace join
         static IoOperation makeAccept (int fd, sockaddr* addr, socklen_t* addrlen, int flags,
                                        CompletionHandler* handler) noexcept;
 
+        /// let the proactor pick a free slot of the registered file table.
+        static constexpr uint32_t allocSlot = UINT32_MAX;
+
+        /**
+         * @brief build an accept operation installing the accepted socket in the registered file table.
+         * the result is 0 when a slot is given, the slot picked otherwise, and no regular descriptor is created.
+         * @param fd listening socket file descriptor.
+         * @param addr peer address.
+         * @param addrlen peer address length.
+         * @param flags accept flags.
+         * @param slot registered file table slot, or allocSlot.
+         * @param handler handler to notify on completion.
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeAcceptDirect (int fd, sockaddr* addr, socklen_t* addrlen, int flags, uint32_t slot,
+                                             CompletionHandler* handler) noexcept;
+
         /**
          * @brief payload for connect.
          */
@@ -141,8 +176,14 @@ namespace join
 
             /// use registered buffer (ignored with reactor backend).
             bool fixed;
+
+            /// file offset, or noOffset for the current file position.
+            uint64_t offset;
         };
 
+        /// use the current file position.
+        static constexpr uint64_t noOffset = UINT64_MAX;
+
         /**
          * @brief build a regular read operation.
          * @param fd file descriptor to read from.
@@ -167,6 +208,32 @@ namespace join
         static IoOperation makeWrite (int fd, const void* buf, uint32_t len, CompletionHandler* handler,
                                       bool linked = false) noexcept;
 
+        /**
+         * @brief build a read operation at a given file offset.
+         * @param fd file descriptor to read from.
+         * @param buf destination buffer.
+         * @param len number of bytes to read.
+         * @param offset file offset.
+         * @param handler handler to notify on completion.
+         * @param linked link this SQE to the next one (io_uring only).
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeReadAt (int fd, void* buf, uint32_t len, uint64_t offset, CompletionHandler* handler,
+                                       bool linked = false) noexcept;
+
+        /**
+         * @brief build a write operation at a given file offset.
+         * @param fd file descriptor to write to.
+         * @param buf source buffer.
+         * @param len number of bytes to write.
+         * @param offset file offset.
+         * @param handler handler to notify on completion.
+         * @param linked link this SQE to the next one (io_uring only).
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeWriteAt (int fd, const void* buf, uint32_t len, uint64_t offset,
+                                        CompletionHandler* handler, bool linked = false) noexcept;
+
         /**
          * @brief build a fixed-buffer read operation.
          * @param fd file descriptor to read from.
@@ -276,6 +343,163 @@ namespace join
         static IoOperation makeSend (int fd, const void* buf, uint32_t len, int flags, CompletionHandler* handler,
                                      bool linked = false) noexcept;
 
+        /**
+         * @brief build a zero-copy send operation, the kernel referencing the buffer instead of copying it.
+         * onComplete reports the bytes sent while the operation is still in flight, onRelease then ends it once the
+         * buffer can be reused. a send failing before any byte was queued ends with onCancel / onComplete and
+         * onRelease right after.
+         * @param fd socket file descriptor.
+         * @param buf source buffer, left untouched until onRelease.
+         * @param len number of bytes to send.
+         * @param flags send flags.
+         * @param handler handler to notify on completion.
+         * @param linked link this SQE to the next one (io_uring only).
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeSendZc (int fd, const void* buf, uint32_t len, int flags, CompletionHandler* handler,
+                                       bool linked = false) noexcept;
+
+        /**
+         * @brief build a multishot accept operation, completing once per accepted connection.
+         * the operation stays armed while results are non-negative, the last completion carries a negative errno.
+         * @param fd listening socket file descriptor.
+         * @param addr peer address, overwritten by each completion.
+         * @param addrlen peer address length.
+         * @param flags accept flags.
+         * @param handler handler to notify on completion.
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeAcceptMultishot (int fd, sockaddr* addr, socklen_t* addrlen, int flags,
+                                                CompletionHandler* handler) noexcept;
+
+        /**
+         * @brief payload for buffer selecting recv.
+         */
+        struct SelectData
+        {
+            /// file descriptor.
+            int fd;
+
+            /// provided buffer group ID.
+            uint16_t group;
+
+            /// recv flags.
+            int flags;
+        };
+
+        /**
+         * @brief build a multishot receive operation, each completion picking a buffer of the given group.
+         * the operation stays armed while results are positive, the last completion carries 0 (EOF) or a negative errno
+         * (-ENOBUFS once the group is exhausted).
+         * @param fd socket file descriptor.
+         * @param group provided buffer group ID (see BasicProactor::registerBufferRing).
+         * @param flags recv flags.
+         * @param handler handler to notify on completion.
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeRecvMultishot (int fd, uint16_t group, int flags, CompletionHandler* handler) noexcept;
+
+        /**
+         * @brief payload for readv / writev.
+         */
+        struct VecData
+        {
+            /// file descriptor.
+            int fd;
+
+            /// buffers.
+            iovec* iov;
+
+            /// number of buffers.
+            int iovcnt;
+
+            /// file offset, or noOffset for the current file position.
+            uint64_t offset;
+        };
+
+        /**
+         * @brief build a vectored read operation.
+         * @param fd file descriptor to read from.
+         * @param iov destination buffers.
+         * @param iovcnt number of buffers.
+         * @param handler handler to notify on completion.
+         * @param linked link this SQE to the next one (io_uring only).
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeReadv (int fd, const iovec* iov, int iovcnt, CompletionHandler* handler,
+                                      bool linked = false) noexcept;
+
+        /**
+         * @brief build a vectored write operation.
+         * @param fd file descriptor to write to.
+         * @param iov source buffers.
+         * @param iovcnt number of buffers.
+         * @param handler handler to notify on completion.
+         * @param linked link this SQE to the next one (io_uring only).
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeWritev (int fd, const iovec* iov, int iovcnt, CompletionHandler* handler,
+                                       bool linked = false) noexcept;
+
+        /**
+         * @brief payload for timeout / link timeout.
+         */
+        struct TimeoutData
+        {
+            /// delay.
+            __kernel_timespec ts;
+
+            /// absolute deadline in nanoseconds (reactor backend only).
+            int64_t deadline;
+
+            /// operation cancelled on expiry (link timeout, reactor backend only).
+            IoOperation* target;
+        };
+
+        /**
+         * @brief build a timeout operation, completing with -ETIME once the delay elapsed.
+         * @param timeout delay.
+         * @param handler handler to notify on completion.
+         * @param linked link this SQE to the next one (io_uring only).
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeTimeout (std::chrono::nanoseconds timeout, CompletionHandler* handler,
+                                        bool linked = false) noexcept;
+
+        /**
+         * @brief build a timeout bounding the operation submitted just before with the link flag.
+         * if the delay elapses first, that operation is cancelled and this one completes with -ETIME,
+         * otherwise this one is cancelled.
+         * @param timeout delay.
+         * @param handler handler to notify on completion.
+         * @return initialized IoOperation.
+         */
+        static IoOperation makeLinkTimeout (std::chrono::nanoseconds timeout, CompletionHandler* handler) noexcept;
+
+        /**
+         * @brief check if the operation completes several times.
+         * @return true for multishot operations.
+         */
+        bool multishot () const noexcept;
+
+        /**
+         * @brief check if the operation completes once more when its buffer is released.
+         * @return true for zero-copy send operations.
+         */
+        bool zeroCopy () const noexcept;
+
+        /**
+         * @brief check if the operation is a timeout, not bound to a file descriptor.
+         * @return true for timeout operations.
+         */
+        bool timeout () const noexcept;
+
+        /**
+         * @brief check if the operation works at an explicit file offset.
+         * @return true for read / write operations with an offset.
+         */
+        bool positional () const noexcept;
+
         union Data
         {
             AcceptData accept;
@@ -283,6 +507,9 @@ namespace join
             RwData rw;
             MsgData msg;
             StreamData stream;
+            SelectData select;
+            VecData vec;
+            TimeoutData timeout;
         };
 
         /**
@@ -303,6 +530,12 @@ namespace join
         /// link this SQE to the next one (next executes only if this succeeds, io_uring only).
         bool linked = false;
 
+        /// provided buffer ID holding the data of the last completion (buffer selecting operations only).
+        uint16_t buffer = 0;
+
+        /// file descriptor is a slot of the registered file table (see BasicProactor::registerFiles).
+        bool fixedFile = false;
+
         /// handler to dispatch to on completion.
         CompletionHandler* handler = nullptr;
 
@@ -35,13 +35,24 @@
 #include <join/backoff.hpp>
 #include <join/thread.hpp>
 #include <join/queue.hpp>
+#include <join/cpu.hpp>
 
 // C++.
+#include <unordered_map>
+#include <algorithm>
+#include <stdexcept>
 #include <utility>
+#include <memory>
 #include <vector>
+#include <deque>
+#include <array>
+#include <set>
 
 // C.
+#include <linux/errqueue.h>
 #include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <netinet/in.h>
 #include <cerrno>
 
 namespace join
@@ -52,6 +63,8 @@ namespace join
     class BasicProactor;
     template <typename Policy>
     class BasicProactorThread;
+    template <typename Policy>
+    class BasicProactorGroup;
 
     using Proactor = BasicProactor<IoDefaultPolicy>;
     using HybridProactor = BasicProactor<IoHybridPolicy>;
@@ -59,12 +72,17 @@ namespace join
     using ProactorThread = BasicProactorThread<IoDefaultPolicy>;
     using HybridProactorThread = BasicProactorThread<IoHybridPolicy>;
     using SqpollProactorThread = BasicProactorThread<IoSqpollPolicy>;
+    using ProactorGroup = BasicProactorGroup<IoDefaultPolicy>;
+    using HybridProactorGroup = BasicProactorGroup<IoHybridPolicy>;
+    using SqpollProactorGroup = BasicProactorGroup<IoSqpollPolicy>;
 #else
     class BasicProactor;
     class BasicProactorThread;
+    class BasicProactorGroup;
 
     using Proactor = BasicProactor;
     using ProactorThread = BasicProactorThread;
+    using ProactorGroup = BasicProactorGroup;
 #endif
 }
 
@@ -138,6 +156,15 @@ protected:
     {
         // do nothing.
     }
+
+    /**
+     * @brief method called when the kernel no longer references the buffer of a zero-copy send.
+     * @param op released operation, idle again.
+     */
+    virtual void onRelease ([[maybe_unused]] IoOperation* op)
+    {
+        // do nothing.
+    }
 };
 
 /**
@@ -153,8 +180,9 @@ class join::BasicProactor : public join::EventHandler
 public:
     /**
      * @brief initialize the proactor and its I/O backend.
+     * @param shared proactor whose kernel async workers are shared (io_uring only, nullptr for a private pool).
      */
-    explicit BasicProactor ();
+    explicit BasicProactor (const BasicProactor* shared = nullptr);
 
     /**
      * @brief copy constructor.
@@ -193,6 +221,7 @@ public:
      * @param flush call io_uring_submit after pushing the SQE if true (io_uring only).
      * @param sync wait for submission acknowledgment if true (default: false).
      * @return 0 on success, -1 on failure.
+     * @note a linked operation is held back until the operation closing its chain is submitted (io_uring only).
      */
     int submit (IoOperation* op, bool flush = false, bool sync = false) noexcept;
 
@@ -205,6 +234,27 @@ public:
      */
     int cancel (IoOperation* op, bool flush = false, bool sync = false) noexcept;
 
+    /**
+     * @brief submit an operation to another proactor.
+     * @param op operation to submit.
+     * @param target proactor running the operation.
+     * @return 0 on success, -1 on failure (lastError set).
+     * @note from the proactor thread, io_uring passes the operation ring to ring (linux 5.18), the operation
+     * completes with the error if the message can't be delivered. other callers use the target command queue.
+     */
+    int forward (IoOperation* op, BasicProactor& target) noexcept;
+
+    /**
+     * @brief move the in-flight operations of a descriptor to another proactor.
+     * @param fd file descriptor.
+     * @param target proactor running the operations from now on.
+     * @param sync wait for migration acknowledgment if true (default: false).
+     * @return 0 on success, -1 on failure (lastError set).
+     * @note link timeouts are cancelled, operations using a registered file stay on this proactor, pending
+     * connections and zero-copy sends waiting for their buffer release can't be moved.
+     */
+    int migrate (int fd, BasicProactor& target, bool sync = false) noexcept;
+
 #ifdef JOIN_HAS_IO_URING
     /**
      * @brief flush pending submissions to the kernel.
@@ -240,6 +290,65 @@ public:
     int unregisterBuffers () noexcept;
 #endif
 
+    /**
+     * @brief register a table of files, addressed by slot by operations flagged with IoOperation::fixedFile.
+     * @param fds file descriptors, -1 for an empty slot.
+     * @return 0 on success, -1 on failure.
+     * @note with the reactor backend the table is read by the proactor thread, update it before run() or from a
+     * completion handler.
+     */
+    int registerFiles (const std::vector<int>& fds) noexcept;
+
+    /**
+     * @brief replace a range of slots of the registered file table.
+     * @param offset first slot to replace.
+     * @param fds file descriptors, -1 to empty a slot.
+     * @return 0 on success, -1 on failure.
+     * @note a socket installed by a direct accept is closed when its slot is replaced.
+     */
+    int updateFiles (uint32_t offset, const std::vector<int>& fds) noexcept;
+
+    /**
+     * @brief unregister the registered file table.
+     * @return 0 on success, -1 on failure.
+     */
+    int unregisterFiles () noexcept;
+
+    /**
+     * @brief register a ring of provided buffers picked by buffer selecting operations.
+     * @param group buffer group ID.
+     * @param count number of buffers (power of two, at most 32768).
+     * @param size size of each buffer in bytes.
+     * @return 0 on success, -1 on failure.
+     * @note the group must be registered before submitting operations using it.
+     */
+    int registerBufferRing (uint16_t group, uint32_t count, uint32_t size) noexcept;
+
+    /**
+     * @brief unregister a ring of provided buffers.
+     * @param group buffer group ID.
+     * @return 0 on success, -1 on failure.
+     * @note operations using the group must have completed.
+     */
+    int unregisterBufferRing (uint16_t group) noexcept;
+
+    /**
+     * @brief get the address of a provided buffer.
+     * @param group buffer group ID.
+     * @param id buffer ID, as set in IoOperation::buffer by a completion.
+     * @return buffer address, nullptr if unknown.
+     */
+    void* buffer (uint16_t group, uint16_t id) const noexcept;
+
+    /**
+     * @brief give a provided buffer back to its ring once its data have been consumed.
+     * @param group buffer group ID.
+     * @param id buffer ID.
+     * @param sync wait for release acknowledgment if true (default: false).
+     * @return 0 on success, -1 on failure.
+     */
+    int releaseBuffer (uint16_t group, uint16_t id, bool sync = false) noexcept;
+
 #ifdef JOIN_HAS_NUMA
     /**
      * @brief bind proactor command queue memory to a NUMA node.
@@ -333,9 +442,11 @@ private:
      */
     enum class CommandType
     {
-        Submit, /**< submit an operation. */
-        Cancel, /**< cancel an in-flight operation. */
-        Stop,   /**< stop the event loop. */
+        Submit,  /**< submit an operation. */
+        Cancel,  /**< cancel an in-flight operation. */
+        Stop,    /**< stop the event loop. */
+        Release, /**< give a provided buffer back to its ring. */
+        Migrate, /**< move the operations of a descriptor to another proactor. */
 #ifdef JOIN_HAS_IO_URING
         Flush, /**< flush pending submissions to the kernel. */
 #endif
@@ -346,11 +457,53 @@ private:
      */
     struct alignas (64) Command
     {
-        CommandType type;        /**< command type. */
-        IoOperation* op;         /**< target operation, or nullptr for Stop/Flush. */
-        bool flush;              /**< if true, call io_uring_submit after processing (io_uring only). */
-        std::atomic<bool>* done; /**< set to true when the command is processed. */
-        std::error_code* errc;   /**< filled with the error code on failure. */
+        CommandType type;                /**< command type. */
+        IoOperation* op;                 /**< target operation, or nullptr for Stop/Flush. */
+        bool flush;                      /**< if true, call io_uring_submit after processing (io_uring only). */
+        std::atomic<bool>* done;         /**< set to true when the command is processed. */
+        std::error_code* errc;           /**< filled with the error code on failure. */
+        uint32_t buffer = 0;             /**< buffer group and ID to release (Release only). */
+        int fd = -1;                     /**< descriptor whose operations are moved (Migrate only). */
+        BasicProactor* target = nullptr; /**< proactor receiving the operations (Migrate only). */
+    };
+
+    /**
+     * @brief ring of provided buffers.
+     */
+    struct BufferGroup
+    {
+        /**
+         * @brief allocate the buffers.
+         * @param count number of buffers.
+         * @param size size of each buffer in bytes.
+         */
+        BufferGroup (uint32_t count, uint32_t size)
+        : memory (uint64_t (count) * size)
+        , base (static_cast<char*> (memory.get ()))
+        , count (count)
+        , size (size)
+        {
+        }
+
+        /// buffers memory.
+        LocalMem memory;
+
+        /// first buffer address.
+        char* base;
+
+        /// number of buffers.
+        uint32_t count;
+
+        /// size of each buffer in bytes.
+        uint32_t size;
+
+#ifdef JOIN_HAS_IO_URING
+        /// ring shared with the kernel.
+        io_uring_buf_ring* ring = nullptr;
+#else
+        /// IDs of the buffers available for the next receive.
+        std::vector<uint16_t> free;
+#endif
     };
 
     /**
@@ -408,6 +561,14 @@ private:
      */
     void cancelAllOperations () noexcept;
 
+    /**
+     * @brief move the in-flight operations of a descriptor to another proactor directly in the backend.
+     * @param fd file descriptor.
+     * @param target proactor running the operations from now on.
+     * @return 0 on success, -1 on failure.
+     */
+    int migrateOperations (int fd, BasicProactor* target) noexcept;
+
     /**
      * @brief dispatch completion callback and reset operation state.
      * @param op operation to dispatch, may be nullptr.
@@ -416,6 +577,27 @@ private:
      */
     void dispatchOperation (IoOperation* op, int result, bool cancelled) noexcept;
 
+    /**
+     * @brief dispatch an intermediate completion of a multishot operation, which stays in flight.
+     * @param op operation to dispatch.
+     * @param result operation-specific result.
+     */
+    void dispatchMore (IoOperation* op, int result) noexcept;
+
+    /**
+     * @brief reset operation state and dispatch the buffer release ending a zero-copy send.
+     * @param op operation to dispatch.
+     */
+    void dispatchRelease (IoOperation* op) noexcept;
+
+    /**
+     * @brief give a provided buffer back to its ring directly in the backend.
+     * @param group buffer group ID.
+     * @param id buffer ID.
+     * @return 0 on success, -1 on failure.
+     */
+    int recycleBuffer (uint16_t group, uint16_t id) noexcept;
+
     /**
      * @brief end an operation, dispatching onCancel or onComplete.
      * @param op operation to end, may be nullptr.
@@ -449,6 +631,25 @@ private:
      */
     void dispatchCqe (io_uring_cqe* cqe) noexcept;
 
+    /**
+     * @brief remove an operation from the in-flight operations.
+     * @param op operation to remove.
+     */
+    void removePending (IoOperation* op) noexcept;
+
+    /**
+     * @brief dispatch the completion of a user operation, ending it unless more completions follow.
+     * @param op operation the completion belongs to.
+     * @param cqe completion queue entry.
+     */
+    void completeOperation (IoOperation* op, io_uring_cqe* cqe) noexcept;
+
+    /**
+     * @brief dispatch a completion carrying an operation passed by another ring.
+     * @param cqe completion queue entry.
+     */
+    void dispatchForward (io_uring_cqe* cqe) noexcept;
+
     /**
      * @brief dispatch a completion queue entry to the appropriate handler.
      * @param cqe completion queue entry.
@@ -484,16 +685,123 @@ private:
     /**
      * @brief return true if opcode requires EPOLLOUT.
      * @param code raw opcode value.
-     * @return true for Connect, Write, WriteFixed, SendMsg, Send.
+     * @return true for Connect, Write, WriteFixed, Writev, SendMsg, Send, SendZc.
      */
     static bool isWriteOp (uint8_t code) noexcept;
 
+    /**
+     * @brief get the file descriptor an operation works on, translating registered file table slots.
+     * @param op operation.
+     * @return file descriptor, -1 if unknown.
+     */
+    int resolveFd (const IoOperation* op) const noexcept;
+
+    /**
+     * @brief install an accepted socket in the registered file table.
+     * @param slot registered file table slot, or IoOperation::allocSlot.
+     * @param fd accepted socket, closed on failure.
+     * @return 0 or the slot picked on success, -errno on failure.
+     */
+    int installFile (uint32_t slot, int fd) noexcept;
+
+    /**
+     * @brief empty a slot of the registered file table, closing the socket installed by a direct accept.
+     * @param slot registered file table slot.
+     */
+    void releaseFile (uint32_t slot) noexcept;
+
     /**
      * @brief execute the syscall described by op.
      * @param op operation to execute.
+     * @param fd file descriptor the operation works on.
      * @return bytes transferred (>= 0) or -errno (< 0).
      */
-    static int executeOp (IoOperation* op) noexcept;
+    int executeOp (IoOperation* op, int fd) noexcept;
+
+    /**
+     * @brief execute one round of a multishot operation, which stays armed unless it failed.
+     * @param op operation to execute.
+     * @param fd file descriptor the operation works on.
+     */
+    void executeMultishot (IoOperation* op, int fd) noexcept;
+
+    /**
+     * @brief execute the operations at an explicit file offset, regular files being always ready.
+     */
+    void executeReadyOps () noexcept;
+
+    /**
+     * @brief dispatch the completion of an operation and cancel the timeout linked to it.
+     * @param op operation to dispatch, may be nullptr.
+     * @param result negative errno or bytes-transferred result.
+     * @param cancelled if true, dispatch to onCancel; otherwise to onComplete.
+     */
+    void finishOperation (IoOperation* op, int result, bool cancelled) noexcept;
+
+    /**
+     * @brief detach an ending operation from the link chain.
+     * @param op ending operation, may be nullptr.
+     * @return the link timeout bounding the operation, removed from the pending timeouts, or nullptr.
+     */
+    IoOperation* unlinkOperation (IoOperation* op) noexcept;
+
+    /**
+     * @brief subscribe the reactor to the events of the operations pending on a descriptor, or unsubscribe it.
+     * @param fd file descriptor.
+     * @return 0 on success, -1 on failure.
+     */
+    int updateHandler (int fd) noexcept;
+
+    /**
+     * @brief execute a zero-copy send, keeping it in flight until the kernel releases its buffer.
+     * @param op operation to execute.
+     * @param fd file descriptor the operation works on.
+     */
+    void executeZeroCopy (IoOperation* op, int fd) noexcept;
+
+    /**
+     * @brief read the zero-copy notifications of the socket error queue, releasing the sends they cover.
+     * @param fd file descriptor.
+     * @return true if at least one notification was read.
+     */
+    bool readNotifications (int fd) noexcept;
+
+    /**
+     * @brief release the zero-copy sends still waiting for a notification on a descriptor.
+     * @param fd file descriptor.
+     */
+    void releaseZeroCopy (int fd) noexcept;
+
+    /**
+     * @brief arm a timeout operation.
+     * @param op timeout operation.
+     * @return 0 on success, -1 on failure.
+     */
+    int submitTimeout (IoOperation* op) noexcept;
+
+    /**
+     * @brief cancel a pending timeout operation.
+     * @param op timeout operation.
+     * @return 0 on success, -1 on failure.
+     */
+    int cancelTimeout (IoOperation* op) noexcept;
+
+    /**
+     * @brief remove a timeout operation from the pending timeouts.
+     * @param op timeout operation.
+     * @return true if it was pending.
+     */
+    bool removeTimeout (IoOperation* op) noexcept;
+
+    /**
+     * @brief complete the timeout operations whose deadline passed.
+     */
+    void expireTimeouts () noexcept;
+
+    /**
+     * @brief arm the timer descriptor for the earliest deadline.
+     */
+    void rearmTimer () noexcept;
 
     /**
      * @brief method called when data are ready to be read on handle.
@@ -523,6 +831,12 @@ private:
     /// command queue size.
     static constexpr size_t _queueSize = 1024;
 
+    /// max number of provided buffer groups.
+    static constexpr size_t _maxBufferGroups = 64;
+
+    /// max number of buffers in a provided buffer group.
+    static constexpr uint32_t _maxBuffers = 32768;
+
     /// coalesce eventfd writes.
     alignas (64) std::atomic<bool> _notified{false};
 
@@ -535,6 +849,9 @@ private:
     /// eventfd descriptor.
     int _wakeup = -1;
 
+    /// provided buffer groups indexed by group ID.
+    std::array<std::unique_ptr<BufferGroup>, _maxBufferGroups> _bufferGroups;
+
 #ifdef JOIN_HAS_IO_URING
     /// buffer for the wakeup eventfd read.
     uint64_t _wakeupBuf = 0;
@@ -548,6 +865,18 @@ private:
     /// in-flight operations.
     std::vector<IoOperation*> _pendingOps;
 
+    /// operations being cancelled to move them to another proactor.
+    std::unordered_map<IoOperation*, BasicProactor*> _migrations;
+
+    /// linked operations held back until the operation closing their chain is submitted.
+    std::vector<IoOperation*> _chain;
+
+    /// user data tag of an operation passed by another ring.
+    static constexpr uintptr_t _forwardTag = 1;
+
+    /// user data tag of an operation that couldn't be passed to another ring.
+    static constexpr uintptr_t _failureTag = 2;
+
     /// invalid thread id sentinel.
     static constexpr pthread_t _invalidThreadId = static_cast<pthread_t> (-1);
 
@@ -563,6 +892,30 @@ private:
     /// pending write operations.
     std::vector<IoOperation*> _writeOps;
 
+    /// registered file table.
+    std::vector<int> _files;
+
+    /// registered file table slots filled by a direct accept.
+    std::vector<bool> _ownedFiles;
+
+    /// operations at an explicit file offset waiting to be executed.
+    std::deque<IoOperation*> _readyOps;
+
+    /// timer descriptor expiring the timeout operations.
+    int _timer = -1;
+
+    /// pending timeout operations ordered by deadline.
+    std::set<std::pair<int64_t, IoOperation*>> _timeouts;
+
+    /// link timeouts indexed by the operation they bound.
+    std::unordered_map<IoOperation*, IoOperation*> _linkTimeouts;
+
+    /// last operation submitted with the link flag.
+    IoOperation* _lastLinked = nullptr;
+
+    /// zero-copy sends waiting for their buffer release, in send order, indexed by descriptor.
+    std::unordered_map<int, std::deque<IoOperation*>> _zeroCopyOps;
+
     /// reactor instance.
     Reactor _reactor;
 #endif
@@ -664,6 +1017,54 @@ inline int join::BasicProactor::cancel (IoOperation* op, bool flush, bool sync)
     return 0;
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : migrate
+// =========================================================================
+#ifdef JOIN_HAS_IO_URING
+template <typename Policy>
+int join::BasicProactor<Policy>::migrate (int fd, BasicProactor& target, bool sync) noexcept
+#else
+inline int join::BasicProactor::migrate (int fd, BasicProactor& target, bool sync) noexcept
+#endif
+{
+    if (isProactorThread ())
+    {
+        return migrateOperations (fd, &target);
+    }
+
+    std::atomic<bool> done{false}, *pdone = nullptr;
+    std::error_code errc, *perrc = nullptr;
+
+    if (JOIN_UNLIKELY (sync))
+    {
+        pdone = &done;
+        perrc = &errc;
+    }
+
+    if (JOIN_UNLIKELY (writeCommand ({CommandType::Migrate, nullptr, false, pdone, perrc, 0, fd, &target}) == -1))
+    {
+        return -1;  // LCOV_EXCL_LINE
+    }
+
+    if (JOIN_UNLIKELY (sync))
+    {
+        Backoff backoff;
+        while (!done.load (std::memory_order_acquire))
+        {
+            backoff ();
+        }
+
+        if (JOIN_UNLIKELY (errc))
+        {
+            lastError = errc;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 // =========================================================================
 //   CLASS     : BasicProactor
 //   METHOD    : dispatchOperation
@@ -680,6 +1081,9 @@ inline void join::BasicProactor::dispatchOperation (IoOperation* op, int result,
         return;  // LCOV_EXCL_LINE
     }
 
+    // the handler may release the operation storage.
+    bool zeroCopy = op->zeroCopy ();
+
     if (JOIN_LIKELY (op->handler))
     {
         if (cancelled)
@@ -692,9 +1096,121 @@ inline void join::BasicProactor::dispatchOperation (IoOperation* op, int result,
         }
     }
 
+    if (JOIN_UNLIKELY (zeroCopy))
+    {
+        // nothing was queued, the buffer is already free.
+        dispatchRelease (op);
+        return;
+    }
+
     op->state = IoOperation::State::Idle;
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : dispatchMore
+// =========================================================================
+#ifdef JOIN_HAS_IO_URING
+template <typename Policy>
+void join::BasicProactor<Policy>::dispatchMore (IoOperation* op, int result) noexcept
+#else
+inline void join::BasicProactor::dispatchMore (IoOperation* op, int result) noexcept
+#endif
+{
+    if (JOIN_LIKELY (op->handler))
+    {
+        op->handler->onComplete (op, result);
+    }
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : dispatchRelease
+// =========================================================================
+#ifdef JOIN_HAS_IO_URING
+template <typename Policy>
+void join::BasicProactor<Policy>::dispatchRelease (IoOperation* op) noexcept
+#else
+inline void join::BasicProactor::dispatchRelease (IoOperation* op) noexcept
+#endif
+{
+    // the backend no longer references the operation, the handler may submit it again.
+    op->state = IoOperation::State::Idle;
+
+    if (JOIN_LIKELY (op->handler))
+    {
+        op->handler->onRelease (op);
+    }
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : buffer
+// =========================================================================
+#ifdef JOIN_HAS_IO_URING
+template <typename Policy>
+void* join::BasicProactor<Policy>::buffer (uint16_t group, uint16_t id) const noexcept
+#else
+inline void* join::BasicProactor::buffer (uint16_t group, uint16_t id) const noexcept
+#endif
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || !_bufferGroups[group] || (id >= _bufferGroups[group]->count)))
+    {
+        return nullptr;
+    }
+
+    return _bufferGroups[group]->base + (uint64_t (id) * _bufferGroups[group]->size);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : releaseBuffer
+// =========================================================================
+#ifdef JOIN_HAS_IO_URING
+template <typename Policy>
+int join::BasicProactor<Policy>::releaseBuffer (uint16_t group, uint16_t id, bool sync) noexcept
+#else
+inline int join::BasicProactor::releaseBuffer (uint16_t group, uint16_t id, bool sync) noexcept
+#endif
+{
+    if (isProactorThread ())
+    {
+        return recycleBuffer (group, id);
+    }
+
+    std::atomic<bool> done{false}, *pdone = nullptr;
+    std::error_code errc, *perrc = nullptr;
+
+    if (JOIN_UNLIKELY (sync))
+    {
+        pdone = &done;
+        perrc = &errc;
+    }
+
+    if (JOIN_UNLIKELY (writeCommand ({CommandType::Release, nullptr, false, pdone, perrc,
+                                      (uint32_t (group) << 16) | id}) == -1))
+    {
+        return -1;  // LCOV_EXCL_LINE
+    }
+
+    if (JOIN_UNLIKELY (sync))
+    {
+        Backoff backoff;
+        while (!done.load (std::memory_order_acquire))
+        {
+            backoff ();
+        }
+
+        if (JOIN_UNLIKELY (errc))
+        {
+            lastError = errc;
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
 #ifdef JOIN_HAS_IO_URING
 #include "proactor_uring_impl.hpp"
 #else
@@ -861,4 +1377,262 @@ private:
     Thread _dispatcher;
 };
 
+/**
+ * @brief group of proactors each running on its own thread pinned to a different core.
+ */
+#ifdef JOIN_HAS_IO_URING
+template <typename Policy = join::IoDefaultPolicy>
+class join::BasicProactorGroup
+#else
+class join::BasicProactorGroup
+#endif
+{
+public:
+    /**
+     * @brief create the proactor group and start the event loop threads.
+     * @param proactors number of proactors (default: one per physical core).
+     * @note the rings share the async workers of the first one (io_uring only).
+     */
+    explicit BasicProactorGroup (int proactors = int (CpuTopology::instance ()->cores ().size ()))
+    {
+        if (proactors <= 0)
+        {
+            throw std::invalid_argument ("invalid number of proactors");
+        }
+
+        const auto& cores = CpuTopology::instance ()->cores ();
+
+        for (int i = 0; i < proactors; ++i)
+        {
+            auto shared = _shards.empty () ? nullptr : &_shards.front ().proactor;
+
+            if (cores.empty ())
+            {
+                _shards.emplace_back (-1, -1, shared);  // LCOV_EXCL_LINE
+            }
+            else
+            {
+                const auto& core = cores[i % cores.size ()];
+                _shards.emplace_back (core.primaryThread (), core.numa, shared);
+            }
+        }
+    }
+
+    /**
+     * @brief copy constructor.
+     * @param other other object to copy.
+     */
+    BasicProactorGroup (const BasicProactorGroup& other) = delete;
+
+    /**
+     * @brief copy assignment operator.
+     * @param other other object to copy.
+     * @return current object.
+     */
+    BasicProactorGroup& operator= (const BasicProactorGroup& other) = delete;
+
+    /**
+     * @brief move constructor.
+     * @param other other object to move.
+     */
+    BasicProactorGroup (BasicProactorGroup&& other) = delete;
+
+    /**
+     * @brief move assignment operator.
+     * @param other other object to move.
+     * @return current object.
+     */
+    BasicProactorGroup& operator= (BasicProactorGroup&& other) = delete;
+
+    /**
+     * @brief stop the event loops and join the threads.
+     */
+    ~BasicProactorGroup ()
+    {
+        _shards.clear ();
+    }
+
+    /**
+     * @brief get the number of proactors.
+     * @return number of proactors.
+     */
+    size_t size () const noexcept
+    {
+        return _shards.size ();
+    }
+
+    /**
+     * @brief get proactor.
+     * @param index proactor index.
+     * @return proactor.
+     */
+#ifdef JOIN_HAS_IO_URING
+    BasicProactor<Policy>& proactor (size_t index)
+#else
+    BasicProactor& proactor (size_t index)
+#endif
+    {
+        return _shards.at (index).proactor;
+    }
+
+    /**
+     * @brief get the core a proactor thread is pinned to.
+     * @param index proactor index.
+     * @return core or -1 if not pinned.
+     */
+    int affinity (size_t index) const
+    {
+        return _shards.at (index).core;
+    }
+
+    /**
+     * @brief get the index of the proactor running the calling thread.
+     * @return proactor index, -1 if not called from a proactor thread of the group.
+     */
+    int current () const noexcept
+    {
+        for (size_t i = 0; i < _shards.size (); ++i)
+        {
+            if (_shards[i].proactor.isProactorThread ())
+            {
+                return int (i);
+            }
+        }
+
+        return -1;
+    }
+
+    /**
+     * @brief get the next proactor in turn.
+     * @return proactor index.
+     */
+    size_t next () noexcept
+    {
+        return _next.fetch_add (1, std::memory_order_relaxed) % _shards.size ();
+    }
+
+    /**
+     * @brief submit an operation to the given proactor.
+     * @param index proactor index.
+     * @param op operation to submit.
+     * @return 0 on success, -1 on failure (lastError set).
+     * @note from a proactor thread of the group, the operation is passed ring to ring (io_uring only).
+     */
+    int submit (size_t index, IoOperation* op) noexcept
+    {
+        if (JOIN_UNLIKELY (index >= _shards.size ()))
+        {
+            lastError = make_error_code (Errc::InvalidParam);
+            return -1;
+        }
+
+        int from = current ();
+        if (from != -1)
+        {
+            return _shards[from].proactor.forward (op, _shards[index].proactor);
+        }
+
+        return _shards[index].proactor.submit (op, true);
+    }
+
+    /**
+     * @brief move the in-flight operations of a descriptor to another proactor.
+     * @param fd file descriptor.
+     * @param from index of the proactor running the operations.
+     * @param to index of the proactor running the operations from now on.
+     * @param sync wait for migration acknowledgment if true (default: false).
+     * @return 0 on success, -1 on failure (lastError set).
+     */
+    int migrate (int fd, size_t from, size_t to, bool sync = false) noexcept
+    {
+        if (JOIN_UNLIKELY ((from >= _shards.size ()) || (to >= _shards.size ())))
+        {
+            lastError = make_error_code (Errc::InvalidParam);
+            return -1;
+        }
+
+        return _shards[from].proactor.migrate (fd, _shards[to].proactor, sync);
+    }
+
+    /**
+     * @brief lock command queues memory in RAM.
+     * @return 0 on success, -1 on failure.
+     */
+    int mlock () noexcept
+    {
+        for (auto& shard : _shards)
+        {
+            if (shard.proactor.mlock () == -1)
+            {
+                return -1;  // LCOV_EXCL_LINE
+            }
+        }
+
+        return 0;
+    }
+
+private:
+    /**
+     * @brief proactor running on its own thread.
+     */
+    struct Shard
+    {
+        /**
+         * @brief create the proactor and start its event loop.
+         * @param core core to pin the thread to (-1 no pinning).
+         * @param numa NUMA node of the core (-1 unknown).
+         * @param shared proactor whose kernel async workers are shared (nullptr for a private pool).
+         */
+#ifdef JOIN_HAS_IO_URING
+        Shard (int core, int numa, const BasicProactor<Policy>* shared)
+#else
+        Shard (int core, int numa, const BasicProactor* shared)
+#endif
+        : proactor (shared)
+        , thread (core, 0, [this] () {
+            proactor.run ();
+        })
+        , core (core)
+        {
+#ifdef JOIN_HAS_NUMA
+            if (numa >= 0)
+            {
+                proactor.mbind (numa);
+            }
+#else
+            static_cast<void> (numa);
+#endif
+        }
+
+        /**
+         * @brief stop the event loop and join the thread.
+         */
+        ~Shard ()
+        {
+            proactor.stop ();
+            thread.join ();
+        }
+
+#ifdef JOIN_HAS_IO_URING
+        /// proactor.
+        BasicProactor<Policy> proactor;
+#else
+        /// proactor.
+        BasicProactor proactor;
+#endif
+
+        /// event loop thread.
+        Thread thread;
+
+        /// pinned core.
+        int core;
+    };
+
+    /// proactors.
+    std::deque<Shard> _shards;
+
+    /// next proactor for round robin placement.
+    std::atomic<size_t> _next{0};
+};
+
 #endif
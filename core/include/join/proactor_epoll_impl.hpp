@@ -26,18 +26,29 @@
 //   CLASS     : BasicProactor
 //   METHOD    : BasicProactor
 // =========================================================================
-inline join::BasicProactor::BasicProactor ()
+inline join::BasicProactor::BasicProactor ([[maybe_unused]] const BasicProactor* shared)
 : _commands (_queueSize)
 , _wakeup (eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC))
 , _readOps (256, nullptr)
 , _writeOps (256, nullptr)
+, _timer (timerfd_create (CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
 {
     if (_wakeup == -1)
     {
         throw std::system_error (errno, std::system_category (), "eventfd failed");  // LCOV_EXCL_LINE
     }
 
+    if (_timer == -1)
+    {
+        // LCOV_EXCL_START
+        int err = errno;
+        ::close (_wakeup);
+        throw std::system_error (err, std::system_category (), "timerfd_create failed");
+        // LCOV_EXCL_STOP
+    }
+
     _reactor.addHandler (_wakeup, this, true, false, false);
+    _reactor.addHandler (_timer, this, true, false, false);
 }
 
 // =========================================================================
@@ -48,6 +59,12 @@ inline join::BasicProactor::~BasicProactor () noexcept
 {
     stop (true);
 
+    for (uint32_t slot = 0; slot < _files.size (); ++slot)
+    {
+        releaseFile (slot);
+    }
+
+    ::close (_timer);
     ::close (_wakeup);
 }
 
@@ -109,6 +126,153 @@ inline void join::BasicProactor::stop (bool sync) noexcept
     _reactor.stop (sync);
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : forward
+// =========================================================================
+inline int join::BasicProactor::forward (IoOperation* op, BasicProactor& target) noexcept
+{
+    // no ring to ring messages, the target command queue is the only way in.
+    return target.submit (op, true);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : registerFiles
+// =========================================================================
+inline int join::BasicProactor::registerFiles (const std::vector<int>& fds) noexcept
+{
+    if (JOIN_UNLIKELY (fds.empty ()))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (JOIN_UNLIKELY (!_files.empty ()))
+    {
+        lastError = make_error_code (Errc::InUse);
+        return -1;
+    }
+
+    try
+    {
+        _files = fds;
+        _ownedFiles.assign (fds.size (), false);
+    }
+    catch (const std::bad_alloc&)
+    {
+        _files.clear ();
+        lastError = std::make_error_code (std::errc::not_enough_memory);
+        return -1;
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : updateFiles
+// =========================================================================
+inline int join::BasicProactor::updateFiles (uint32_t offset, const std::vector<int>& fds) noexcept
+{
+    if (JOIN_UNLIKELY ((offset > _files.size ()) || (fds.size () > (_files.size () - offset))))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < fds.size (); ++i)
+    {
+        releaseFile (offset + i);
+        _files[offset + i] = fds[i];
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : unregisterFiles
+// =========================================================================
+inline int join::BasicProactor::unregisterFiles () noexcept
+{
+    if (JOIN_UNLIKELY (_files.empty ()))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    for (uint32_t slot = 0; slot < _files.size (); ++slot)
+    {
+        releaseFile (slot);
+    }
+
+    _files.clear ();
+    _ownedFiles.clear ();
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : registerBufferRing
+// =========================================================================
+inline int join::BasicProactor::registerBufferRing (uint16_t group, uint32_t count, uint32_t size) noexcept
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || (count == 0) || (count > _maxBuffers) ||
+                       ((count & (count - 1)) != 0) || (size == 0)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (JOIN_UNLIKELY (_bufferGroups[group] != nullptr))
+    {
+        lastError = make_error_code (Errc::InUse);
+        return -1;
+    }
+
+    std::unique_ptr<BufferGroup> bufferGroup;
+
+    try
+    {
+        bufferGroup.reset (new BufferGroup (count, size));
+        bufferGroup->free.reserve (count);
+    }
+    catch (const std::system_error& e)
+    {
+        lastError = e.code ();
+        return -1;
+    }
+
+    // hand out the lowest IDs first.
+    for (uint32_t id = count; id > 0; --id)
+    {
+        bufferGroup->free.push_back (uint16_t (id - 1));
+    }
+
+    _bufferGroups[group] = std::move (bufferGroup);
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : unregisterBufferRing
+// =========================================================================
+inline int join::BasicProactor::unregisterBufferRing (uint16_t group) noexcept
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || (_bufferGroups[group] == nullptr)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    _bufferGroups[group].reset ();
+
+    return 0;
+}
+
 #ifdef JOIN_HAS_NUMA
 // =========================================================================
 //   CLASS     : BasicProactor
@@ -206,6 +370,8 @@ inline void join::BasicProactor::readCommands () noexcept
     {
         processCommand (cmd);
     }
+
+    executeReadyOps ();
 }
 
 // =========================================================================
@@ -230,6 +396,14 @@ inline void join::BasicProactor::processCommand (const Command& cmd) noexcept
             cancelAllOperations ();
             break;
 
+        case CommandType::Release:
+            err = recycleBuffer (uint16_t (cmd.buffer >> 16), uint16_t (cmd.buffer));
+            break;
+
+        case CommandType::Migrate:
+            err = migrateOperations (cmd.fd, cmd.target);
+            break;
+
         default:
             break;
     }
@@ -256,7 +430,9 @@ inline int join::BasicProactor::submitOperation (IoOperation* op, [[maybe_unused
         return -1;
     }
 
-    if (JOIN_UNLIKELY (op->fd () < 0))
+    int fd = resolveFd (op);
+
+    if (JOIN_UNLIKELY ((fd < 0) && !op->timeout ()))
     {
         lastError = std::make_error_code (std::errc::bad_file_descriptor);
         return -1;
@@ -268,9 +444,37 @@ inline int join::BasicProactor::submitOperation (IoOperation* op, [[maybe_unused
         return -1;
     }
 
+    if (JOIN_UNLIKELY (op->timeout ()))
+    {
+        return submitTimeout (op);
+    }
+
+    if (JOIN_UNLIKELY ((static_cast<IoOperation::Opcode> (op->code) == IoOperation::Opcode::RecvMultishot) &&
+                       ((op->data.select.group >= _maxBufferGroups) || !_bufferGroups[op->data.select.group])))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (JOIN_UNLIKELY (op->positional ()))
+    {
+        // regular files can't be polled, run the operation on the next loop iteration.
+        _readyOps.push_back (op);
+        op->state = IoOperation::State::Submitted;
+        _lastLinked = op->linked ? op : nullptr;
+
+        uint64_t value = 1;
+        if (!_notified.exchange (true) && JOIN_UNLIKELY (::write (_wakeup, &value, sizeof (uint64_t)) == -1))
+        {
+            _notified.store (false);  // LCOV_EXCL_LINE
+        }
+
+        return 0;
+    }
+
     if (JOIN_UNLIKELY (static_cast<IoOperation::Opcode> (op->code) == IoOperation::Opcode::Connect))
     {
-        if (JOIN_UNLIKELY (::connect (op->data.connect.fd, op->data.connect.addr, op->data.connect.addrlen) == -1 &&
+        if (JOIN_UNLIKELY (::connect (fd, op->data.connect.addr, op->data.connect.addrlen) == -1 &&
                            errno != EINPROGRESS))
         {
             lastError = std::error_code (errno, std::system_category ());
@@ -278,34 +482,45 @@ inline int join::BasicProactor::submitOperation (IoOperation* op, [[maybe_unused
         }
     }
 
-    if (JOIN_UNLIKELY (static_cast<size_t> (op->fd ()) >= _readOps.size ()))
+    if (JOIN_UNLIKELY (static_cast<size_t> (fd) >= _readOps.size ()))
     {
-        size_t newSize = static_cast<size_t> (op->fd ()) + 1;
+        size_t newSize = static_cast<size_t> (fd) + 1;
         _readOps.resize (newSize, nullptr);
         _writeOps.resize (newSize, nullptr);
     }
 
     bool isWrite = isWriteOp (op->code);
 
-    if (JOIN_UNLIKELY ((isWrite && (_writeOps[op->fd ()] != nullptr)) ||
-                       (!isWrite && (_readOps[op->fd ()] != nullptr))))
+    if (JOIN_UNLIKELY ((isWrite && (_writeOps[fd] != nullptr)) || (!isWrite && (_readOps[fd] != nullptr))))
     {
         lastError = make_error_code (Errc::InvalidParam);
         return -1;
     }
 
+    if (JOIN_UNLIKELY (op->zeroCopy () && (_zeroCopyOps.find (fd) == _zeroCopyOps.end ())))
+    {
+        // the kernel silently copies the data unless the socket allows zero-copy.
+        int on = 1;
+        if (::setsockopt (fd, SOL_SOCKET, SO_ZEROCOPY, &on, sizeof (on)) == -1)
+        {
+            lastError = std::error_code (errno, std::system_category ());
+            return -1;
+        }
+    }
+
     if (isWrite)
     {
-        _writeOps[op->fd ()] = op;
+        _writeOps[fd] = op;
     }
     else
     {
-        _readOps[op->fd ()] = op;
+        _readOps[fd] = op;
     }
 
     op->state = IoOperation::State::Submitted;
+    _lastLinked = op->linked ? op : nullptr;
 
-    return _reactor.addHandler (op->fd (), this, _readOps[op->fd ()] != nullptr, _writeOps[op->fd ()] != nullptr);
+    return updateHandler (fd);
 }
 
 // =========================================================================
@@ -320,7 +535,9 @@ inline int join::BasicProactor::cancelOperation (IoOperation* op, [[maybe_unused
         return -1;
     }
 
-    if (JOIN_UNLIKELY (op->fd () < 0))
+    int fd = resolveFd (op);
+
+    if (JOIN_UNLIKELY ((fd < 0) && !op->timeout ()))
     {
         lastError = std::make_error_code (std::errc::bad_file_descriptor);
         return -1;
@@ -332,7 +549,28 @@ inline int join::BasicProactor::cancelOperation (IoOperation* op, [[maybe_unused
         return -1;
     }
 
-    if (JOIN_UNLIKELY (static_cast<size_t> (op->fd ()) >= _readOps.size ()))
+    if (JOIN_UNLIKELY (op->timeout ()))
+    {
+        return cancelTimeout (op);
+    }
+
+    if (JOIN_UNLIKELY (op->positional ()))
+    {
+        auto it = std::find (_readyOps.begin (), _readyOps.end (), op);
+        if (JOIN_UNLIKELY (it == _readyOps.end ()))
+        {
+            lastError = make_error_code (Errc::InvalidParam);
+            return -1;
+        }
+
+        _readyOps.erase (it);
+        op->state = IoOperation::State::Cancelling;
+        finishOperation (op, -ECANCELED, true);
+
+        return 0;
+    }
+
+    if (JOIN_UNLIKELY (static_cast<size_t> (fd) >= _readOps.size ()))
     {
         lastError = std::make_error_code (std::errc::bad_file_descriptor);
         return -1;
@@ -341,7 +579,7 @@ inline int join::BasicProactor::cancelOperation (IoOperation* op, [[maybe_unused
     op->state = IoOperation::State::Cancelling;
     bool isWrite = isWriteOp (op->code);
 
-    if (JOIN_UNLIKELY ((isWrite && (_writeOps[op->fd ()] != op)) || (!isWrite && (_readOps[op->fd ()] != op))))
+    if (JOIN_UNLIKELY ((isWrite && (_writeOps[fd] != op)) || (!isWrite && (_readOps[fd] != op))))
     {
         op->state = IoOperation::State::Submitted;
         lastError = make_error_code (Errc::InvalidParam);
@@ -350,25 +588,16 @@ inline int join::BasicProactor::cancelOperation (IoOperation* op, [[maybe_unused
 
     if (isWrite)
     {
-        _writeOps[op->fd ()] = nullptr;
+        _writeOps[fd] = nullptr;
     }
     else
     {
-        _readOps[op->fd ()] = nullptr;
+        _readOps[fd] = nullptr;
     }
 
-    int ret = 0;
+    int ret = updateHandler (fd);
 
-    if (_readOps[op->fd ()] == nullptr && _writeOps[op->fd ()] == nullptr)
-    {
-        ret = _reactor.delHandler (op->fd ());
-    }
-    else
-    {
-        ret = _reactor.addHandler (op->fd (), this, _readOps[op->fd ()] != nullptr, _writeOps[op->fd ()] != nullptr);
-    }
-
-    dispatchOperation (op, -ECANCELED, true);
+    finishOperation (op, -ECANCELED, true);
 
     return ret;
 }
@@ -383,13 +612,134 @@ inline void join::BasicProactor::cancelAllOperations () noexcept
     {
         IoOperation* rOp = std::exchange (_readOps[fd], nullptr);
         IoOperation* wOp = std::exchange (_writeOps[fd], nullptr);
-        if (rOp || wOp)
+        if (rOp || wOp || JOIN_UNLIKELY (!_zeroCopyOps.empty () && _zeroCopyOps.count (int (fd))))
         {
             _reactor.delHandler (fd);
         }
-        dispatchOperation (rOp, -ECANCELED, true);
-        dispatchOperation (wOp, -ECANCELED, true);
+        finishOperation (rOp, -ECANCELED, true);
+        finishOperation (wOp, -ECANCELED, true);
+    }
+
+    while (!_zeroCopyOps.empty ())
+    {
+        releaseZeroCopy (_zeroCopyOps.begin ()->first);
+    }
+
+    while (!_readyOps.empty ())
+    {
+        IoOperation* op = _readyOps.front ();
+        _readyOps.pop_front ();
+        finishOperation (op, -ECANCELED, true);
+    }
+
+    while (!_timeouts.empty ())
+    {
+        IoOperation* op = _timeouts.begin ()->second;
+        removeTimeout (op);
+        dispatchOperation (op, -ECANCELED, true);
+    }
+
+    _lastLinked = nullptr;
+    rearmTimer ();
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : migrateOperations
+// =========================================================================
+inline int join::BasicProactor::migrateOperations (int fd, BasicProactor* target) noexcept
+{
+    if (JOIN_UNLIKELY ((fd < 0) || (target == nullptr)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if ((target == this) || (static_cast<size_t> (fd) >= _readOps.size ()))
+    {
+        return 0;
+    }
+
+    if (JOIN_UNLIKELY (!_zeroCopyOps.empty () && _zeroCopyOps.count (fd)))
+    {
+        // the error queue notifications are only read here.
+        lastError = make_error_code (Errc::InUse);
+        return -1;
+    }
+
+    IoOperation* ops[] = {_readOps[fd], _writeOps[fd]};
+
+    for (IoOperation*& op : ops)
+    {
+        if ((op != nullptr) && op->fixedFile)
+        {
+            // the slot only makes sense in the file table of this proactor, keep the operation here.
+            op = nullptr;
+        }
+        else if (JOIN_UNLIKELY ((op != nullptr) && (static_cast<IoOperation::Opcode> (op->code) ==
+                                                    IoOperation::Opcode::Connect)))
+        {
+            // the connection attempt can't be started again.
+            lastError = make_error_code (Errc::InUse);
+            return -1;
+        }
+    }
+
+    if ((ops[0] == nullptr) && (ops[1] == nullptr))
+    {
+        return 0;
+    }
+
+    if (ops[0] != nullptr)
+    {
+        _readOps[fd] = nullptr;
+    }
+
+    if (ops[1] != nullptr)
+    {
+        _writeOps[fd] = nullptr;
+    }
+
+    updateHandler (fd);
+
+    for (IoOperation* op : ops)
+    {
+        if (op == nullptr)
+        {
+            continue;
+        }
+
+        IoOperation* timeout = unlinkOperation (op);
+        if (JOIN_UNLIKELY (timeout != nullptr))
+        {
+            dispatchOperation (timeout, -ECANCELED, true);
+        }
+
+        op->state = IoOperation::State::Idle;
+        if (JOIN_UNLIKELY (target->submit (op, true) == -1))
+        {
+            dispatchOperation (op, -ECANCELED, true);  // LCOV_EXCL_LINE
+        }
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : recycleBuffer
+// =========================================================================
+inline int join::BasicProactor::recycleBuffer (uint16_t group, uint16_t id) noexcept
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || !_bufferGroups[group] || (id >= _bufferGroups[group]->count)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
     }
+
+    _bufferGroups[group]->free.push_back (id);
+
+    return 0;
 }
 
 // =========================================================================
@@ -403,7 +753,7 @@ inline void join::BasicProactor::endOperation (IoOperation* op, int result, bool
         return;  // LCOV_EXCL_LINE
     }
 
-    int fd = op->fd ();
+    int fd = resolveFd (op);
 
     if (JOIN_UNLIKELY (fd < 0 || static_cast<size_t> (fd) >= _readOps.size ()))
     {
@@ -419,57 +769,124 @@ inline void join::BasicProactor::endOperation (IoOperation* op, int result, bool
         _readOps[fd] = nullptr;
     }
 
-    if (_readOps[fd] == nullptr && _writeOps[fd] == nullptr)
-    {
-        _reactor.delHandler (fd);
-    }
-    else
-    {
-        _reactor.addHandler (fd, this, _readOps[fd] != nullptr, _writeOps[fd] != nullptr);
-    }
+    updateHandler (fd);
 
-    dispatchOperation (op, result, cancelled);
+    finishOperation (op, result, cancelled);
 }
 
 // =========================================================================
 //   CLASS     : BasicProactor
-//   METHOD    : isWriteOp
+//   METHOD    : resolveFd
 // =========================================================================
-inline bool join::BasicProactor::isWriteOp (uint8_t code) noexcept
+inline int join::BasicProactor::resolveFd (const IoOperation* op) const noexcept
 {
-    return code == static_cast<uint8_t> (IoOperation::Opcode::Connect) ||
-           code == static_cast<uint8_t> (IoOperation::Opcode::Write) ||
-           code == static_cast<uint8_t> (IoOperation::Opcode::WriteFixed) ||
-           code == static_cast<uint8_t> (IoOperation::Opcode::SendMsg) ||
-           code == static_cast<uint8_t> (IoOperation::Opcode::Send);
+    int fd = op->fd ();
+
+    if (JOIN_UNLIKELY (op->fixedFile))
+    {
+        return ((fd >= 0) && (static_cast<size_t> (fd) < _files.size ())) ? _files[fd] : -1;
+    }
+
+    return fd;
 }
 
 // =========================================================================
 //   CLASS     : BasicProactor
-//   METHOD    : executeOp
+//   METHOD    : installFile
 // =========================================================================
-inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
+inline int join::BasicProactor::installFile (uint32_t slot, int fd) noexcept
 {
-    for (;;)
+    int result = 0;
+
+    if (slot == IoOperation::allocSlot)
+    {
+        slot = 0;
+        while ((slot < _files.size ()) && (_files[slot] != -1))
+        {
+            ++slot;
+        }
+
+        if (JOIN_UNLIKELY (slot == _files.size ()))
+        {
+            ::close (fd);
+            return -ENFILE;
+        }
+
+        result = static_cast<int> (slot);
+    }
+    else if (JOIN_UNLIKELY (slot >= _files.size ()))
+    {
+        ::close (fd);
+        return -EINVAL;
+    }
+
+    releaseFile (slot);
+    _files[slot] = fd;
+    _ownedFiles[slot] = true;
+
+    return result;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : releaseFile
+// =========================================================================
+inline void join::BasicProactor::releaseFile (uint32_t slot) noexcept
+{
+    if (_ownedFiles[slot])
+    {
+        ::close (_files[slot]);
+        _ownedFiles[slot] = false;
+    }
+
+    _files[slot] = -1;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : isWriteOp
+// =========================================================================
+inline bool join::BasicProactor::isWriteOp (uint8_t code) noexcept
+{
+    return code == static_cast<uint8_t> (IoOperation::Opcode::Connect) ||
+           code == static_cast<uint8_t> (IoOperation::Opcode::Write) ||
+           code == static_cast<uint8_t> (IoOperation::Opcode::WriteFixed) ||
+           code == static_cast<uint8_t> (IoOperation::Opcode::Writev) ||
+           code == static_cast<uint8_t> (IoOperation::Opcode::SendMsg) ||
+           code == static_cast<uint8_t> (IoOperation::Opcode::Send) ||
+           code == static_cast<uint8_t> (IoOperation::Opcode::SendZc);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : executeOp
+// =========================================================================
+inline int join::BasicProactor::executeOp (IoOperation* op, int fd) noexcept
+{
+    for (;;)
     {
         switch (static_cast<IoOperation::Opcode> (op->code))
         {
             case IoOperation::Opcode::Accept:
+            case IoOperation::Opcode::AcceptMultishot:
                 {
-                    int fd = ::accept4 (op->data.accept.fd, op->data.accept.addr, op->data.accept.addrlen,
-                                        op->data.accept.flags);
-                    if (JOIN_UNLIKELY ((fd == -1) && (errno == EINTR)))
+                    int sock = ::accept4 (fd, op->data.accept.addr, op->data.accept.addrlen, op->data.accept.flags);
+                    if (JOIN_UNLIKELY ((sock == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
                     }
-                    return (fd == -1) ? -errno : fd;
+                    if (JOIN_UNLIKELY (op->data.accept.direct && (sock != -1)))
+                    {
+                        return installFile (op->data.accept.slot, sock);
+                    }
+                    return (sock == -1) ? -errno : sock;
                 }
 
             case IoOperation::Opcode::Connect:
                 {
                     int err = 0;
                     socklen_t len = sizeof (err);
-                    if (JOIN_UNLIKELY (::getsockopt (op->data.connect.fd, SOL_SOCKET, SO_ERROR, &err, &len) == -1))
+                    if (JOIN_UNLIKELY (::getsockopt (fd, SOL_SOCKET, SO_ERROR, &err, &len) == -1))
                     {
                         return -errno;
                     }
@@ -479,7 +896,9 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
             case IoOperation::Opcode::Read:
             case IoOperation::Opcode::ReadFixed:
                 {
-                    ssize_t n = ::read (op->data.rw.fd, op->data.rw.buf, op->data.rw.len);
+                    ssize_t n = (op->data.rw.offset == IoOperation::noOffset)
+                                    ? ::read (fd, op->data.rw.buf, op->data.rw.len)
+                                    : ::pread (fd, op->data.rw.buf, op->data.rw.len, off_t (op->data.rw.offset));
                     if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
@@ -490,7 +909,9 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
             case IoOperation::Opcode::Write:
             case IoOperation::Opcode::WriteFixed:
                 {
-                    ssize_t n = ::write (op->data.rw.fd, op->data.rw.buf, op->data.rw.len);
+                    ssize_t n = (op->data.rw.offset == IoOperation::noOffset)
+                                    ? ::write (fd, op->data.rw.buf, op->data.rw.len)
+                                    : ::pwrite (fd, op->data.rw.buf, op->data.rw.len, off_t (op->data.rw.offset));
                     if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
@@ -500,7 +921,7 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
 
             case IoOperation::Opcode::RecvMsg:
                 {
-                    ssize_t n = ::recvmsg (op->data.msg.fd, op->data.msg.msg, op->data.msg.flags);
+                    ssize_t n = ::recvmsg (fd, op->data.msg.msg, op->data.msg.flags);
                     if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
@@ -510,7 +931,7 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
 
             case IoOperation::Opcode::SendMsg:
                 {
-                    ssize_t n = ::sendmsg (op->data.msg.fd, op->data.msg.msg, op->data.msg.flags);
+                    ssize_t n = ::sendmsg (fd, op->data.msg.msg, op->data.msg.flags);
                     if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
@@ -520,8 +941,7 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
 
             case IoOperation::Opcode::Recv:
                 {
-                    ssize_t n =
-                        ::recv (op->data.stream.fd, op->data.stream.buf, op->data.stream.len, op->data.stream.flags);
+                    ssize_t n = ::recv (fd, op->data.stream.buf, op->data.stream.len, op->data.stream.flags);
                     if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
@@ -531,8 +951,32 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
 
             case IoOperation::Opcode::Send:
                 {
-                    ssize_t n =
-                        ::send (op->data.stream.fd, op->data.stream.buf, op->data.stream.len, op->data.stream.flags);
+                    ssize_t n = ::send (fd, op->data.stream.buf, op->data.stream.len, op->data.stream.flags);
+                    if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
+                    {
+                        continue;  // LCOV_EXCL_LINE
+                    }
+                    return (n == -1) ? -errno : static_cast<int> (n);
+                }
+
+            case IoOperation::Opcode::Readv:
+                {
+                    ssize_t n = (op->data.vec.offset == IoOperation::noOffset)
+                                    ? ::readv (fd, op->data.vec.iov, op->data.vec.iovcnt)
+                                    : ::preadv (fd, op->data.vec.iov, op->data.vec.iovcnt, off_t (op->data.vec.offset));
+                    if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
+                    {
+                        continue;  // LCOV_EXCL_LINE
+                    }
+                    return (n == -1) ? -errno : static_cast<int> (n);
+                }
+
+            case IoOperation::Opcode::Writev:
+                {
+                    ssize_t n = (op->data.vec.offset == IoOperation::noOffset)
+                                    ? ::writev (fd, op->data.vec.iov, op->data.vec.iovcnt)
+                                    : ::pwritev (fd, op->data.vec.iov, op->data.vec.iovcnt,
+                                                 off_t (op->data.vec.offset));
                     if (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)))
                     {
                         continue;  // LCOV_EXCL_LINE
@@ -546,6 +990,404 @@ inline int join::BasicProactor::executeOp (IoOperation* op) noexcept
     }
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : executeMultishot
+// =========================================================================
+inline void join::BasicProactor::executeMultishot (IoOperation* op, int fd) noexcept
+{
+    int result;
+
+    if (static_cast<IoOperation::Opcode> (op->code) == IoOperation::Opcode::RecvMultishot)
+    {
+        BufferGroup* group = _bufferGroups[op->data.select.group].get ();
+        if (JOIN_UNLIKELY ((group == nullptr) || group->free.empty ()))
+        {
+            // no buffer left, io_uring ends the operation the same way.
+            endOperation (op, -ENOBUFS, false);
+            return;
+        }
+
+        const uint16_t id = group->free.back ();
+        ssize_t n;
+
+        do
+        {
+            n = ::recv (fd, group->base + (uint64_t (id) * group->size), group->size, op->data.select.flags);
+        }
+        while (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)));
+
+        if (JOIN_LIKELY (n > 0))
+        {
+            group->free.pop_back ();
+            op->buffer = id;
+            dispatchMore (op, static_cast<int> (n));
+            return;
+        }
+
+        result = (n == -1) ? -errno : 0;
+    }
+    else
+    {
+        result = executeOp (op, fd);
+        if (JOIN_LIKELY (result >= 0))
+        {
+            dispatchMore (op, result);
+            return;
+        }
+    }
+
+    if ((result == -EAGAIN) || (result == -EWOULDBLOCK))
+    {
+        return;
+    }
+
+    endOperation (op, result, false);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : executeReadyOps
+// =========================================================================
+inline void join::BasicProactor::executeReadyOps () noexcept
+{
+    // operations submitted by the handlers wait for the next round.
+    for (size_t count = _readyOps.size (); (count > 0) && !_readyOps.empty (); --count)
+    {
+        IoOperation* op = _readyOps.front ();
+        _readyOps.pop_front ();
+        finishOperation (op, executeOp (op, resolveFd (op)), false);
+    }
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : finishOperation
+// =========================================================================
+inline void join::BasicProactor::finishOperation (IoOperation* op, int result, bool cancelled) noexcept
+{
+    IoOperation* timeout = unlinkOperation (op);
+
+    dispatchOperation (op, result, cancelled);
+
+    if (JOIN_UNLIKELY (timeout != nullptr))
+    {
+        dispatchOperation (timeout, -ECANCELED, true);
+    }
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : unlinkOperation
+// =========================================================================
+inline join::IoOperation* join::BasicProactor::unlinkOperation (IoOperation* op) noexcept
+{
+    if (_lastLinked == op)
+    {
+        _lastLinked = nullptr;
+    }
+
+    IoOperation* timeout = nullptr;
+
+    if (JOIN_UNLIKELY ((op != nullptr) && op->linked && !_linkTimeouts.empty ()))
+    {
+        auto it = _linkTimeouts.find (op);
+        if (it != _linkTimeouts.end ())
+        {
+            timeout = it->second;
+            removeTimeout (timeout);
+        }
+    }
+
+    return timeout;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : updateHandler
+// =========================================================================
+inline int join::BasicProactor::updateHandler (int fd) noexcept
+{
+    if ((_readOps[fd] == nullptr) && (_writeOps[fd] == nullptr))
+    {
+        if (JOIN_LIKELY (_zeroCopyOps.empty () || (_zeroCopyOps.find (fd) == _zeroCopyOps.end ())))
+        {
+            return _reactor.delHandler (fd);
+        }
+
+        // the error queue notifications are reported whatever the interest, an edge triggered one keeps the
+        // socket registered without waking the loop on each iteration.
+        return _reactor.addHandler (fd, this, false, true, true, Reactor::EdgeTriggered);
+    }
+
+    return _reactor.addHandler (fd, this, _readOps[fd] != nullptr, _writeOps[fd] != nullptr);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : executeZeroCopy
+// =========================================================================
+inline void join::BasicProactor::executeZeroCopy (IoOperation* op, int fd) noexcept
+{
+    ssize_t n;
+
+    do
+    {
+        n = ::send (fd, op->data.stream.buf, op->data.stream.len, op->data.stream.flags | MSG_ZEROCOPY);
+    }
+    while (JOIN_UNLIKELY ((n == -1) && (errno == EINTR)));
+
+    if (JOIN_UNLIKELY (n <= 0))
+    {
+        // nothing queued, no notification will follow.
+        endOperation (op, (n == -1) ? -errno : 0, false);
+        return;
+    }
+
+    _writeOps[fd] = nullptr;
+    _zeroCopyOps[fd].push_back (op);
+    updateHandler (fd);
+
+    IoOperation* timeout = unlinkOperation (op);
+
+    dispatchMore (op, static_cast<int> (n));
+
+    if (JOIN_UNLIKELY (timeout != nullptr))
+    {
+        dispatchOperation (timeout, -ECANCELED, true);
+    }
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : readNotifications
+// =========================================================================
+inline bool join::BasicProactor::readNotifications (int fd) noexcept
+{
+    if (_zeroCopyOps.find (fd) == _zeroCopyOps.end ())
+    {
+        return false;
+    }
+
+    bool notified = false;
+    uint64_t released = 0;
+
+    for (;;)
+    {
+        alignas (cmsghdr) char control[CMSG_SPACE (sizeof (sock_extended_err) + sizeof (sockaddr_in6))];
+        msghdr message = {};
+        message.msg_control = control;
+        message.msg_controllen = sizeof (control);
+
+        if (::recvmsg (fd, &message, MSG_ERRQUEUE | MSG_DONTWAIT) == -1)
+        {
+            break;
+        }
+
+        for (cmsghdr* cmsg = CMSG_FIRSTHDR (&message); cmsg != nullptr; cmsg = CMSG_NXTHDR (&message, cmsg))
+        {
+            if (((cmsg->cmsg_level != SOL_IP) || (cmsg->cmsg_type != IP_RECVERR)) &&
+                ((cmsg->cmsg_level != SOL_IPV6) || (cmsg->cmsg_type != IPV6_RECVERR)))
+            {
+                continue;
+            }
+
+            const sock_extended_err* err = reinterpret_cast<const sock_extended_err*> (CMSG_DATA (cmsg));
+            if ((err->ee_errno == 0) && (err->ee_origin == SO_EE_ORIGIN_ZEROCOPY))
+            {
+                // a notification covers the range [ee_info, ee_data] of the sends made on the socket.
+                released += uint64_t (err->ee_data - err->ee_info) + 1;
+                notified = true;
+            }
+        }
+    }
+
+    // a TCP socket releases its buffers in send order.
+    for (; released > 0; --released)
+    {
+        auto it = _zeroCopyOps.find (fd);
+        if (JOIN_UNLIKELY (it == _zeroCopyOps.end ()))
+        {
+            break;  // LCOV_EXCL_LINE
+        }
+
+        IoOperation* op = it->second.front ();
+        it->second.pop_front ();
+
+        if (it->second.empty ())
+        {
+            _zeroCopyOps.erase (it);
+            updateHandler (fd);
+        }
+
+        dispatchRelease (op);
+    }
+
+    return notified;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : releaseZeroCopy
+// =========================================================================
+inline void join::BasicProactor::releaseZeroCopy (int fd) noexcept
+{
+    auto it = _zeroCopyOps.find (fd);
+    if (JOIN_LIKELY (it == _zeroCopyOps.end ()))
+    {
+        return;
+    }
+
+    std::deque<IoOperation*> ops = std::move (it->second);
+    _zeroCopyOps.erase (it);
+
+    for (IoOperation* op : ops)
+    {
+        dispatchRelease (op);
+    }
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : submitTimeout
+// =========================================================================
+inline int join::BasicProactor::submitTimeout (IoOperation* op) noexcept
+{
+    op->data.timeout.target = nullptr;
+
+    if (static_cast<IoOperation::Opcode> (op->code) == IoOperation::Opcode::LinkTimeout)
+    {
+        // io_uring binds a link timeout to the previous operation of the submission.
+        if (JOIN_UNLIKELY (_lastLinked == nullptr))
+        {
+            lastError = make_error_code (Errc::InvalidParam);
+            return -1;
+        }
+
+        op->data.timeout.target = std::exchange (_lastLinked, nullptr);
+        _linkTimeouts[op->data.timeout.target] = op;
+    }
+    else
+    {
+        _lastLinked = op->linked ? op : nullptr;
+    }
+
+    timespec now{};
+    ::clock_gettime (CLOCK_MONOTONIC, &now);
+
+    op->data.timeout.deadline = ((int64_t (now.tv_sec) + op->data.timeout.ts.tv_sec) * 1000000000LL) + now.tv_nsec +
+                                op->data.timeout.ts.tv_nsec;
+    op->state = IoOperation::State::Submitted;
+
+    auto it = _timeouts.emplace (op->data.timeout.deadline, op).first;
+    if (it == _timeouts.begin ())
+    {
+        rearmTimer ();
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : cancelTimeout
+// =========================================================================
+inline int join::BasicProactor::cancelTimeout (IoOperation* op) noexcept
+{
+    if (JOIN_UNLIKELY (!removeTimeout (op)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    op->state = IoOperation::State::Cancelling;
+    dispatchOperation (op, -ECANCELED, true);
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : removeTimeout
+// =========================================================================
+inline bool join::BasicProactor::removeTimeout (IoOperation* op) noexcept
+{
+    auto it = _timeouts.find (std::make_pair (op->data.timeout.deadline, op));
+    if (JOIN_UNLIKELY (it == _timeouts.end ()))
+    {
+        return false;
+    }
+
+    bool earliest = (it == _timeouts.begin ());
+    _timeouts.erase (it);
+
+    if (op->data.timeout.target != nullptr)
+    {
+        _linkTimeouts.erase (op->data.timeout.target);
+    }
+
+    if (earliest)
+    {
+        rearmTimer ();
+    }
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : expireTimeouts
+// =========================================================================
+inline void join::BasicProactor::expireTimeouts () noexcept
+{
+    uint64_t expirations;
+    if (JOIN_UNLIKELY (::read (_timer, &expirations, sizeof (expirations)) == -1))
+    {
+        return;  // LCOV_EXCL_LINE
+    }
+
+    timespec ts{};
+    ::clock_gettime (CLOCK_MONOTONIC, &ts);
+    const int64_t now = (int64_t (ts.tv_sec) * 1000000000LL) + ts.tv_nsec;
+
+    while (!_timeouts.empty () && (_timeouts.begin ()->first <= now))
+    {
+        IoOperation* op = _timeouts.begin ()->second;
+        IoOperation* target = op->data.timeout.target;
+
+        _timeouts.erase (_timeouts.begin ());
+
+        if (target != nullptr)
+        {
+            _linkTimeouts.erase (target);
+            cancelOperation (target, false);
+        }
+
+        dispatchOperation (op, -ETIME, false);
+    }
+
+    rearmTimer ();
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : rearmTimer
+// =========================================================================
+inline void join::BasicProactor::rearmTimer () noexcept
+{
+    itimerspec ts{};
+
+    if (!_timeouts.empty ())
+    {
+        // a zero value would disarm the timer.
+        const int64_t deadline = std::max (_timeouts.begin ()->first, int64_t (1));
+        ts.it_value.tv_sec = deadline / 1000000000LL;
+        ts.it_value.tv_nsec = deadline % 1000000000LL;
+    }
+
+    timerfd_settime (_timer, TFD_TIMER_ABSTIME, &ts, nullptr);
+}
+
 // =========================================================================
 //   CLASS     : BasicProactor
 //   METHOD    : onReadable
@@ -558,7 +1400,19 @@ inline void join::BasicProactor::onReadable (int fd) noexcept
         return;
     }
 
-    endOperation (_readOps[fd], executeOp (_readOps[fd]), false);
+    if (JOIN_UNLIKELY (fd == _timer))
+    {
+        expireTimeouts ();
+        return;
+    }
+
+    if (_readOps[fd]->multishot ())
+    {
+        executeMultishot (_readOps[fd], fd);
+        return;
+    }
+
+    endOperation (_readOps[fd], executeOp (_readOps[fd], fd), false);
 }
 
 // =========================================================================
@@ -567,7 +1421,19 @@ inline void join::BasicProactor::onReadable (int fd) noexcept
 // =========================================================================
 inline void join::BasicProactor::onWriteable (int fd) noexcept
 {
-    endOperation (_writeOps[fd], executeOp (_writeOps[fd]), false);
+    if (JOIN_UNLIKELY (_writeOps[fd] == nullptr))
+    {
+        // socket only watched for zero-copy notifications.
+        return;
+    }
+
+    if (JOIN_UNLIKELY (_writeOps[fd]->zeroCopy ()))
+    {
+        executeZeroCopy (_writeOps[fd], fd);
+        return;
+    }
+
+    endOperation (_writeOps[fd], executeOp (_writeOps[fd], fd), false);
 }
 
 // =========================================================================
@@ -578,12 +1444,13 @@ inline void join::BasicProactor::onClose (int fd) noexcept
 {
     IoOperation* rOp = std::exchange (_readOps[fd], nullptr);
     IoOperation* wOp = std::exchange (_writeOps[fd], nullptr);
-    if (JOIN_LIKELY (rOp || wOp))
+    if (JOIN_LIKELY (rOp || wOp) || JOIN_UNLIKELY (!_zeroCopyOps.empty () && _zeroCopyOps.count (fd)))
     {
         _reactor.delHandler (fd);
     }
-    dispatchOperation (rOp, 0, false);
-    dispatchOperation (wOp, 0, false);
+    finishOperation (rOp, 0, false);
+    finishOperation (wOp, 0, false);
+    releaseZeroCopy (fd);
 }
 
 // =========================================================================
@@ -592,12 +1459,18 @@ inline void join::BasicProactor::onClose (int fd) noexcept
 // =========================================================================
 inline void join::BasicProactor::onError (int fd) noexcept
 {
+    if (JOIN_UNLIKELY (!_zeroCopyOps.empty ()) && readNotifications (fd))
+    {
+        return;
+    }
+
     IoOperation* rOp = std::exchange (_readOps[fd], nullptr);
     IoOperation* wOp = std::exchange (_writeOps[fd], nullptr);
-    if (JOIN_LIKELY (rOp || wOp))
+    if (JOIN_LIKELY (rOp || wOp) || JOIN_UNLIKELY (!_zeroCopyOps.empty () && _zeroCopyOps.count (fd)))
     {
         _reactor.delHandler (fd);
     }
-    dispatchOperation (rOp, -ECONNRESET, false);
-    dispatchOperation (wOp, -ECONNRESET, false);
+    finishOperation (rOp, -ECONNRESET, false);
+    finishOperation (wOp, -ECONNRESET, false);
+    releaseZeroCopy (fd);
 }
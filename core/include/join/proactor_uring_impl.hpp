@@ -27,7 +27,7 @@
 //   METHOD    : BasicProactor
 // =========================================================================
 template <typename Policy>
-join::BasicProactor<Policy>::BasicProactor ()
+join::BasicProactor<Policy>::BasicProactor (const BasicProactor* shared)
 : _commands (_queueSize)
 , _wakeup (initWakeup (is_default<Policy>{}))
 {
@@ -39,11 +39,19 @@ join::BasicProactor<Policy>::BasicProactor ()
     initSqThreadIdle (params, has_sq_thread_idle<Policy>{});
     initSqThreadCpu (params, has_sq_thread_cpu<Policy>{});
 
-    if (io_uring_queue_init_params (Policy::sqEntries, &_ring, &params) < 0)
+    if (shared != nullptr)
+    {
+        // share the async workers (and the sq poll thread) instead of spawning a new pool for this ring.
+        params.flags |= IORING_SETUP_ATTACH_WQ;
+        params.wq_fd = static_cast<__u32> (shared->_ring.ring_fd);
+    }
+
+    int ret = io_uring_queue_init_params (Policy::sqEntries, &_ring, &params);
+    if (ret < 0)
     {
         // LCOV_EXCL_START
         ::close (_wakeup);
-        throw std::system_error (errno, std::system_category (), "io_uring_queue_init failed");
+        throw std::system_error (-ret, std::system_category (), "io_uring_queue_init failed");
         // LCOV_EXCL_STOP
     }
 
@@ -60,6 +68,14 @@ join::BasicProactor<Policy>::~BasicProactor () noexcept
 {
     stop (true);
 
+    for (size_t group = 0; group < _maxBufferGroups; ++group)
+    {
+        if (_bufferGroups[group] != nullptr)
+        {
+            unregisterBufferRing (uint16_t (group));
+        }
+    }
+
     io_uring_queue_exit (&_ring);
 
     if (_wakeup != -1)
@@ -77,10 +93,11 @@ int join::BasicProactor<Policy>::flush (bool sync) noexcept
 {
     if (isProactorThread ())
     {
-        if (JOIN_UNLIKELY (io_uring_submit (&_ring) < 0))
+        int ret = io_uring_submit (&_ring);
+        if (JOIN_UNLIKELY (ret < 0))
         {
             // LCOV_EXCL_START
-            lastError = std::error_code (errno, std::system_category ());
+            lastError = std::error_code (-ret, std::system_category ());
             return -1;
             // LCOV_EXCL_STOP
         }
@@ -119,6 +136,51 @@ int join::BasicProactor<Policy>::flush (bool sync) noexcept
     return 0;
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : forward
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::forward (IoOperation* op, BasicProactor& target) noexcept
+{
+    if (&target == this)
+    {
+        return submit (op, true);
+    }
+
+    if (!isProactorThread ())
+    {
+        return target.submit (op, true);
+    }
+
+    if (JOIN_UNLIKELY (op == nullptr))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (JOIN_UNLIKELY (op->state != IoOperation::State::Idle))
+    {
+        lastError = make_error_code (Errc::OperationFailed);
+        return -1;
+    }
+
+    io_uring_sqe* sqe = getSqe ();
+    if (JOIN_UNLIKELY (sqe == nullptr))
+    {
+        return target.submit (op, true);  // LCOV_EXCL_LINE
+    }
+
+    // the target ring gets the operation as user data of a completion, this ring only hears about failures.
+    uintptr_t data = reinterpret_cast<uintptr_t> (op);
+    io_uring_prep_msg_ring (sqe, target._ring.ring_fd, 0, data | _forwardTag, 0);
+    io_uring_sqe_set_data (sqe, reinterpret_cast<void*> (data | _failureTag));
+    sqe->flags |= IOSQE_CQE_SKIP_SUCCESS;
+    io_uring_submit (&_ring);
+
+    return 0;
+}
+
 // =========================================================================
 //   CLASS     : BasicProactor
 //   METHOD    : run
@@ -215,6 +277,135 @@ int join::BasicProactor<Policy>::unregisterBuffers () noexcept
     return 0;
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : registerFiles
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::registerFiles (const std::vector<int>& fds) noexcept
+{
+    int ret = io_uring_register_files (&_ring, fds.data (), fds.size ());
+    if (JOIN_UNLIKELY (ret < 0))
+    {
+        lastError = std::error_code (-ret, std::system_category ());
+        return -1;
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : updateFiles
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::updateFiles (uint32_t offset, const std::vector<int>& fds) noexcept
+{
+    int ret = io_uring_register_files_update (&_ring, offset, fds.data (), fds.size ());
+    if (JOIN_UNLIKELY (ret < 0))
+    {
+        lastError = std::error_code (-ret, std::system_category ());
+        return -1;
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : unregisterFiles
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::unregisterFiles () noexcept
+{
+    int ret = io_uring_unregister_files (&_ring);
+    if (JOIN_UNLIKELY (ret < 0))
+    {
+        lastError = std::error_code (-ret, std::system_category ());
+        return -1;
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : registerBufferRing
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::registerBufferRing (uint16_t group, uint32_t count, uint32_t size) noexcept
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || (count == 0) || (count > _maxBuffers) ||
+                       ((count & (count - 1)) != 0) || (size == 0)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (JOIN_UNLIKELY (_bufferGroups[group] != nullptr))
+    {
+        lastError = make_error_code (Errc::InUse);
+        return -1;
+    }
+
+    std::unique_ptr<BufferGroup> bufferGroup;
+
+    try
+    {
+        bufferGroup.reset (new BufferGroup (count, size));
+    }
+    catch (const std::system_error& e)
+    {
+        lastError = e.code ();
+        return -1;
+    }
+
+    int ret = 0;
+    bufferGroup->ring = io_uring_setup_buf_ring (&_ring, count, group, 0, &ret);
+    if (JOIN_UNLIKELY (bufferGroup->ring == nullptr))
+    {
+        lastError = std::error_code (-ret, std::system_category ());
+        return -1;
+    }
+
+    const int mask = io_uring_buf_ring_mask (count);
+    for (uint32_t id = 0; id < count; ++id)
+    {
+        io_uring_buf_ring_add (bufferGroup->ring, bufferGroup->base + (uint64_t (id) * size), size, uint16_t (id),
+                               mask, int (id));
+    }
+    io_uring_buf_ring_advance (bufferGroup->ring, int (count));
+
+    _bufferGroups[group] = std::move (bufferGroup);
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : unregisterBufferRing
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::unregisterBufferRing (uint16_t group) noexcept
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || (_bufferGroups[group] == nullptr)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    int ret = io_uring_free_buf_ring (&_ring, _bufferGroups[group]->ring, _bufferGroups[group]->count, group);
+    if (JOIN_UNLIKELY (ret < 0))
+    {
+        lastError = std::error_code (-ret, std::system_category ());
+        return -1;
+    }
+
+    _bufferGroups[group].reset ();
+
+    return 0;
+}
+
 #ifdef JOIN_HAS_NUMA
 // =========================================================================
 //   CLASS     : BasicProactor
@@ -450,14 +641,27 @@ void join::BasicProactor<Policy>::processCommand (const Command& cmd) noexcept
             }
             break;
 
+        case CommandType::Release:
+            err = recycleBuffer (uint16_t (cmd.buffer >> 16), uint16_t (cmd.buffer));
+            break;
+
+        case CommandType::Migrate:
+            err = migrateOperations (cmd.fd, cmd.target);
+            break;
+
         case CommandType::Flush:
-            if (JOIN_UNLIKELY (io_uring_submit (&_ring) < 0))
+            err = io_uring_submit (&_ring);
+            if (JOIN_UNLIKELY (err < 0))
             {
                 // LCOV_EXCL_START
-                lastError = std::error_code (errno, std::system_category ());
+                lastError = std::error_code (-err, std::system_category ());
                 err = -1;
                 // LCOV_EXCL_STOP
             }
+            else
+            {
+                err = 0;
+            }
             break;
 
         default:
@@ -487,7 +691,7 @@ int join::BasicProactor<Policy>::submitOperation (IoOperation* op, bool flush) n
         return -1;
     }
 
-    if (JOIN_UNLIKELY (op->fd () < 0))
+    if (JOIN_UNLIKELY ((op->fd () < 0) && !op->timeout ()))
     {
         lastError = std::make_error_code (std::errc::bad_file_descriptor);
         return -1;
@@ -499,6 +703,44 @@ int join::BasicProactor<Policy>::submitOperation (IoOperation* op, bool flush) n
         return -1;
     }
 
+    if (JOIN_UNLIKELY ((static_cast<IoOperation::Opcode> (op->code) == IoOperation::Opcode::RecvMultishot) &&
+                       ((op->data.select.group >= _maxBufferGroups) || !_bufferGroups[op->data.select.group])))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (JOIN_UNLIKELY (op->linked))
+    {
+        // nothing else may be queued inside a chain, and the kernel ends a chain with the submission.
+        op->state = IoOperation::State::Submitted;
+        op->index = static_cast<uint32_t> (_pendingOps.size ());
+        _pendingOps.push_back (op);
+        _chain.push_back (op);
+        return 0;
+    }
+
+    if (JOIN_UNLIKELY (!_chain.empty ()))
+    {
+        if (io_uring_sq_space_left (&_ring) <= _chain.size ())
+        {
+            io_uring_submit (&_ring);
+        }
+
+        for (IoOperation* linked : _chain)
+        {
+            io_uring_sqe* sqe = getSqe ();
+            if (JOIN_UNLIKELY (sqe == nullptr))
+            {
+                endOperation (linked, -EBUSY);  // LCOV_EXCL_LINE
+                continue;                       // LCOV_EXCL_LINE
+            }
+            prepareSqe (sqe, linked);
+        }
+
+        _chain.clear ();
+    }
+
     io_uring_sqe* sqe = getSqe ();
     if (JOIN_UNLIKELY (sqe == nullptr))
     {
@@ -534,7 +776,7 @@ int join::BasicProactor<Policy>::cancelOperation (IoOperation* op, bool flush) n
         return -1;
     }
 
-    if (JOIN_UNLIKELY (op->fd () < 0))
+    if (JOIN_UNLIKELY ((op->fd () < 0) && !op->timeout ()))
     {
         lastError = std::make_error_code (std::errc::bad_file_descriptor);
         return -1;
@@ -552,6 +794,18 @@ int join::BasicProactor<Policy>::cancelOperation (IoOperation* op, bool flush) n
         return -1;
     }
 
+    if (JOIN_UNLIKELY (!_chain.empty ()))
+    {
+        auto it = std::find (_chain.begin (), _chain.end (), op);
+        if (it != _chain.end ())
+        {
+            // held back, the ring never saw it.
+            _chain.erase (it);
+            endOperation (op, -ECANCELED, true);
+            return 0;
+        }
+    }
+
     io_uring_sqe* sqe = getSqe ();
     if (JOIN_UNLIKELY (sqe == nullptr))
     {
@@ -580,12 +834,84 @@ int join::BasicProactor<Policy>::cancelOperation (IoOperation* op, bool flush) n
 template <typename Policy>
 void join::BasicProactor<Policy>::cancelAllOperations () noexcept
 {
+    for (IoOperation* op : _chain)
+    {
+        endOperation (op, -ECANCELED, true);
+    }
+    _chain.clear ();
+
     for (IoOperation* op : _pendingOps)
     {
         cancelOperation (op, false);
     }
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : migrateOperations
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::migrateOperations (int fd, BasicProactor* target) noexcept
+{
+    if (JOIN_UNLIKELY ((fd < 0) || (target == nullptr)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    if (target == this)
+    {
+        return 0;
+    }
+
+    for (IoOperation* op : _pendingOps)
+    {
+        // operations using a registered file stay here, the slot only makes sense in the file table of this ring.
+        if ((op->fd () == fd) && !op->timeout () && !op->fixedFile &&
+            JOIN_UNLIKELY (op->zeroCopy () || op->linked ||
+                           (static_cast<IoOperation::Opcode> (op->code) == IoOperation::Opcode::Connect)))
+        {
+            lastError = make_error_code (Errc::InUse);
+            return -1;
+        }
+    }
+
+    for (IoOperation* op : _pendingOps)
+    {
+        if ((op->fd () == fd) && !op->timeout () && !op->fixedFile && (op->state == IoOperation::State::Submitted))
+        {
+            // moved once the cancellation completes, see completeOperation.
+            _migrations[op] = target;
+            cancelOperation (op, false);
+        }
+    }
+
+    io_uring_submit (&_ring);
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : recycleBuffer
+// =========================================================================
+template <typename Policy>
+int join::BasicProactor<Policy>::recycleBuffer (uint16_t group, uint16_t id) noexcept
+{
+    if (JOIN_UNLIKELY ((group >= _maxBufferGroups) || !_bufferGroups[group] || (id >= _bufferGroups[group]->count)))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    BufferGroup* bufferGroup = _bufferGroups[group].get ();
+    io_uring_buf_ring_add (bufferGroup->ring, bufferGroup->base + (uint64_t (id) * bufferGroup->size),
+                           bufferGroup->size, id, io_uring_buf_ring_mask (bufferGroup->count), 0);
+    io_uring_buf_ring_advance (bufferGroup->ring, 1);
+
+    return 0;
+}
+
 // =========================================================================
 //   CLASS     : BasicProactor
 //   METHOD    : endOperation
@@ -598,6 +924,17 @@ void join::BasicProactor<Policy>::endOperation (IoOperation* op, int result, boo
         return;  // LCOV_EXCL_LINE
     }
 
+    removePending (op);
+    dispatchOperation (op, result, cancelled);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : removePending
+// =========================================================================
+template <typename Policy>
+void join::BasicProactor<Policy>::removePending (IoOperation* op) noexcept
+{
     if (JOIN_LIKELY (op->index < _pendingOps.size () && _pendingOps[op->index] == op))
     {
         IoOperation* last = _pendingOps.back ();
@@ -605,8 +942,6 @@ void join::BasicProactor<Policy>::endOperation (IoOperation* op, int result, boo
         last->index = op->index;
         _pendingOps.pop_back ();
     }
-
-    dispatchOperation (op, result, cancelled);
 }
 
 // =========================================================================
@@ -636,6 +971,12 @@ void join::BasicProactor<Policy>::prepareSqe (io_uring_sqe* sqe, IoOperation* op
     switch (static_cast<IoOperation::Opcode> (op->code))
     {
         case IoOperation::Opcode::Accept:
+            if (JOIN_UNLIKELY (op->data.accept.direct))
+            {
+                io_uring_prep_accept_direct (sqe, op->data.accept.fd, op->data.accept.addr, op->data.accept.addrlen,
+                                             op->data.accept.flags, op->data.accept.slot);
+                break;
+            }
             io_uring_prep_accept (sqe, op->data.accept.fd, op->data.accept.addr, op->data.accept.addrlen,
                                   op->data.accept.flags);
             break;
@@ -645,19 +986,21 @@ void join::BasicProactor<Policy>::prepareSqe (io_uring_sqe* sqe, IoOperation* op
             break;
 
         case IoOperation::Opcode::Read:
-            io_uring_prep_read (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, 0);
+            io_uring_prep_read (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, op->data.rw.offset);
             break;
 
         case IoOperation::Opcode::Write:
-            io_uring_prep_write (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, 0);
+            io_uring_prep_write (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, op->data.rw.offset);
             break;
 
         case IoOperation::Opcode::ReadFixed:
-            io_uring_prep_read_fixed (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, 0, op->data.rw.index);
+            io_uring_prep_read_fixed (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, op->data.rw.offset,
+                                      op->data.rw.index);
             break;
 
         case IoOperation::Opcode::WriteFixed:
-            io_uring_prep_write_fixed (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, 0, op->data.rw.index);
+            io_uring_prep_write_fixed (sqe, op->data.rw.fd, op->data.rw.buf, op->data.rw.len, op->data.rw.offset,
+                                       op->data.rw.index);
             break;
 
         case IoOperation::Opcode::RecvMsg:
@@ -678,6 +1021,38 @@ void join::BasicProactor<Policy>::prepareSqe (io_uring_sqe* sqe, IoOperation* op
                                 op->data.stream.flags);
             break;
 
+        case IoOperation::Opcode::SendZc:
+            io_uring_prep_send_zc (sqe, op->data.stream.fd, op->data.stream.buf, op->data.stream.len,
+                                   op->data.stream.flags, 0);
+            break;
+
+        case IoOperation::Opcode::AcceptMultishot:
+            io_uring_prep_multishot_accept (sqe, op->data.accept.fd, op->data.accept.addr, op->data.accept.addrlen,
+                                            op->data.accept.flags);
+            break;
+
+        case IoOperation::Opcode::RecvMultishot:
+            io_uring_prep_recv_multishot (sqe, op->data.select.fd, nullptr, 0, op->data.select.flags);
+            sqe->flags |= IOSQE_BUFFER_SELECT;
+            sqe->buf_group = op->data.select.group;
+            break;
+
+        case IoOperation::Opcode::Readv:
+            io_uring_prep_readv (sqe, op->data.vec.fd, op->data.vec.iov, op->data.vec.iovcnt, op->data.vec.offset);
+            break;
+
+        case IoOperation::Opcode::Writev:
+            io_uring_prep_writev (sqe, op->data.vec.fd, op->data.vec.iov, op->data.vec.iovcnt, op->data.vec.offset);
+            break;
+
+        case IoOperation::Opcode::Timeout:
+            io_uring_prep_timeout (sqe, &op->data.timeout.ts, 0, 0);
+            break;
+
+        case IoOperation::Opcode::LinkTimeout:
+            io_uring_prep_link_timeout (sqe, &op->data.timeout.ts, 0);
+            break;
+
         default:
             io_uring_prep_nop (sqe);
     }
@@ -688,6 +1063,11 @@ void join::BasicProactor<Policy>::prepareSqe (io_uring_sqe* sqe, IoOperation* op
     {
         sqe->flags |= IOSQE_IO_LINK;
     }
+
+    if (JOIN_UNLIKELY (op->fixedFile))
+    {
+        sqe->flags |= IOSQE_FIXED_FILE;
+    }
 }
 
 // =========================================================================
@@ -714,6 +1094,12 @@ void join::BasicProactor<Policy>::rearmWakeup () noexcept
 template <typename Policy>
 void join::BasicProactor<Policy>::dispatchCqe (io_uring_cqe* cqe) noexcept
 {
+    if (JOIN_UNLIKELY (io_uring_cqe_get_data64 (cqe) & (_forwardTag | _failureTag)))
+    {
+        dispatchForward (cqe);
+        return;
+    }
+
     dispatchCqe (cqe, is_default<Policy>{});
 }
 
@@ -748,9 +1134,7 @@ void join::BasicProactor<Policy>::dispatchCqe (io_uring_cqe* cqe, std::true_type
         return;  // LCOV_EXCL_LINE
     }
 
-    int result = cqe->res;
-    bool cancelled = (result < 0) && (result == -ECANCELED || op->state == IoOperation::State::Cancelling);
-    endOperation (op, result, cancelled);
+    completeOperation (op, cqe);
 }
 
 // =========================================================================
@@ -771,11 +1155,86 @@ void join::BasicProactor<Policy>::dispatchCqe (io_uring_cqe* cqe, std::false_typ
         return;  // LCOV_EXCL_LINE
     }
 
+    completeOperation (op, cqe);
+}
+
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : completeOperation
+// =========================================================================
+template <typename Policy>
+void join::BasicProactor<Policy>::completeOperation (IoOperation* op, io_uring_cqe* cqe) noexcept
+{
     int result = cqe->res;
+
+    if (cqe->flags & IORING_CQE_F_BUFFER)
+    {
+        op->buffer = static_cast<uint16_t> (cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+    }
+
+    if (JOIN_UNLIKELY (cqe->flags & IORING_CQE_F_NOTIF))
+    {
+        // the kernel no longer references the buffer of the zero-copy send.
+        removePending (op);
+        dispatchRelease (op);
+        return;
+    }
+
+    if (cqe->flags & IORING_CQE_F_MORE)
+    {
+        // multishot operation still armed, or zero-copy send waiting for its buffer release.
+        dispatchMore (op, result);
+        return;
+    }
+
+    if (JOIN_UNLIKELY (!_migrations.empty ()))
+    {
+        auto it = _migrations.find (op);
+        if (it != _migrations.end ())
+        {
+            BasicProactor* target = it->second;
+            _migrations.erase (it);
+
+            if (result == -ECANCELED)
+            {
+                removePending (op);
+                op->state = IoOperation::State::Idle;
+                if (JOIN_UNLIKELY (forward (op, *target) == -1))
+                {
+                    dispatchOperation (op, -ECANCELED, true);  // LCOV_EXCL_LINE
+                }
+                return;
+            }
+        }
+    }
+
     bool cancelled = (result < 0) && (result == -ECANCELED || op->state == IoOperation::State::Cancelling);
     endOperation (op, result, cancelled);
 }
 
+// =========================================================================
+//   CLASS     : BasicProactor
+//   METHOD    : dispatchForward
+// =========================================================================
+template <typename Policy>
+void join::BasicProactor<Policy>::dispatchForward (io_uring_cqe* cqe) noexcept
+{
+    uintptr_t data = static_cast<uintptr_t> (io_uring_cqe_get_data64 (cqe));
+    IoOperation* op = reinterpret_cast<IoOperation*> (data & ~(_forwardTag | _failureTag));
+
+    if (data & _failureTag)
+    {
+        // the message didn't reach the target ring, the operation was never submitted.
+        dispatchOperation (op, cqe->res, false);
+        return;
+    }
+
+    if (JOIN_UNLIKELY (submitOperation (op, true) == -1))
+    {
+        dispatchOperation (op, -ECANCELED, true);
+    }
+}
+
 // =========================================================================
 //   CLASS     : BasicProactor
 //   METHOD    : eventLoop
@@ -33,13 +33,30 @@
 // C++.
 #include <type_traits>
 #include <algorithm>
+#include <limits>
 #include <atomic>
 
 // C.
+#include <sys/syscall.h>
+#include <linux/futex.h>
 #include <sys/types.h>
+#include <unistd.h>
+#include <climits>
 
 namespace join
 {
+    /**
+     * @brief eventcount used to park the threads waiting on a queue.
+     */
+    struct QueueEvent
+    {
+        /// incremented on each wakeup, futex word the waiters sleep on.
+        std::atomic_uint32_t _epoch;
+
+        /// number of parked or parking threads.
+        std::atomic_uint32_t _waiters;
+    };
+
     /**
      * @brief queue synchronization primitives.
      */
@@ -56,6 +73,148 @@ namespace join
 
         /// read position.
         alignas (64) std::atomic_uint64_t _tail;
+
+        /// consumers waiting for an element.
+        alignas (64) QueueEvent _notEmpty;
+
+        /// producers waiting for a free slot.
+        alignas (64) QueueEvent _notFull;
+    };
+
+    /**
+     * @brief wait policy spinning until the operation succeeds, for dedicated cores.
+     */
+    struct BusySpin
+    {
+        /**
+         * @brief wait until an operation is done.
+         * @param event queue event (unused).
+         * @param shared event shared between processes (unused).
+         * @param done operation to retry, returns true when done.
+         */
+        template <typename Operation>
+        static void wait (QueueEvent& /*event*/, bool /*shared*/, Operation&& done) noexcept
+        {
+            Backoff backoff (std::numeric_limits<size_t>::max ());
+
+            while (!done ())
+            {
+                backoff ();
+            }
+        }
+
+        /**
+         * @brief notify the waiters of an event (nothing to do, nobody parks).
+         * @param event queue event (unused).
+         * @param shared event shared between processes (unused).
+         */
+        static void notify (QueueEvent& /*event*/, bool /*shared*/) noexcept
+        {
+        }
+    };
+
+    /**
+     * @brief wait policy spinning then yielding until the operation succeeds.
+     */
+    struct SpinYield
+    {
+        /**
+         * @brief wait until an operation is done.
+         * @param event queue event (unused).
+         * @param shared event shared between processes (unused).
+         * @param done operation to retry, returns true when done.
+         */
+        template <typename Operation>
+        static void wait (QueueEvent& /*event*/, bool /*shared*/, Operation&& done) noexcept
+        {
+            Backoff backoff;
+
+            while (!done ())
+            {
+                backoff ();
+            }
+        }
+
+        /**
+         * @brief notify the waiters of an event (nothing to do, nobody parks).
+         * @param event queue event (unused).
+         * @param shared event shared between processes (unused).
+         */
+        static void notify (QueueEvent& /*event*/, bool /*shared*/) noexcept
+        {
+        }
+    };
+
+    /**
+     * @brief wait policy spinning for a while then parking on a futex until the queue state changes.
+     * @note every producer and consumer of a queue must use this policy, or the parked ones are never woken up.
+     */
+    struct SpinPark
+    {
+        /// number of spin iterations before parking.
+        static constexpr size_t _spin = 200;
+
+        /**
+         * @brief wait until an operation is done.
+         * @param event queue event to park on.
+         * @param shared event shared between processes.
+         * @param done operation to retry, returns true when done.
+         */
+        template <typename Operation>
+        static void wait (QueueEvent& event, bool shared, Operation&& done) noexcept
+        {
+            Backoff backoff (_spin);
+
+            for (size_t i = 0; i < _spin; ++i)
+            {
+                if (done ())
+                {
+                    return;
+                }
+
+                backoff ();
+            }
+
+            for (;;)
+            {
+                // read the epoch before registering, a notify done after the retry below changes it.
+                uint32_t epoch = event._epoch.load (std::memory_order_acquire);
+                event._waiters.fetch_add (1, std::memory_order_seq_cst);
+
+                if (done ())
+                {
+                    event._waiters.fetch_sub (1, std::memory_order_relaxed);
+                    return;
+                }
+
+                ::syscall (SYS_futex, reinterpret_cast<uint32_t*> (&event._epoch),
+                           shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE, epoch, nullptr, nullptr, 0);
+                event._waiters.fetch_sub (1, std::memory_order_relaxed);
+
+                if (done ())
+                {
+                    return;
+                }
+            }
+        }
+
+        /**
+         * @brief wake up the waiters of an event, if any.
+         * @param event queue event.
+         * @param shared event shared between processes.
+         */
+        static void notify (QueueEvent& event, bool shared) noexcept
+        {
+            // pairs with the registration of the waiters, either they see the new state or we see them.
+            std::atomic_thread_fence (std::memory_order_seq_cst);
+
+            if (JOIN_UNLIKELY (event._waiters.load (std::memory_order_relaxed) != 0))
+            {
+                event._epoch.fetch_add (1, std::memory_order_release);
+                ::syscall (SYS_futex, reinterpret_cast<uint32_t*> (&event._epoch),
+                           shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+            }
+        }
     };
 
     /**
@@ -118,10 +277,27 @@ namespace join
     {
     };
 
+    /**
+     * @brief primary trait: backends are private to the process by default.
+     * @tparam Backend memory backend type.
+     */
+    template <typename Backend>
+    struct is_shared : std::false_type
+    {
+    };
+
+    /**
+     * @brief specialization for shared memory: the queue may be used by several processes.
+     */
+    template <>
+    struct is_shared<ShmMem> : std::true_type
+    {
+    };
+
     /**
      * @brief queue base class.
      */
-    template <typename Type, typename Backend, typename SyncPolicy>
+    template <typename Type, typename Backend, typename SyncPolicy, typename WaitPolicy = SpinYield>
     class BasicQueue
     {
         static_assert (std::is_trivially_copyable<Type>::value, "type must be trivially copyable");
@@ -154,6 +330,10 @@ namespace join
             {
                 _segment->_sync._head.store (0, std::memory_order_relaxed);
                 _segment->_sync._tail.store (0, std::memory_order_relaxed);
+                _segment->_sync._notEmpty._epoch.store (0, std::memory_order_relaxed);
+                _segment->_sync._notEmpty._waiters.store (0, std::memory_order_relaxed);
+                _segment->_sync._notFull._epoch.store (0, std::memory_order_relaxed);
+                _segment->_sync._notFull._waiters.store (0, std::memory_order_relaxed);
 
                 initSlots<needs_seq<SyncPolicy>::value> ();
 
@@ -207,7 +387,12 @@ namespace join
          */
         int tryPush (const Type& element) noexcept
         {
-            return SyncPolicy::tryPush (_segment, element, _cachedTail, _capacity, _mask);
+            int result = SyncPolicy::tryPush (_segment, element, _cachedTail, _capacity, _mask);
+            if (result != -1)
+            {
+                WaitPolicy::notify (_segment->_sync._notEmpty, _shared);
+            }
+            return result;
         }
 
         /**
@@ -218,61 +403,64 @@ namespace join
          */
         ssize_t tryPush (const Type* elements, size_t size) noexcept
         {
-            return SyncPolicy::tryPush (_segment, elements, size, _cachedTail, _capacity, _mask);
+            ssize_t result = SyncPolicy::tryPush (_segment, elements, size, _cachedTail, _capacity, _mask);
+            if (result > 0)
+            {
+                WaitPolicy::notify (_segment->_sync._notEmpty, _shared);
+            }
+            return result;
         }
 
         /**
-         * @brief push element into the ring buffer.
+         * @brief push element into the ring buffer, waiting for a free slot.
          * @param element element to push.
          * @return 0 on success, -1 otherwise.
          */
         int push (const Type& element) noexcept
         {
-            Backoff backoff;
+            int result = -1;
 
-            while (tryPush (element) == -1)
-            {
-                if (JOIN_UNLIKELY (lastError != Errc::TemporaryError))
-                {
-                    return -1;  // LCOV_EXCL_LINE
-                }
+            WaitPolicy::wait (_segment->_sync._notFull, _shared, [&] () {
+                result = tryPush (element);
+                return (result != -1) || JOIN_UNLIKELY (lastError != Errc::TemporaryError);
+            });
 
-                backoff ();
-            }
-
-            return 0;
+            return result;
         }
 
         /**
-         * @brief push multiple elements into the ring buffer.
+         * @brief push multiple elements into the ring buffer, waiting for free slots.
          * @param elements pointer to the first element.
          * @param size number of elements to push.
          * @return 0 on success, -1 otherwise.
          */
         int push (const Type* elements, size_t size) noexcept
         {
-            Backoff backoff;
             uint64_t pushed = 0;
+            int result = 0;
 
-            while (pushed < size)
+            if (size == 0)
             {
+                return 0;
+            }
+
+            WaitPolicy::wait (_segment->_sync._notFull, _shared, [&] () {
                 ssize_t n = tryPush (elements + pushed, size - pushed);
                 if (n == -1)
                 {
                     if (JOIN_UNLIKELY (lastError != Errc::TemporaryError))
                     {
-                        return -1;
+                        result = -1;
+                        return true;
                     }
 
-                    backoff ();  // LCOV_EXCL_LINE
-                }
-                else
-                {
-                    pushed += static_cast<uint64_t> (n);
+                    return false;  // LCOV_EXCL_LINE
                 }
-            }
+                pushed += static_cast<uint64_t> (n);
+                return pushed >= size;
+            });
 
-            return 0;
+            return result;
         }
 
         /**
@@ -282,7 +470,12 @@ namespace join
          */
         int tryPop (Type& element) noexcept
         {
-            return SyncPolicy::tryPop (_segment, element, _cachedHead, _capacity, _mask);
+            int result = SyncPolicy::tryPop (_segment, element, _cachedHead, _capacity, _mask);
+            if (result != -1)
+            {
+                WaitPolicy::notify (_segment->_sync._notFull, _shared);
+            }
+            return result;
         }
 
         /**
@@ -293,61 +486,64 @@ namespace join
          */
         ssize_t tryPop (Type* elements, size_t size) noexcept
         {
-            return SyncPolicy::tryPop (_segment, elements, size, _cachedHead, _capacity, _mask);
+            ssize_t result = SyncPolicy::tryPop (_segment, elements, size, _cachedHead, _capacity, _mask);
+            if (result > 0)
+            {
+                WaitPolicy::notify (_segment->_sync._notFull, _shared);
+            }
+            return result;
         }
 
         /**
-         * @brief pop element from the ring buffer.
+         * @brief pop element from the ring buffer, waiting for an element.
          * @param element output element.
          * @return 0 on success, -1 otherwise.
          */
         int pop (Type& element) noexcept
         {
-            Backoff backoff;
+            int result = -1;
 
-            while (tryPop (element) == -1)
-            {
-                if (JOIN_UNLIKELY (lastError != Errc::TemporaryError))
-                {
-                    return -1;  // LCOV_EXCL_LINE
-                }
-
-                backoff ();
-            }
+            WaitPolicy::wait (_segment->_sync._notEmpty, _shared, [&] () {
+                result = tryPop (element);
+                return (result != -1) || JOIN_UNLIKELY (lastError != Errc::TemporaryError);
+            });
 
-            return 0;
+            return result;
         }
 
         /**
-         * @brief pop multiple elements from the ring buffer.
+         * @brief pop multiple elements from the ring buffer, waiting for elements.
          * @param elements pointer to the output buffer.
          * @param size number of elements to pop.
          * @return 0 on success, -1 otherwise.
          */
         int pop (Type* elements, size_t size) noexcept
         {
-            Backoff backoff;
             uint64_t popped = 0;
+            int result = 0;
 
-            while (popped < size)
+            if (size == 0)
             {
+                return 0;
+            }
+
+            WaitPolicy::wait (_segment->_sync._notEmpty, _shared, [&] () {
                 ssize_t n = tryPop (elements + popped, size - popped);
                 if (n == -1)
                 {
                     if (JOIN_UNLIKELY (lastError != Errc::TemporaryError))
                     {
-                        return -1;
+                        result = -1;
+                        return true;
                     }
 
-                    backoff ();  // LCOV_EXCL_LINE
-                }
-                else
-                {
-                    popped += static_cast<uint64_t> (n);
+                    return false;  // LCOV_EXCL_LINE
                 }
-            }
+                popped += static_cast<uint64_t> (n);
+                return popped >= size;
+            });
 
-            return 0;
+            return result;
         }
 
         /**
@@ -468,6 +664,9 @@ namespace join
             }
         }
 
+        /// waiters may be in another process.
+        static constexpr bool _shared = is_shared<Backend>::value;
+
         /// memory segment capacity.
         const uint64_t _capacity = 0;
 
@@ -1080,9 +1279,9 @@ namespace join
     template <typename Backend, template <typename, typename> class SyncPolicy>
     struct SyncBinding
     {
-        /// queue type alias combining backend and policy.
-        template <typename Type>
-        using Queue = BasicQueue<Type, Backend, SyncPolicy<Type, Backend>>;
+        /// queue type alias combining backend, synchronization and wait policies.
+        template <typename Type, typename WaitPolicy = SpinYield>
+        using Queue = BasicQueue<Type, Backend, SyncPolicy<Type, Backend>, WaitPolicy>;
     };
 }
 
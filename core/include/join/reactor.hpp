@@ -27,12 +27,18 @@
 
 // libjoin.
 #include <join/thread.hpp>
+#include <join/mutex.hpp>
 #include <join/queue.hpp>
+#include <join/cpu.hpp>
+#ifdef JOIN_HAS_REACTOR_STATS
+#include <join/statistics.hpp>
+#endif
 
 // C++.
 #include <unordered_map>
-#include <unordered_set>
 #include <atomic>
+#include <vector>
+#include <deque>
 
 // C.
 #include <sys/epoll.h>
@@ -122,6 +128,41 @@ namespace join
         friend class Reactor;
     };
 
+#ifdef JOIN_HAS_REACTOR_STATS
+    /**
+     * @brief Reactor event loop statistics.
+     */
+    struct ReactorStats
+    {
+        /**
+         * @brief reset all collectors.
+         */
+        void reset () noexcept
+        {
+            events.reset ();
+            dispatch.reset ();
+            commands.reset ();
+            latency.reset ();
+            slowest.store (-1, std::memory_order_relaxed);
+        }
+
+        /// number of events returned by each epoll_wait call.
+        Counter::Stats events{"events"};
+
+        /// time spent by a handler on each dispatched event.
+        Monotonic::Stats dispatch{"dispatch"};
+
+        /// number of commands pending on each command queue drain.
+        Counter::Stats commands{"commands"};
+
+        /// time from command enqueue to execution.
+        Monotonic::Stats latency{"latency"};
+
+        /// file descriptor whose handler took the longest dispatch.
+        std::atomic<int> slowest{-1};
+    };
+#endif
+
     /**
      * @brief Reactor class.
      */
@@ -129,9 +170,19 @@ namespace join
     {
     public:
         /**
-         * @brief default constructor.
+         * @brief handler registration flags.
          */
-        Reactor ();
+        enum Flags : uint32_t
+        {
+            EdgeTriggered = EPOLLET,    /**< only report readiness changes, the handler must drain the fd. */
+            Exclusive = EPOLLEXCLUSIVE, /**< wake only one of the reactors watching the same fd. */
+        };
+
+        /**
+         * @brief create instance.
+         * @param spin number of empty non blocking polls before blocking (0 to always block).
+         */
+        explicit Reactor (uint32_t spin = 0);
 
         /**
          * @brief copy constructor.
@@ -171,16 +222,20 @@ namespace join
          * @param wantRead subscribe to read events.
          * @param wantWrite subscribe to write events.
          * @param sync wait for operation completion if true.
+         * @param flags registration flags (EdgeTriggered, Exclusive).
          * @return 0 on success, -1 on failure.
+         * @note an exclusive registration can't be updated, the handler must be deleted and added again.
+         * @note applied by the calling thread when no event loop runs.
          */
-        int addHandler (int fd, EventHandler* handler, bool wantRead = true, bool wantWrite = false,
-                        bool sync = true) noexcept;
+        int addHandler (int fd, EventHandler* handler, bool wantRead = true, bool wantWrite = false, bool sync = true,
+                        uint32_t flags = 0) noexcept;
 
         /**
          * @brief delete handler from reactor.
          * @param fd file descriptor.
          * @param sync wait for operation completion if true.
          * @return 0 on success, -1 on failure.
+         * @note applied by the calling thread when no event loop runs.
          */
         int delHandler (int fd, bool sync = true) noexcept;
 
@@ -195,6 +250,18 @@ namespace join
          */
         void stop (bool sync = true) noexcept;
 
+        /**
+         * @brief set the number of empty non blocking polls before blocking.
+         * @param spin number of polls (0 to always block).
+         */
+        void spin (uint32_t spin) noexcept;
+
+        /**
+         * @brief get the number of empty non blocking polls before blocking.
+         * @return number of polls.
+         */
+        uint32_t spin () const noexcept;
+
 #ifdef JOIN_HAS_NUMA
         /**
          * @brief bind command queue memory to a NUMA node.
@@ -222,9 +289,17 @@ namespace join
          */
         bool isReactorThread () const noexcept;
 
+#ifdef JOIN_HAS_REACTOR_STATS
+        /**
+         * @brief get event loop statistics.
+         * @return a live reference, concurrently updated by the reactor thread (not a snapshot).
+         */
+        ReactorStats& stats () noexcept;
+#endif
+
     private:
-        /// deleted handlers reserve size.
-        static constexpr size_t _deletedReserve = 64;
+        /// handler table reserve size.
+        static constexpr size_t _handlersReserve = 1024;
 
         /// queue size.
         static constexpr size_t _queueSize = 1024;
@@ -253,6 +328,21 @@ namespace join
             EventHandler* handler;
             std::atomic<bool>* done;
             std::error_code* errc;
+#ifdef JOIN_HAS_REACTOR_STATS
+            Monotonic::TimePoint enqueued = Monotonic::now ();
+#endif
+        };
+
+        /**
+         * @brief handler table entry, indexed by file descriptor.
+         */
+        struct Slot
+        {
+            /// registered handler, nullptr if none.
+            EventHandler* handler = nullptr;
+
+            /// registration generation, events of a previous registration are dropped.
+            uint32_t generation = 0;
         };
 
         /**
@@ -271,6 +361,12 @@ namespace join
          */
         int unregisterHandler (int fd) noexcept;
 
+        /**
+         * @brief clear handler table entry, pending events of the registration are dropped.
+         * @param fd file descriptor.
+         */
+        void release (int fd) noexcept;
+
         /**
          * @brief write command to queue and wake dispatcher.
          * @param cmd command to write.
@@ -278,6 +374,28 @@ namespace join
          */
         int writeCommand (const Command& cmd) noexcept;
 
+        /**
+         * @brief wait for a command to be processed, processing it here if the event loop exits first.
+         * @param done flag set once the command is processed.
+         */
+        void waitCommand (const std::atomic<bool>& done) noexcept;
+
+        /**
+         * @brief process the queued commands if no event loop runs.
+         * @return true if no event loop runs.
+         */
+        bool drainCommands () noexcept;
+
+        /**
+         * @brief process the queued commands, the loop mutex must be held and no event loop running.
+         */
+        void flushCommands () noexcept;
+
+        /**
+         * @brief unlock the loop mutex, processing the commands queued while it was held.
+         */
+        void unlockLoop () noexcept;
+
         /**
          * @brief process a single command.
          * @param cmd command to process.
@@ -300,13 +418,6 @@ namespace join
          */
         void eventLoop ();
 
-        /**
-         * @brief check if handler is active.
-         * @param fd file descriptor.
-         * @return true if handler is active, false otherwise.
-         */
-        bool isActive (int fd) const noexcept;
-
         /// eventfd descriptor.
         int _wakeup = -1;
 
@@ -316,14 +427,14 @@ namespace join
         /// coalesce eventfd writes.
         alignas (64) std::atomic<bool> _notified{false};
 
+        /// number of empty non blocking polls before blocking.
+        std::atomic<uint32_t> _spin;
+
         /// command queue
         LocalMem::Mpsc::Queue<Command> _commands;
 
-        /// registered handlers
-        std::unordered_map<int, EventHandler*> _handlers;
-
-        /// deleted handlers.
-        std::unordered_set<int> _deleted;
+        /// registered handlers indexed by file descriptor.
+        std::vector<Slot> _handlers;
 
         /// running flag for dispatcher thread.
         std::atomic<bool> _running{false};
@@ -333,6 +444,17 @@ namespace join
 
         /// event loop thread ID.
         std::atomic<pthread_t> _threadId{_invalidThreadId};
+
+        /// held by the event loop, or by a thread updating the handlers while no event loop runs.
+        Mutex _loop;
+
+        /// a stop was requested while no event loop ran, protected by the loop mutex.
+        bool _stopped = false;
+
+#ifdef JOIN_HAS_REACTOR_STATS
+        /// event loop statistics.
+        ReactorStats _stats;
+#endif
     };
 
     /**
@@ -394,6 +516,14 @@ namespace join
          */
         static int mlock ();
 
+#ifdef JOIN_HAS_REACTOR_STATS
+        /**
+         * @brief get event loop statistics.
+         * @return a live reference, concurrently updated by the reactor thread (not a snapshot).
+         */
+        static ReactorStats& stats ();
+#endif
+
     private:
         /**
          * @brief get the singleton ReactorThread instance.
@@ -443,6 +573,217 @@ namespace join
         /// Background thread.
         Thread _dispatcher;
     };
+
+    /**
+     * @brief Group of reactors each running on its own thread pinned to a different core.
+     */
+    class ReactorGroup
+    {
+    public:
+        /**
+         * @brief handler placement policy.
+         */
+        enum class Placement
+        {
+            RoundRobin,  /**< spread handlers over the reactors in turn. */
+            LeastLoaded, /**< pick the reactor with the fewest handlers. */
+            IncomingCpu, /**< pick the reactor pinned to the CPU handling the socket (SO_INCOMING_CPU). */
+        };
+
+        /**
+         * @brief create the reactor group and start the event loop threads.
+         * @param reactors number of reactors (default: one per physical core).
+         * @param placement handler placement policy.
+         * @param spin number of empty non blocking polls before a reactor blocks (0 to always block).
+         */
+        explicit ReactorGroup (int reactors = int (CpuTopology::instance ()->cores ().size ()),
+                               Placement placement = Placement::RoundRobin, uint32_t spin = 0);
+
+        /**
+         * @brief copy constructor.
+         * @param other other object to copy.
+         */
+        ReactorGroup (const ReactorGroup& other) = delete;
+
+        /**
+         * @brief copy assignment operator.
+         * @param other other object to copy.
+         * @return current object.
+         */
+        ReactorGroup& operator= (const ReactorGroup& other) = delete;
+
+        /**
+         * @brief move constructor.
+         * @param other other object to move.
+         */
+        ReactorGroup (ReactorGroup&& other) = delete;
+
+        /**
+         * @brief move assignment operator.
+         * @param other other object to move.
+         * @return current object.
+         */
+        ReactorGroup& operator= (ReactorGroup&& other) = delete;
+
+        /**
+         * @brief stop the event loops and join the threads.
+         */
+        ~ReactorGroup ();
+
+        /**
+         * @brief add handler to the reactor chosen by the placement policy.
+         * @param fd file descriptor.
+         * @param handler handler pointer.
+         * @param wantRead subscribe to read events.
+         * @param wantWrite subscribe to write events.
+         * @param sync wait for operation completion if true.
+         * @param flags registration flags (see Reactor::Flags).
+         * @return 0 on success, -1 on failure.
+         */
+        int addHandler (int fd, EventHandler* handler, bool wantRead = true, bool wantWrite = false, bool sync = true,
+                        uint32_t flags = 0) noexcept;
+
+        /**
+         * @brief add handler to the given reactor.
+         * @param index reactor index.
+         * @param fd file descriptor.
+         * @param handler handler pointer.
+         * @param wantRead subscribe to read events.
+         * @param wantWrite subscribe to write events.
+         * @param sync wait for operation completion if true.
+         * @param flags registration flags (see Reactor::Flags).
+         * @return 0 on success, -1 on failure.
+         * @note an fd can be added to several reactors only if all its registrations are exclusive.
+         */
+        int addHandler (size_t index, int fd, EventHandler* handler, bool wantRead = true, bool wantWrite = false,
+                        bool sync = true, uint32_t flags = 0) noexcept;
+
+        /**
+         * @brief delete handler from the reactors it was added to.
+         * @param fd file descriptor.
+         * @param sync wait for operation completion if true.
+         * @return 0 on success, -1 on failure.
+         */
+        int delHandler (int fd, bool sync = true) noexcept;
+
+        /**
+         * @brief get the number of reactors.
+         * @return number of reactors.
+         */
+        size_t size () const noexcept;
+
+        /**
+         * @brief get reactor.
+         * @param index reactor index.
+         * @return reactor.
+         */
+        Reactor& reactor (size_t index);
+
+        /**
+         * @brief get the index of the reactor a handler was added to (the first one if several).
+         * @param fd file descriptor.
+         * @return reactor index, -1 if the handler wasn't added to the group.
+         */
+        int indexOf (int fd) const;
+
+        /**
+         * @brief get the number of handlers added to a reactor.
+         * @param index reactor index.
+         * @return number of handlers.
+         */
+        size_t load (size_t index) const;
+
+        /**
+         * @brief get the core a reactor thread is pinned to.
+         * @param index reactor index.
+         * @return core or -1 if not pinned.
+         */
+        int affinity (size_t index) const;
+
+        /**
+         * @brief set handler placement policy.
+         * @param placement handler placement policy.
+         */
+        void placement (Placement placement) noexcept;
+
+        /**
+         * @brief get handler placement policy.
+         * @return handler placement policy.
+         */
+        Placement placement () const noexcept;
+
+        /**
+         * @brief lock command queues memory in RAM.
+         * @return 0 on success, -1 on failure.
+         */
+        int mlock ();
+
+    private:
+        /**
+         * @brief reactor running on its own thread.
+         */
+        struct Shard
+        {
+            /**
+             * @brief create the reactor and start its event loop.
+             * @param core core to pin the thread to (-1 no pinning).
+             * @param numa NUMA node of the core (-1 unknown).
+             * @param spin number of empty non blocking polls before blocking.
+             */
+            Shard (int core, int numa, uint32_t spin);
+
+            /**
+             * @brief stop the event loop and join the thread.
+             */
+            ~Shard ();
+
+            /// reactor.
+            Reactor reactor;
+
+            /// event loop thread.
+            Thread thread;
+
+            /// pinned core.
+            int core;
+
+            /// number of handlers.
+            std::atomic<size_t> handlers{0};
+        };
+
+        /**
+         * @brief reactors a handler was added to.
+         */
+        struct Owner
+        {
+            /// reactor indexes.
+            std::vector<size_t> indexes;
+
+            /// handler registered with the exclusive flag.
+            bool exclusive = false;
+        };
+
+        /**
+         * @brief choose the reactor of a new handler.
+         * @param fd file descriptor.
+         * @return reactor index.
+         */
+        size_t choose (int fd) noexcept;
+
+        /// reactors.
+        std::deque<Shard> _shards;
+
+        /// placement policy.
+        std::atomic<Placement> _placement;
+
+        /// next reactor for round robin placement.
+        std::atomic<size_t> _next{0};
+
+        /// reactors of each handler.
+        std::unordered_map<int, Owner> _owners;
+
+        /// protect handler owners.
+        mutable Mutex _mutex;
+    };
 }
 
 #endif
@@ -370,6 +370,32 @@ namespace join
             return size;
         }
 
+        /**
+         * @brief read data without removing it from the socket receive queue.
+         * @param data buffer used to store the data received.
+         * @param maxSize maximum number of bytes to read.
+         * @return the number of bytes received, -1 on failure.
+         */
+        int peek (char* data, unsigned long maxSize) noexcept
+        {
+            int size = ::recv (_handle, data, maxSize, MSG_PEEK);
+            if (size < 1)
+            {
+                if (size == -1)
+                {
+                    lastError = std::error_code (errno, std::generic_category ());
+                }
+                else
+                {
+                    lastError = make_error_code (Errc::ConnectionClosed);
+                }
+
+                return -1;
+            }
+
+            return size;
+        }
+
         /**
          * @brief block until at least one byte can be written.
          * @param timeout timeout in milliseconds.
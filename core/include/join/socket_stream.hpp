@@ -33,6 +33,9 @@
 #include <utility>
 #include <memory>
 
+// C.
+#include <cstring>
+
 namespace join
 {
     /**
@@ -45,12 +48,14 @@ namespace join
         using Endpoint = typename Protocol::Endpoint;
         using Socket = typename Protocol::Socket;
 
+        /// size of the internal buffer (get and put areas).
+        static constexpr std::streamsize bufferSize = 8192;
+
         /**
          * @brief default constructor.
          */
         BasicSocketStreambuf ()
-        : _buf (std::make_unique<char[]> (2 * _bufsize))
-        , _socket (Socket::Mode::NonBlocking)
+        : _socket (Socket::Mode::NonBlocking)
         {
         }
 
@@ -59,8 +64,7 @@ namespace join
          * @param socket socket to move in.
          */
         explicit BasicSocketStreambuf (Socket&& socket)
-        : _buf (std::make_unique<char[]> (2 * _bufsize))
-        , _socket (std::move (socket))
+        : _socket (std::move (socket))
         {
         }
 
@@ -85,6 +89,7 @@ namespace join
         : std::streambuf (std::move (other))
         , _buf (std::move (other._buf))
         , _timeout (other._timeout)
+        , _received (other._received)
         , _socket (std::move (other._socket))
         {
         }
@@ -101,6 +106,7 @@ namespace join
             std::streambuf::operator= (std::move (other));
             _buf = std::move (other._buf);
             _timeout = other._timeout;
+            _received = other._received;
             _socket = std::move (other._socket);
 
             return *this;
@@ -219,6 +225,108 @@ namespace join
             return _socket;
         }
 
+        /**
+         * @brief check if the internal buffer is allocated.
+         * the internal buffer is allocated on first use unless one is attached.
+         * @return true if allocated, false otherwise.
+         */
+        bool hasBuffer () const noexcept
+        {
+            return _buf != nullptr;
+        }
+
+        /**
+         * @brief attach an internal buffer of bufferSize bytes, nothing is done if one is already allocated.
+         * @param buf buffer to attach.
+         */
+        void attachBuffer (std::unique_ptr<char[]> buf) noexcept
+        {
+            if (_buf == nullptr)
+            {
+                _buf = std::move (buf);
+            }
+        }
+
+        /**
+         * @brief detach the internal buffer when nothing is buffered, it is allocated again on next use.
+         * @return detached buffer, nullptr if data are still buffered.
+         */
+        std::unique_ptr<char[]> detachBuffer () noexcept
+        {
+            if ((gptr () != egptr ()) || (pptr () != pbase ()))
+            {
+                return nullptr;
+            }
+
+            setg (nullptr, nullptr, nullptr);
+            setp (nullptr, nullptr);
+
+            return std::move (_buf);
+        }
+
+        /**
+         * @brief read the data available on the socket into the get area without blocking.
+         * @return number of bytes read (0 if the get area is full), -1 on failure.
+         */
+        std::streamsize prefetch ()
+        {
+            if (!_socket.connected ())
+            {
+                lastError = make_error_code (Errc::ConnectionClosed);
+                return -1;
+            }
+
+            if (eback () == nullptr)
+            {
+                setg (buffer (), buffer (), buffer ());
+            }
+
+            std::streamsize avail = egptr () - gptr ();
+            if (gptr () != eback ())
+            {
+                std::memmove (eback (), gptr (), avail);
+                setg (eback (), eback (), eback () + avail);
+            }
+
+            if (avail == _bufsize)
+            {
+                return 0;
+            }
+
+            int nread = _socket.read (egptr (), _bufsize - avail);
+            if (nread == -1)
+            {
+                if (lastError != Errc::TemporaryError)
+                {
+                    _socket.close ();
+                }
+                return -1;
+            }
+
+            setg (eback (), gptr (), egptr () + nread);
+            _received += nread;
+
+            return nread;
+        }
+
+        /**
+         * @brief get the buffered input sequence.
+         * @return a pointer to the first unread character of the get area.
+         */
+        const char* pending () const noexcept
+        {
+            return gptr ();
+        }
+
+        /**
+         * @brief get the number of bytes consumed from the input sequence.
+         * @return number of bytes read from the socket and taken out of the get area.
+         */
+        std::streamoff consumed () const noexcept
+        {
+            return _received - (egptr () - gptr ());
+        }
+
     protected:
         /**
          * @brief reads characters from the associated input sequence to the get area.
@@ -234,7 +342,7 @@ namespace join
 
             if (eback () == nullptr)
             {
-                setg (_buf.get (), _buf.get (), _buf.get ());
+                setg (buffer (), buffer (), buffer ());
             }
 
             if (gptr () == egptr ())
@@ -256,6 +364,7 @@ namespace join
                     }
 
                     setg (eback (), eback (), eback () + nread);
+                    _received += nread;
                     break;
                 }
             }
@@ -278,7 +387,13 @@ namespace join
 
             if (pbase () == nullptr)
             {
-                setp (_buf.get () + _bufsize, _buf.get () + (2 * _bufsize));
+                // nothing was ever written, nothing to flush.
+                if (c == traits_type::eof ())
+                {
+                    return traits_type::not_eof (c);
+                }
+
+                setp (buffer () + _bufsize, buffer () + (2 * _bufsize));
             }
 
             if ((pptr () == epptr ()) || (c == traits_type::eof ()))
@@ -317,8 +432,22 @@ namespace join
             return 0;
         }
 
+        /**
+         * @brief get the internal buffer, allocating it if needed.
+         * @return internal buffer.
+         */
+        char* buffer ()
+        {
+            if (_buf == nullptr)
+            {
+                _buf = std::make_unique<char[]> (bufferSize);
+            }
+
+            return _buf.get ();
+        }
+
         /// internal buffer size.
-        static const std::streamsize _bufsize = 4096;
+        static const std::streamsize _bufsize = bufferSize / 2;
 
         /// internal buffer.
         std::unique_ptr<char[]> _buf;
@@ -326,6 +455,9 @@ namespace join
         /// timeout.
         int _timeout = 30000;
 
+        /// number of bytes read from the socket.
+        std::streamoff _received = 0;
+
         /// internal socket.
         Socket _socket;
     };
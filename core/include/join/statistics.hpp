@@ -34,6 +34,7 @@
 #include <iomanip>
 #include <ostream>
 #include <sstream>
+#include <type_traits>
 #include <limits>
 #include <atomic>
 
@@ -128,8 +129,16 @@ namespace join
          */
         void stop (TimePoint startTime) noexcept
         {
-            const uint64_t ns =
-                static_cast<uint64_t> (std::chrono::duration_cast<Duration> (ClockPolicy::now () - startTime).count ());
+            record (std::chrono::duration_cast<Duration> (ClockPolicy::now () - startTime));
+        }
+
+        /**
+         * @brief record an already measured interval and update all aggregates.
+         * @param value measured duration (or any sample expressed in nanoseconds units).
+         */
+        void record (Duration value) noexcept
+        {
+            const uint64_t ns = static_cast<uint64_t> (std::max (value.count (), typename Duration::rep (0)));
 
             _sum.fetch_add (ns, std::memory_order_relaxed);
             _last.store (ns, std::memory_order_relaxed);
@@ -216,14 +225,14 @@ namespace join
          * @brief arithmetic mean of all completed intervals.
          * @return mean measured duration, or zero if no interval has been recorded.
          */
-        std::chrono::duration<double, std::nano> mean () const noexcept
+        std::chrono::duration<double, typename Duration::period> mean () const noexcept
         {
             const auto count = _count.load (std::memory_order_acquire);
             if (count == 0)
             {
-                return std::chrono::duration<double, std::nano> (0.0);
+                return std::chrono::duration<double, typename Duration::period> (0.0);
             }
-            return std::chrono::duration<double, std::nano> (
+            return std::chrono::duration<double, typename Duration::period> (
                 static_cast<double> (_sum.load (std::memory_order_relaxed)) / static_cast<double> (count));
         }
 
@@ -273,6 +282,45 @@ namespace join
             return Duration (static_cast<typename Duration::rep> (_maxTrackableValue));
         }
 
+        /**
+         * @brief add the intervals recorded by another collector (e.g. a per thread collector).
+         * @param other statistics to merge.
+         */
+        void merge (const BasicStats& other) noexcept
+        {
+            const uint64_t count = other._count.load (std::memory_order_acquire);
+            if (count == 0)
+            {
+                return;
+            }
+
+            _sum.fetch_add (other._sum.load (std::memory_order_relaxed), std::memory_order_relaxed);
+            _last.store (other._last.load (std::memory_order_relaxed), std::memory_order_relaxed);
+
+            const auto min = other._min.load (std::memory_order_relaxed);
+            auto prev = _min.load (std::memory_order_relaxed);
+            while (min < prev &&
+                   !_min.compare_exchange_weak (prev, min, std::memory_order_relaxed, std::memory_order_relaxed))
+                ;
+
+            const auto max = other._max.load (std::memory_order_relaxed);
+            prev = _max.load (std::memory_order_relaxed);
+            while (max > prev &&
+                   !_max.compare_exchange_weak (prev, max, std::memory_order_relaxed, std::memory_order_relaxed))
+                ;
+
+            for (int i = 0; i < _countsLen; ++i)
+            {
+                const auto n = other._counts[i].load (std::memory_order_relaxed);
+                if (n != 0)
+                {
+                    _counts[i].fetch_add (n, std::memory_order_relaxed);
+                }
+            }
+
+            _count.fetch_add (count, std::memory_order_release);
+        }
+
 #ifdef JOIN_HAS_NUMA
         /**
          * @brief bind histogram memory to a NUMA node.
@@ -555,15 +603,22 @@ namespace join
     template <class ClockPolicy>
     inline std::ostream& operator<< (std::ostream& out, const BasicStats<ClockPolicy>& statistics)
     {
+        // counts are printed as is, without unit nor throughput.
+        const bool dimensionless = std::is_same<ClockPolicy, Counter>::value;
+
         // latency scale.
         const long lscale = [&] {
             const long s = out.iword (details::latencyScaleIndex ());
-            return s == 0 ? 1L : s;
+            return (s == 0 || dimensionless) ? 1L : s;
         }();
 
         const double dlscale = static_cast<double> (lscale);
         const char* lunit = "ns";
-        if (lscale == 1'000'000'000)
+        if (dimensionless)
+        {
+            lunit = "";
+        }
+        else if (lscale == 1'000'000'000)
         {
             lunit = "s";
         }
@@ -609,11 +664,22 @@ namespace join
 
         auto printLatCol = [&] (double v) {
             std::ostringstream ss;
-            ss << std::fixed << std::setprecision (out.precision ()) << v << " (" << lunit << ")";
+            ss << std::fixed << std::setprecision (out.precision ()) << v;
+            if (*lunit != '\0')
+            {
+                ss << " (" << lunit << ")";
+            }
             out << std::setw (details::colLatency) << ss.str ();
         };
         std::ostringstream oss;
-        oss << std::fixed << std::setprecision (out.precision ()) << thr / dtscale << " (" << tunit << ")";
+        if (dimensionless)
+        {
+            oss << "-";
+        }
+        else
+        {
+            oss << std::fixed << std::setprecision (out.precision ()) << thr / dtscale << " (" << tunit << ")";
+        }
         out << std::left << std::setw (details::colMetric) << statistics.name () << std::right
             << std::setw (details::colCount) << count << std::setw (details::colThroughput) << oss.str ();
         printLatCol (static_cast<double> (min.count ()) / dlscale);
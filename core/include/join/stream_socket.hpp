@@ -29,9 +29,11 @@
 #include <join/socket.hpp>
 
 // C++.
+#include <algorithm>
 #include <chrono>
 
 // C.
+#include <linux/errqueue.h>
 #include <sys/socket.h>
 
 namespace join
@@ -333,6 +335,81 @@ namespace join
             return 0;
         }
 
+        /**
+         * @brief write data until size is reached without copying it, then wait for the kernel to release the buffer.
+         * @param data data buffer to send, must not be modified before the method returns.
+         * @param size number of bytes to write.
+         * @param timeout timeout in milliseconds.
+         * @return 0 on success, -1 on failure.
+         */
+        int writeZeroCopy (const char* data, unsigned long size, int timeout = 0) noexcept
+        {
+            if (this->_state == State::Closed)
+            {
+                lastError = make_error_code (Errc::OperationFailed);
+                return -1;
+            }
+
+            int on = 1;
+
+            if (::setsockopt (this->_handle, SOL_SOCKET, SO_ZEROCOPY, &on, sizeof (on)) == -1)
+            {
+                lastError = std::error_code (errno, std::generic_category ());
+                return -1;
+            }
+
+            unsigned long numWrite = 0;
+            uint64_t pending = 0;
+
+            while (numWrite < size)
+            {
+                ssize_t result = ::send (this->_handle, data + numWrite, size - numWrite, MSG_ZEROCOPY);
+                if (result == -1)
+                {
+                    // unread notifications are charged to the socket option memory.
+                    if ((errno == ENOBUFS) && (pending > 0))
+                    {
+                        int released = readNotifications (timeout);
+                        if (released == -1)
+                        {
+                            return -1;
+                        }
+
+                        pending -= std::min (pending, uint64_t (released));
+                        continue;
+                    }
+
+                    lastError = std::error_code (errno, std::generic_category ());
+
+                    if (lastError == Errc::TemporaryError)
+                    {
+                        if (this->waitReadyWrite (timeout))
+                        {
+                            continue;
+                        }
+                    }
+
+                    return -1;
+                }
+
+                numWrite += result;
+                ++pending;
+            }
+
+            while (pending > 0)
+            {
+                int released = readNotifications (timeout);
+                if (released == -1)
+                {
+                    return -1;
+                }
+
+                pending -= std::min (pending, uint64_t (released));
+            }
+
+            return 0;
+        }
+
         /**
          * @brief set the given option to the given value.
          * @param option socket option.
@@ -473,6 +550,64 @@ namespace join
         }
 
     protected:
+        /**
+         * @brief wait for zero-copy notifications and read them from the socket error queue.
+         * @param timeout timeout in milliseconds.
+         * @return number of zero-copy sends released, -1 on failure.
+         */
+        int readNotifications (int timeout) noexcept
+        {
+            // the error queue is reported whatever the requested events.
+            if (this->wait (false, false, timeout) == -1)
+            {
+                return -1;
+            }
+
+            int released = 0;
+
+            for (;;)
+            {
+                alignas (cmsghdr) char control[CMSG_SPACE (sizeof (sock_extended_err) + sizeof (sockaddr_in6))];
+                struct msghdr message = {};
+                message.msg_control = control;
+                message.msg_controllen = sizeof (control);
+
+                if (::recvmsg (this->_handle, &message, MSG_ERRQUEUE | MSG_DONTWAIT) == -1)
+                {
+                    break;
+                }
+
+                for (cmsghdr* cmsg = CMSG_FIRSTHDR (&message); cmsg != nullptr; cmsg = CMSG_NXTHDR (&message, cmsg))
+                {
+                    if (((cmsg->cmsg_level != SOL_IP) || (cmsg->cmsg_type != IP_RECVERR)) &&
+                        ((cmsg->cmsg_level != SOL_IPV6) || (cmsg->cmsg_type != IPV6_RECVERR)))
+                    {
+                        continue;
+                    }
+
+                    auto err = reinterpret_cast<const sock_extended_err*> (CMSG_DATA (cmsg));
+                    if ((err->ee_errno == 0) && (err->ee_origin == SO_EE_ORIGIN_ZEROCOPY))
+                    {
+                        // a notification covers the range [ee_info, ee_data] of the sends made on the socket.
+                        released += int (err->ee_data - err->ee_info) + 1;
+                    }
+                }
+            }
+
+            if (released == 0)
+            {
+                // woken up by an error or a hang up instead.
+                int err = 0;
+                socklen_t len = sizeof (err);
+                ::getsockopt (this->_handle, SOL_SOCKET, SO_ERROR, &err, &len);
+                lastError = err ? std::error_code (err, std::generic_category ())
+                                : make_error_code (Errc::ConnectionClosed);
+                return -1;
+            }
+
+            return released;
+        }
+
         /// remote endpoint.
         Endpoint _remote;
     };
@@ -0,0 +1,431 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef JOIN_CORE_TASK_GRAPH_HPP
+#define JOIN_CORE_TASK_GRAPH_HPP
+
+// libjoin.
+#include <join/thread_pool.hpp>
+#include <join/statistics.hpp>
+#include <join/condition.hpp>
+#include <join/error.hpp>
+#include <join/clock.hpp>
+
+// C++.
+#include <system_error>
+#include <functional>
+#include <exception>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <deque>
+
+namespace join
+{
+    /**
+     * @brief dependency graph of tasks, built once and run repeatedly on a thread pool.
+     */
+    template <class ClockPolicy>
+    class BasicTaskGraph
+    {
+    public:
+        using Stats = BasicStats<ClockPolicy>;
+
+        /**
+         * @brief create instance.
+         * @param pool thread pool running the tasks.
+         */
+        explicit BasicTaskGraph (ThreadPool& pool = ThreadPool::instance ())
+        : _pool (pool)
+        , _stats ("graph")
+        {
+        }
+
+        /**
+         * @brief copy constructor.
+         * @param other other object to copy.
+         */
+        BasicTaskGraph (const BasicTaskGraph& other) = delete;
+
+        /**
+         * @brief copy assignment.
+         * @param other other object to copy.
+         * @return a reference to the current object.
+         */
+        BasicTaskGraph& operator= (const BasicTaskGraph& other) = delete;
+
+        /**
+         * @brief move constructor.
+         * @param other other object to move.
+         */
+        BasicTaskGraph (BasicTaskGraph&& other) = delete;
+
+        /**
+         * @brief move assignment.
+         * @param other other object to move.
+         * @return a reference to the current object.
+         */
+        BasicTaskGraph& operator= (BasicTaskGraph&& other) = delete;
+
+        /**
+         * @brief destroy instance.
+         */
+        ~BasicTaskGraph () = default;
+
+        /**
+         * @brief add a task to the graph.
+         * @param name task name, used as name of the task statistics.
+         * @param func callable to execute.
+         * @param args arguments to pass to the callable.
+         * @return task index.
+         * @throw std::system_error if the graph is running.
+         */
+        template <class Function, class... Args>
+        size_t add (const std::string& name, Function&& func, Args&&... args)
+        {
+            if (_running.load (std::memory_order_acquire))
+            {
+                throw std::system_error (make_error_code (Errc::InUse), "graph is running");
+            }
+
+            _nodes.emplace_back (name, std::bind (std::forward<Function> (func), std::forward<Args> (args)...));
+            _sorted = false;
+            return _nodes.size () - 1;
+        }
+
+        /**
+         * @brief make a task run before another one.
+         * @param from index of the task to run first.
+         * @param to index of the task depending on it.
+         * @return 0 on success, -1 on failure.
+         */
+        int precede (size_t from, size_t to)
+        {
+            if ((from >= _nodes.size ()) || (to >= _nodes.size ()) || (from == to))
+            {
+                lastError = make_error_code (Errc::InvalidParam);
+                return -1;
+            }
+
+            if (_running.load (std::memory_order_acquire))
+            {
+                lastError = make_error_code (Errc::InUse);
+                return -1;
+            }
+
+            _nodes[from].successors.push_back (to);
+            ++_nodes[to].predecessors;
+            _sorted = false;
+
+            return 0;
+        }
+
+        /**
+         * @brief run every task once, each one after the tasks it depends on, and wait for them.
+         * @return 0 on success, -1 on failure.
+         * @throw the first exception thrown by a task, the tasks depending on it are skipped.
+         * @note must not be called from a worker of the thread pool running the graph.
+         */
+        int run ()
+        {
+            bool expected = false;
+            if (!_running.compare_exchange_strong (expected, true, std::memory_order_acq_rel))
+            {
+                lastError = make_error_code (Errc::InUse);
+                return -1;
+            }
+
+            if (!_sorted && (sort () == -1))
+            {
+                _running.store (false, std::memory_order_release);
+                return -1;
+            }
+
+            auto beg = _stats.start ();
+
+            if (!_nodes.empty ())
+            {
+                for (auto& node : _nodes)
+                {
+                    node.pending.store (node.predecessors, std::memory_order_relaxed);
+                    node.skipped.store (false, std::memory_order_relaxed);
+                }
+
+                _error = nullptr;
+                _failed.store (false, std::memory_order_relaxed);
+                _remaining.store (_nodes.size (), std::memory_order_release);
+                _done = false;
+
+                for (size_t root : _roots)
+                {
+                    _pool.push ([this, root] () {
+                        execute (root);
+                    });
+                }
+
+                // the last task sets the flag and signals under the lock, it doesn't touch the graph afterwards.
+                ScopedLock<Mutex> lock (_mutex);
+                _condition.wait (lock, [this] () {
+                    return _done;
+                });
+            }
+
+            _stats.stop (beg);
+            _running.store (false, std::memory_order_release);
+
+            if (_error)
+            {
+                std::rethrow_exception (_error);
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief get the number of tasks.
+         * @return number of tasks.
+         */
+        size_t size () const noexcept
+        {
+            return _nodes.size ();
+        }
+
+        /**
+         * @brief get the statistics of the graph runs.
+         * @return statistics of the graph runs.
+         */
+        const Stats& stats () const noexcept
+        {
+            return _stats;
+        }
+
+        /**
+         * @brief get the statistics of a task.
+         * @param index task index.
+         * @return statistics of the task.
+         * @throw std::out_of_range if the task doesn't exist.
+         */
+        const Stats& stats (size_t index) const
+        {
+            return _nodes.at (index).stats;
+        }
+
+    private:
+        /**
+         * @brief graph node.
+         */
+        struct Node
+        {
+            /**
+             * @brief create the node.
+             * @param name task name.
+             * @param function task.
+             */
+            Node (const std::string& name, std::function<void ()>&& function)
+            : function (std::move (function))
+            , stats (name)
+            {
+            }
+
+            /// task.
+            std::function<void ()> function;
+
+            /// indexes of the tasks depending on this one.
+            std::vector<size_t> successors;
+
+            /// number of tasks this one depends on.
+            size_t predecessors = 0;
+
+            /// number of tasks still to run before this one in the current run.
+            std::atomic<size_t> pending{0};
+
+            /// a task this one depends on threw or was skipped in the current run.
+            std::atomic<bool> skipped{false};
+
+            /// task statistics.
+            Stats stats;
+        };
+
+        /**
+         * @brief find the tasks without dependency and check that the graph has no cycle.
+         * @return 0 on success, -1 on failure.
+         */
+        int sort ()
+        {
+            std::vector<size_t> pending (_nodes.size ());
+            std::vector<size_t> ready;
+
+            for (size_t i = 0; i < _nodes.size (); ++i)
+            {
+                pending[i] = _nodes[i].predecessors;
+                if (pending[i] == 0)
+                {
+                    ready.push_back (i);
+                }
+            }
+
+            _roots = ready;
+
+            // a task is visited once all its dependencies were, the ones left over are part of a cycle.
+            size_t visited = 0;
+            while (!ready.empty ())
+            {
+                size_t index = ready.back ();
+                ready.pop_back ();
+                ++visited;
+
+                for (size_t successor : _nodes[index].successors)
+                {
+                    if (--pending[successor] == 0)
+                    {
+                        ready.push_back (successor);
+                    }
+                }
+            }
+
+            if (visited != _nodes.size ())
+            {
+                lastError = make_error_code (Errc::InvalidParam);
+                return -1;
+            }
+
+            _sorted = true;
+
+            return 0;
+        }
+
+        /**
+         * @brief run a task then the tasks it made ready.
+         * @param index task index.
+         * @note the first ready successor runs right after on the same worker, the others are pushed to the pool.
+         */
+        void execute (size_t index)
+        {
+            for (;;)
+            {
+                Node& node = _nodes[index];
+                bool skip = node.skipped.load (std::memory_order_acquire);
+
+                if (!skip)
+                {
+                    auto beg = node.stats.start ();
+
+                    try
+                    {
+                        node.function ();
+                    }
+                    catch (...)
+                    {
+                        if (!_failed.exchange (true, std::memory_order_acq_rel))
+                        {
+                            _error = std::current_exception ();
+                        }
+                        skip = true;
+                    }
+
+                    node.stats.stop (beg);
+                }
+
+                size_t next = _nodes.size ();
+
+                for (size_t successor : node.successors)
+                {
+                    if (skip)
+                    {
+                        // the tasks depending on a failed one are skipped, the other branches keep running.
+                        _nodes[successor].skipped.store (true, std::memory_order_relaxed);
+                    }
+
+                    if (_nodes[successor].pending.fetch_sub (1, std::memory_order_acq_rel) == 1)
+                    {
+                        if (next == _nodes.size ())
+                        {
+                            next = successor;
+                        }
+                        else
+                        {
+                            _pool.push ([this, successor] () {
+                                execute (successor);
+                            });
+                        }
+                    }
+                }
+
+                if (_remaining.fetch_sub (1, std::memory_order_acq_rel) == 1)
+                {
+                    // last task of the run, nothing is left to continue with.
+                    ScopedLock<Mutex> lock (_mutex);
+                    _done = true;
+                    _condition.signal ();
+                    return;
+                }
+
+                if (next == _nodes.size ())
+                {
+                    return;
+                }
+
+                index = next;
+            }
+        }
+
+        /// thread pool running the tasks.
+        ThreadPool& _pool;
+
+        /// graph nodes.
+        std::deque<Node> _nodes;
+
+        /// indexes of the tasks without dependency.
+        std::vector<size_t> _roots;
+
+        /// roots are up to date and the graph has no cycle.
+        bool _sorted = true;
+
+        /// a run is in progress.
+        std::atomic<bool> _running{false};
+
+        /// number of tasks still to run in the current run.
+        std::atomic<size_t> _remaining{0};
+
+        /// set by the first task that threw.
+        std::atomic<bool> _failed{false};
+
+        /// exception thrown by the first task that threw.
+        std::exception_ptr _error;
+
+        /// set by the last task of the run, protected by the mutex.
+        bool _done = false;
+
+        /// condition signaled at the end of a run.
+        Condition _condition;
+
+        /// condition protection mutex.
+        Mutex _mutex;
+
+        /// statistics of the graph runs.
+        Stats _stats;
+    };
+}
+
+#endif
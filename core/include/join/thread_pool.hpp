@@ -27,21 +27,208 @@
 
 // libjoin.
 #include <join/condition.hpp>
+#include <join/allocator.hpp>
+#include <join/function.hpp>
+#include <join/backoff.hpp>
 #include <join/thread.hpp>
 #include <join/cpu.hpp>
 
 // C++.
+#include <type_traits>
 #include <functional>
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <numeric>
 #include <memory>
+#include <limits>
 #include <atomic>
 #include <vector>
-#include <deque>
 
 namespace join
 {
     /// forward declaration.
     class ThreadPool;
 
+    namespace details
+    {
+        /// size of the task storage, larger callables are allocated.
+        constexpr size_t taskCapacity = 64;
+
+        /// task run by the thread pool.
+        using Task = Function<void (), taskCapacity>;
+
+        /// arena holding the callables too large for the task storage.
+        using TaskArena = LocalMem::Allocator<512, 128, 256, 512, 1024>;
+
+        /**
+         * @brief destroy a callable allocated in a task arena.
+         */
+        template <class Callable>
+        struct TaskDeleter
+        {
+            /**
+             * @brief destroy the callable and give its memory back to the arena.
+             * @param callable callable to destroy.
+             */
+            void operator() (Callable* callable) const noexcept
+            {
+                callable->~Callable ();
+                arena->deallocate (callable);
+            }
+
+            /// arena owning the callable memory.
+            TaskArena* arena;
+        };
+
+        /**
+         * @brief bounded Chase-Lev deque, the owner pushes and pops at the bottom, thieves steal at the top.
+         */
+        class TaskDeque
+        {
+        public:
+            /**
+             * @brief create the deque.
+             * @param capacity maximum number of tasks (power of 2).
+             * @param numa NUMA node the slots are bound to (-1 no binding).
+             */
+            TaskDeque (size_t capacity, int numa = -1);
+
+            /**
+             * @brief destroy the deque.
+             */
+            ~TaskDeque () noexcept;
+
+            /**
+             * @brief push a task at the bottom (owner only).
+             * @param task task to push, left untouched if the deque is full.
+             * @return true on success, false if the deque is full.
+             */
+            bool push (Task& task) noexcept;
+
+            /**
+             * @brief pop the last pushed task (owner only).
+             * @param task popped task.
+             * @return true on success, false if the deque is empty.
+             */
+            bool pop (Task& task) noexcept;
+
+            /**
+             * @brief steal the first pushed task (any thread).
+             * @param task stolen task.
+             * @return true on success, false if the deque is empty or another thread won the race.
+             */
+            bool steal (Task& task) noexcept;
+
+            /**
+             * @brief check if the deque looks empty.
+             * @return true if the deque looks empty.
+             */
+            bool empty () const noexcept;
+
+        private:
+            /**
+             * @brief task slot.
+             */
+            struct Slot
+            {
+                /// stored task.
+                Task task;
+
+                /// set by the owner on push, cleared once the task was moved out.
+                std::atomic<bool> full{false};
+            };
+
+            /// slots memory.
+            LocalMem _storage;
+
+            /// task slots.
+            Slot* _slots;
+
+            /// slot index mask.
+            const size_t _mask;
+
+            /// next index to steal.
+            std::atomic<int64_t> _top{0};
+
+            /// keep the thieves and the owner on different cache lines.
+            char _padding[64 - sizeof (std::atomic<int64_t>)];
+
+            /// next index to push.
+            std::atomic<int64_t> _bottom{0};
+        };
+
+        /**
+         * @brief bounded lock-free multi producer multi consumer task queue.
+         */
+        class TaskQueue
+        {
+        public:
+            /**
+             * @brief create the queue.
+             * @param capacity maximum number of tasks (power of 2).
+             * @param numa NUMA node the cells are bound to (-1 no binding).
+             */
+            TaskQueue (size_t capacity, int numa = -1);
+
+            /**
+             * @brief destroy the queue.
+             */
+            ~TaskQueue () noexcept;
+
+            /**
+             * @brief push a task.
+             * @param task task to push, left untouched if the queue is full.
+             * @return true on success, false if the queue is full.
+             */
+            bool push (Task& task) noexcept;
+
+            /**
+             * @brief pop a task.
+             * @param task popped task.
+             * @return true on success, false if the queue is empty.
+             */
+            bool pop (Task& task) noexcept;
+
+            /**
+             * @brief check if the queue looks empty.
+             * @return true if the queue looks empty.
+             */
+            bool empty () const noexcept;
+
+        private:
+            /**
+             * @brief task cell.
+             */
+            struct Cell
+            {
+                /// sequence telling whether the cell can be written or read.
+                std::atomic<size_t> seq;
+
+                /// stored task.
+                Task task;
+            };
+
+            /// cells memory.
+            LocalMem _storage;
+
+            /// task cells.
+            Cell* _cells;
+
+            /// cell index mask.
+            const size_t _mask;
+
+            /// next position to read.
+            std::atomic<size_t> _head{0};
+
+            /// keep the consumers and the producers on different cache lines.
+            char _padding[64 - sizeof (std::atomic<size_t>)];
+
+            /// next position to write.
+            std::atomic<size_t> _tail{0};
+        };
+    }
+
     /**
      * @brief worker thread class.
      */
@@ -51,8 +238,11 @@ namespace join
         /**
          * @brief create worker thread.
          * @param pool thread pool.
+         * @param index worker index.
+         * @param node index of the pool node the worker belongs to.
+         * @param core core to pin the worker to (-1 no pinning).
          */
-        WorkerThread (ThreadPool& pool);
+        WorkerThread (ThreadPool& pool, size_t index, size_t node, int core);
 
     public:
         /**
@@ -92,9 +282,21 @@ namespace join
          */
         void work ();
 
+        /// worker running on the calling thread, nullptr if not a worker thread.
+        static thread_local WorkerThread* _self;
+
         /// thread pool.
         ThreadPool* _pool = nullptr;
 
+        /// worker index.
+        size_t _index = 0;
+
+        /// index of the pool node the worker belongs to.
+        size_t _node = 0;
+
+        /// tasks pushed by this worker.
+        details::TaskDeque _tasks;
+
         /// thread.
         Thread _thread;
 
@@ -103,16 +305,28 @@ namespace join
     };
 
     /**
-     * @brief thread pool class.
+     * @brief work-stealing thread pool class.
      */
     class ThreadPool
     {
     public:
+        /**
+         * @brief worker placement.
+         */
+        enum Placement
+        {
+            Floating, /**< workers are not pinned and share a single queue. */
+            Numa,     /**< workers are pinned one per physical core and grouped per NUMA node. */
+        };
+
         /**
          * @brief create thread pool.
          * @param workers number of worker threads.
+         * @param placement worker placement (default: Floating).
+         * @note with the Numa placement, each NUMA node has its own injection queue and task arena bound to it,
+         * and idle workers look for tasks on their own node before stealing from the other nodes.
          */
-        ThreadPool (int workers = int (CpuTopology::instance ()->cores ().size ()));
+        ThreadPool (int workers = int (CpuTopology::instance ()->cores ().size ()), Placement placement = Floating);
 
         /**
          * @brief copy constructor.
@@ -141,7 +355,7 @@ namespace join
         ThreadPool& operator= (ThreadPool&& other) = delete;
 
         /**
-         * @brief destroy thread pool.
+         * @brief destroy thread pool once every pushed job ran.
          */
         ~ThreadPool () noexcept;
 
@@ -149,13 +363,27 @@ namespace join
          * @brief push a job to the work queue.
          * @param func callable to execute.
          * @param args arguments to pass to the callable.
+         * @note a job pushed from a worker thread goes to the worker deque and runs first on that worker,
+         * other threads push to the shared injection queue.
          */
         template <class Function, class... Args>
         void push (Function&& func, Args&&... args)
         {
-            ScopedLock<Mutex> lock (_mutex);
-            _jobs.emplace_back (std::bind (std::forward<Function> (func), std::forward<Args> (args)...));
-            _condition.signal ();
+            size_t node = local ();
+            submit (node, makeTask (node, std::bind (std::forward<Function> (func), std::forward<Args> (args)...)));
+        }
+
+        /**
+         * @brief push a job to the work queue of a NUMA node.
+         * @param numa NUMA node ID, the node of the calling thread is used if the pool has no worker on it.
+         * @param func callable to execute.
+         * @param args arguments to pass to the callable.
+         */
+        template <class Function, class... Args>
+        void pushOn (int numa, Function&& func, Args&&... args)
+        {
+            size_t node = find (numa);
+            submit (node, makeTask (node, std::bind (std::forward<Function> (func), std::forward<Args> (args)...)));
         }
 
         /**
@@ -163,7 +391,182 @@ namespace join
          */
         size_t size () const noexcept;
 
+        /**
+         * @brief get the NUMA nodes the workers run on.
+         * @return NUMA node IDs, -1 for the single node of a floating pool.
+         */
+        std::vector<int> nodes () const;
+
+        /**
+         * @brief get the process wide pool running the parallel algorithms.
+         * @return thread pool with one worker per physical core.
+         */
+        static ThreadPool& instance ();
+
     private:
+        /**
+         * @brief group of workers sharing an injection queue and a task arena.
+         */
+        struct Node
+        {
+            /**
+             * @brief create the node.
+             * @param numa NUMA node ID (-1 no binding).
+             */
+            explicit Node (int numa)
+            : numa (numa)
+            , jobs (_queueSize, numa)
+            {
+#ifdef JOIN_HAS_NUMA
+                if (numa >= 0)
+                {
+                    arena.mbind (numa);
+                }
+#endif
+            }
+
+            /// NUMA node ID.
+            int numa;
+
+            /// tasks pushed by threads outside the node.
+            details::TaskQueue jobs;
+
+            /// callables too large for the task storage.
+            details::TaskArena arena;
+
+            /// indexes of the workers of the node.
+            std::vector<size_t> workers;
+        };
+
+        /**
+         * @brief wrap a callable that fits the task storage.
+         * @param node index of the node the task is queued on.
+         * @param func callable.
+         * @return task.
+         */
+        template <class Func, typename Decayed = std::decay_t<Func>>
+        std::enable_if_t<(sizeof (Decayed) <= details::taskCapacity) && (alignof (Decayed) <= alignof (std::max_align_t)) &&
+                             std::is_nothrow_move_constructible<Decayed>::value,
+                         details::Task>
+        makeTask (size_t /*node*/, Func&& func)
+        {
+            return details::Task (std::forward<Func> (func));
+        }
+
+        /**
+         * @brief wrap a callable too large for the task storage, in the arena of the node if it fits.
+         * @param node index of the node the task is queued on.
+         * @param func callable.
+         * @return task.
+         */
+        template <class Func, typename Decayed = std::decay_t<Func>>
+        std::enable_if_t<(sizeof (Decayed) > details::taskCapacity) || (alignof (Decayed) > alignof (std::max_align_t)) ||
+                             !std::is_nothrow_move_constructible<Decayed>::value,
+                         details::Task>
+        makeTask (size_t node, Func&& func)
+        {
+            details::TaskArena* arena = &_nodes[node]->arena;
+            void* ptr = nullptr;
+
+            if (alignof (Decayed) <= alignof (std::max_align_t))
+            {
+                ptr = arena->allocate (sizeof (Decayed));
+            }
+
+            if (ptr == nullptr)
+            {
+                return details::Task ([callable = std::make_unique<Decayed> (std::forward<Func> (func))] () {
+                    (*callable) ();
+                });
+            }
+
+            Decayed* callable;
+
+            try
+            {
+                callable = new (ptr) Decayed (std::forward<Func> (func));
+            }
+            catch (...)
+            {
+                arena->deallocate (ptr);
+                throw;
+            }
+
+            return details::Task (
+                [callable = std::unique_ptr<Decayed, details::TaskDeleter<Decayed>> (callable, {arena})] () {
+                    (*callable) ();
+                });
+        }
+
+        /**
+         * @brief get the node of the calling thread.
+         * @return node index.
+         */
+        size_t local () const noexcept;
+
+        /**
+         * @brief get the node running on a NUMA node.
+         * @param numa NUMA node ID.
+         * @return node index, the node of the calling thread if no node runs on the NUMA node.
+         */
+        size_t find (int numa) const noexcept;
+
+        /**
+         * @brief queue a task and wake up an idle worker.
+         * @param node index of the node to queue the task on.
+         * @param task task to queue.
+         */
+        void submit (size_t node, details::Task&& task);
+
+        /**
+         * @brief get the next task of a worker, from its own deque, the injection queue of its node,
+         * the other workers of its node, then the other nodes.
+         * @param index worker index.
+         * @param task next task.
+         * @return true if a task was found.
+         */
+        bool take (size_t index, details::Task& task) noexcept;
+
+        /**
+         * @brief get a task from a node.
+         * @param node node.
+         * @param index index of the worker looking for a task, skipped when stealing.
+         * @param task next task.
+         * @return true if a task was found.
+         */
+        bool take (Node& node, size_t index, details::Task& task) noexcept;
+
+        /**
+         * @brief check if a task looks available.
+         * @return true if a task looks available.
+         */
+        bool pending () const noexcept;
+
+        /**
+         * @brief wake up a parked worker if any.
+         */
+        void wakeup () noexcept;
+
+        /**
+         * @brief park the calling worker until a task is pushed or the pool stops.
+         */
+        void park ();
+
+        /// max number of tasks in a worker deque.
+        static constexpr size_t _dequeSize = 1024;
+
+        /// max number of tasks in the injection queue.
+        static constexpr size_t _queueSize = 8192;
+
+        /// number of failed lookups before an idle worker parks.
+        static constexpr size_t _idleRounds = 256;
+
+        /// worker nodes.
+        std::vector<std::unique_ptr<Node>> _nodes;
+
+        /// node index of each logical cpu, first node if the cpu runs no worker.
+        std::vector<size_t> _cpus;
+
         /// worker threads.
         std::vector<std::unique_ptr<WorkerThread>> _workers;
 
@@ -176,79 +579,542 @@ namespace join
         /// gracefully stop all threads.
         std::atomic<bool> _stop;
 
-        /// jobs queue.
-        std::deque<std::function<void ()>> _jobs;
+        /// number of parked or parking workers.
+        std::atomic<size_t> _sleepers{0};
+
+        /// wakeups not consumed yet by the parked workers.
+        std::atomic<size_t> _signals{0};
 
         /// friendship with worker thread.
         friend class WorkerThread;
     };
 
-    /**
-     * @brief determine the number of threads and tasks per thread to run and execute them in parallel.
-     * @param first first iterator.
-     * @param last last iterator.
-     * @param function function to execute in parallel.
-     */
-    template <class InputIt, class Func>
-    void distribute (InputIt first, InputIt last, Func function)
+    namespace details
     {
-        // check if we have tasks to perform.
-        int count = std::distance (first, last);
-        if (count)
+        /**
+         * @brief check if an iterator is a random access iterator.
+         */
+        template <class Iterator>
+        using IsRandomAccess = std::is_base_of<std::random_access_iterator_tag,
+                                               typename std::iterator_traits<Iterator>::iterator_category>;
+
+        /**
+         * @brief hands out the chunks of a random access range, large chunks first (guided scheduling).
+         */
+        template <class Iterator, bool = IsRandomAccess<Iterator>::value>
+        class ChunkSource
+        {
+        public:
+            /**
+             * @brief create the chunk source.
+             * @param first first iterator.
+             * @param last last iterator.
+             * @param grain minimum number of elements of a chunk.
+             */
+            ChunkSource (Iterator first, Iterator last, size_t grain)
+            : _first (first)
+            , _count (static_cast<size_t> (last - first))
+            , _grain (std::max (grain, size_t (1)))
+            {
+            }
+
+            /**
+             * @brief get the maximum number of chunks.
+             * @return maximum number of chunks.
+             */
+            size_t chunks () const noexcept
+            {
+                return (_count + _grain - 1) / _grain;
+            }
+
+            /**
+             * @brief set the number of threads sharing the chunks.
+             * @param participants number of threads.
+             */
+            void participants (size_t participants) noexcept
+            {
+                _participants = std::max (participants, size_t (1));
+            }
+
+            /**
+             * @brief claim the next chunk.
+             * @param beg first iterator of the chunk.
+             * @param end last iterator of the chunk.
+             * @return true if a chunk was claimed, false if the range is exhausted.
+             */
+            bool next (Iterator& beg, Iterator& end) noexcept
+            {
+                size_t cur = _cursor.load (std::memory_order_relaxed);
+                size_t len;
+
+                do
+                {
+                    if (cur >= _count)
+                    {
+                        return false;
+                    }
+
+                    // half of a fair share of what is left, but never less than the grain.
+                    len = std::min (std::max (_grain, (_count - cur) / (2 * _participants)), _count - cur);
+                }
+                while (!_cursor.compare_exchange_weak (cur, cur + len, std::memory_order_relaxed));
+
+                beg = _first + cur;
+                end = beg + len;
+
+                return true;
+            }
+
+            /**
+             * @brief drop the chunks not claimed yet.
+             */
+            void cancel () noexcept
+            {
+                _cursor.store (_count, std::memory_order_relaxed);
+            }
+
+        private:
+            /// first iterator.
+            Iterator _first;
+
+            /// number of elements.
+            size_t _count;
+
+            /// minimum number of elements of a chunk.
+            size_t _grain;
+
+            /// number of threads sharing the chunks.
+            size_t _participants = 1;
+
+            /// index of the next element to hand out.
+            std::atomic<size_t> _cursor{0};
+        };
+
+        /**
+         * @brief hands out the chunks of a forward range, grain elements at a time.
+         */
+        template <class Iterator>
+        class ChunkSource<Iterator, false>
         {
-            // determine number of threads and tasks per thread to run.
-            int concurrency = int (CpuTopology::instance ()->cores ().size ());
-            // no need to create more threads than tasks.
-            concurrency = std::min (concurrency, count);
-            int elements = count / concurrency;
-            int rest = count % concurrency;
-            // distribute tasks to threads.
-            std::vector<int> tasks (concurrency, elements);
-            for (int i = 0; i < rest; ++i)
+        public:
+            /**
+             * @brief create the chunk source.
+             * @param first first iterator.
+             * @param last last iterator.
+             * @param grain number of elements of a chunk.
+             */
+            ChunkSource (Iterator first, Iterator last, size_t grain)
+            : _cur (first)
+            , _last (last)
+            , _grain (std::max (grain, size_t (1)))
             {
-                ++tasks[i];
             }
 
-            // determine the real thread pool size (concurrency minus 1 as we are a thread).
-            std::vector<Thread> pool;
-            int nth = concurrency - 1;
-            pool.reserve (nth);
+            /**
+             * @brief get the maximum number of chunks.
+             * @return maximum number of chunks, unknown without walking the range.
+             */
+            size_t chunks () const noexcept
+            {
+                return std::numeric_limits<size_t>::max ();
+            }
+
+            /**
+             * @brief set the number of threads sharing the chunks.
+             */
+            void participants (size_t) noexcept
+            {
+            }
 
-            // create threads.
-            auto beg = first, end = first;
-            for (int i = 0; i < nth; ++i)
+            /**
+             * @brief claim the next chunk.
+             * @param beg first iterator of the chunk.
+             * @param end last iterator of the chunk.
+             * @return true if a chunk was claimed, false if the range is exhausted.
+             */
+            bool next (Iterator& beg, Iterator& end)
             {
-                std::advance (end, tasks[i]);
-                pool.emplace_back (function, beg, end);
-                beg = end;
+                ScopedLock<Mutex> lock (_mutex);
+
+                if (_cur == _last)
+                {
+                    return false;
+                }
+
+                beg = _cur;
+                for (size_t i = 0; (i < _grain) && (_cur != _last); ++i)
+                {
+                    ++_cur;
+                }
+                end = _cur;
+
+                return true;
             }
 
-            // we are a thread so we can help.
-            function (beg, last);
+            /**
+             * @brief drop the chunks not claimed yet.
+             */
+            void cancel ()
+            {
+                ScopedLock<Mutex> lock (_mutex);
+                _cur = _last;
+            }
+
+        private:
+            /// next element to hand out.
+            Iterator _cur;
+
+            /// last iterator.
+            Iterator _last;
+
+            /// number of elements of a chunk.
+            size_t _grain;
+
+            /// protect the next element.
+            Mutex _mutex;
+        };
+
+        /**
+         * @brief state shared by the threads running the chunks of a range.
+         */
+        template <class Iterator, class Func>
+        struct ChunkState
+        {
+            /**
+             * @brief create the state.
+             * @param first first iterator.
+             * @param last last iterator.
+             * @param grain minimum number of elements of a chunk.
+             * @param func function called on each chunk.
+             */
+            ChunkState (Iterator first, Iterator last, size_t grain, Func& func)
+            : source (first, last, grain)
+            , function (std::addressof (func))
+            {
+            }
 
-            // wait for threads to terminate.
-            for (auto& thread : pool)
+            /**
+             * @brief run chunks until the range is exhausted.
+             */
+            void run ()
             {
-                thread.join ();
+                for (;;)
+                {
+                    // counted before the claim so that the caller can't miss a chunk about to start.
+                    inflight.fetch_add (1, std::memory_order_acq_rel);
+
+                    Iterator beg, end;
+                    if (!source.next (beg, end))
+                    {
+                        inflight.fetch_sub (1, std::memory_order_release);
+                        return;
+                    }
+
+                    try
+                    {
+                        (*function) (beg, end);
+                    }
+                    catch (...)
+                    {
+                        if (!failed.exchange (true, std::memory_order_acq_rel))
+                        {
+                            error = std::current_exception ();
+                        }
+                        source.cancel ();
+                    }
+
+                    inflight.fetch_sub (1, std::memory_order_release);
+                }
             }
+
+            /// chunks of the range.
+            ChunkSource<Iterator> source;
+
+            /// function called on each chunk, only used while a chunk is claimed.
+            Func* function;
+
+            /// number of threads running or claiming a chunk.
+            std::atomic<size_t> inflight{0};
+
+            /// set by the first chunk that threw.
+            std::atomic<bool> failed{false};
+
+            /// exception thrown by the first chunk that threw.
+            std::exception_ptr error;
+        };
+    }
+
+    /**
+     * @brief split a range in chunks and run them in parallel on a thread pool.
+     * @param pool thread pool.
+     * @param first first iterator.
+     * @param last last iterator.
+     * @param function function called with the first and last iterators of each chunk.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     * @note random access ranges are handed out large chunks first, other ranges grain elements at a time.
+     * the calling thread runs chunks too, the first exception thrown by a chunk is rethrown once all chunks ended.
+     */
+    template <class InputIt, class Func>
+    void distribute (ThreadPool& pool, InputIt first, InputIt last, Func function, size_t grain = 1)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        // shared with the helpers, a helper starting after the range was exhausted only drops its reference.
+        auto state = std::make_shared<details::ChunkState<InputIt, Func>> (first, last, grain, function);
+
+        size_t helpers = std::min (pool.size (), state->source.chunks () - 1);
+        state->source.participants (helpers + 1);
+
+        for (size_t i = 0; i < helpers; ++i)
+        {
+            pool.push ([state] () {
+                state->run ();
+            });
+        }
+
+        // we are a thread so we can help.
+        state->run ();
+
+        Backoff backoff;
+        while (state->inflight.load (std::memory_order_acquire) != 0)
+        {
+            backoff ();
         }
+
+        if (state->error)
+        {
+            std::rethrow_exception (state->error);
+        }
+    }
+
+    /**
+     * @brief split a range in chunks and run them in parallel on the process wide thread pool.
+     * @param first first iterator.
+     * @param last last iterator.
+     * @param function function called with the first and last iterators of each chunk.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     */
+    template <class InputIt, class Func>
+    void distribute (InputIt first, InputIt last, Func function, size_t grain = 1)
+    {
+        distribute (ThreadPool::instance (), first, last, std::move (function), grain);
     }
 
     /**
      * @brief parallel for each loop.
+     * @param pool thread pool.
      * @param first first iterator.
      * @param last last iterator.
      * @param function function to execute in parallel.
+     * @param grain minimum number of elements of a chunk (default: 1).
      */
     template <class InputIt, class Func>
-    void parallelForEach (InputIt first, InputIt last, Func function)
+    void parallelForEach (ThreadPool& pool, InputIt first, InputIt last, Func function, size_t grain = 1)
     {
-        distribute (first, last, [&function] (InputIt beg, InputIt end) {
-            for (; beg != end; ++beg)
+        distribute (
+            pool, first, last,
+            [&function] (InputIt beg, InputIt end) {
+                for (; beg != end; ++beg)
+                {
+                    function (*beg);
+                }
+            },
+            grain);
+    }
+
+    /**
+     * @brief parallel for each loop.
+     * @param first first iterator.
+     * @param last last iterator.
+     * @param function function to execute in parallel.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     */
+    template <class InputIt, class Func>
+    void parallelForEach (InputIt first, InputIt last, Func function, size_t grain = 1)
+    {
+        parallelForEach (ThreadPool::instance (), first, last, std::move (function), grain);
+    }
+
+    /**
+     * @brief parallel reduction.
+     * @param pool thread pool.
+     * @param first first iterator.
+     * @param last last iterator.
+     * @param init initial value.
+     * @param op associative and commutative binary operation.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     * @return reduced value.
+     */
+    template <class InputIt, class T, class BinaryOp>
+    T parallelReduce (ThreadPool& pool, InputIt first, InputIt last, T init, BinaryOp op, size_t grain = 1)
+    {
+        Mutex mutex;
+
+        distribute (
+            pool, first, last,
+            [&] (InputIt beg, InputIt end) {
+                T partial = *beg;
+                for (++beg; beg != end; ++beg)
+                {
+                    partial = op (std::move (partial), *beg);
+                }
+
+                ScopedLock<Mutex> lock (mutex);
+                init = op (std::move (init), std::move (partial));
+            },
+            grain);
+
+        return init;
+    }
+
+    /**
+     * @brief parallel reduction.
+     * @param first first iterator.
+     * @param last last iterator.
+     * @param init initial value.
+     * @param op associative and commutative binary operation.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     * @return reduced value.
+     */
+    template <class InputIt, class T, class BinaryOp>
+    T parallelReduce (InputIt first, InputIt last, T init, BinaryOp op, size_t grain = 1)
+    {
+        return parallelReduce (ThreadPool::instance (), first, last, std::move (init), std::move (op), grain);
+    }
+
+    /**
+     * @brief parallel sum.
+     * @param first first iterator.
+     * @param last last iterator.
+     * @param init initial value.
+     * @return sum of the initial value and the elements.
+     */
+    template <class InputIt, class T>
+    T parallelReduce (InputIt first, InputIt last, T init)
+    {
+        return parallelReduce (ThreadPool::instance (), first, last, std::move (init), std::plus<> ());
+    }
+
+    /**
+     * @brief parallel transform.
+     * @param pool thread pool.
+     * @param first first random access iterator.
+     * @param last last random access iterator.
+     * @param dest first random access iterator of the destination range.
+     * @param op unary operation.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     * @return iterator past the last transformed element.
+     */
+    template <class RandomIt, class OutputIt, class UnaryOp>
+    OutputIt parallelTransform (ThreadPool& pool, RandomIt first, RandomIt last, OutputIt dest, UnaryOp op,
+                                size_t grain = 1)
+    {
+        static_assert (details::IsRandomAccess<RandomIt>::value && details::IsRandomAccess<OutputIt>::value,
+                       "random access iterators required");
+
+        distribute (
+            pool, first, last,
+            [&] (RandomIt beg, RandomIt end) {
+                std::transform (beg, end, dest + (beg - first), op);
+            },
+            grain);
+
+        return dest + (last - first);
+    }
+
+    /**
+     * @brief parallel transform.
+     * @param first first random access iterator.
+     * @param last last random access iterator.
+     * @param dest first random access iterator of the destination range.
+     * @param op unary operation.
+     * @param grain minimum number of elements of a chunk (default: 1).
+     * @return iterator past the last transformed element.
+     */
+    template <class RandomIt, class OutputIt, class UnaryOp>
+    OutputIt parallelTransform (RandomIt first, RandomIt last, OutputIt dest, UnaryOp op, size_t grain = 1)
+    {
+        return parallelTransform (ThreadPool::instance (), first, last, dest, std::move (op), grain);
+    }
+
+    /**
+     * @brief parallel sort, the parts are sorted in parallel then merged pairwise in parallel.
+     * @param pool thread pool.
+     * @param first first random access iterator.
+     * @param last last random access iterator.
+     * @param comp comparison function.
+     * @param grain minimum number of elements of a part sorted by one thread (default: 4096).
+     */
+    template <class RandomIt, class Compare>
+    void parallelSort (ThreadPool& pool, RandomIt first, RandomIt last, Compare comp, size_t grain = 4096)
+    {
+        static_assert (details::IsRandomAccess<RandomIt>::value, "random access iterators required");
+
+        size_t count = static_cast<size_t> (last - first);
+        grain = std::max (grain, size_t (1));
+
+        // one part per participant, but never smaller than the grain.
+        size_t parts = std::min (pool.size () + 1, (count + grain - 1) / grain);
+        if (parts < 2)
+        {
+            std::sort (first, last, comp);
+            return;
+        }
+
+        std::vector<size_t> bounds (parts + 1);
+        for (size_t i = 0; i <= parts; ++i)
+        {
+            bounds[i] = (count * i) / parts;
+        }
+
+        std::vector<size_t> indexes (parts);
+        std::iota (indexes.begin (), indexes.end (), 0);
+
+        parallelForEach (pool, indexes.begin (), indexes.end (), [&] (size_t i) {
+            std::sort (first + bounds[i], first + bounds[i + 1], comp);
+        });
+
+        // merge neighbouring sorted runs, doubling their width on each round.
+        for (size_t width = 1; width < parts; width *= 2)
+        {
+            indexes.clear ();
+            for (size_t i = 0; i + width < parts; i += 2 * width)
             {
-                function (*beg);
+                indexes.push_back (i);
             }
-        });
+
+            parallelForEach (pool, indexes.begin (), indexes.end (), [&] (size_t i) {
+                std::inplace_merge (first + bounds[i], first + bounds[i + width],
+                                    first + bounds[std::min (i + 2 * width, parts)], comp);
+            });
+        }
+    }
+
+    /**
+     * @brief parallel sort.
+     * @param first first random access iterator.
+     * @param last last random access iterator.
+     * @param comp comparison function.
+     * @param grain minimum number of elements of a part sorted by one thread (default: 4096).
+     */
+    template <class RandomIt, class Compare>
+    void parallelSort (RandomIt first, RandomIt last, Compare comp, size_t grain = 4096)
+    {
+        parallelSort (ThreadPool::instance (), first, last, std::move (comp), grain);
+    }
+
+    /**
+     * @brief parallel sort in ascending order.
+     * @param first first random access iterator.
+     * @param last last random access iterator.
+     */
+    template <class RandomIt>
+    void parallelSort (RandomIt first, RandomIt last)
+    {
+        parallelSort (ThreadPool::instance (), first, last, std::less<> ());
     }
 }
 
@@ -0,0 +1,841 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef JOIN_CORE_TIMER_WHEEL_HPP
+#define JOIN_CORE_TIMER_WHEEL_HPP
+
+// libjoin.
+#include <join/reactor.hpp>
+#include <join/backoff.hpp>
+#include <join/mutex.hpp>
+#include <join/clock.hpp>
+
+// C++.
+#include <functional>
+#include <atomic>
+#include <chrono>
+#include <array>
+
+// C.
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace join
+{
+    /**
+     * @brief hierarchical timer wheel sharing a single timerfd between all its timers.
+     * the first level has one slot per tick, each slot of an upper level covers a whole turn of the level
+     * below and is cascaded down when that level wraps. arming and cancelling a timer is O(1) and only
+     * touches the timerfd when the next expiry moves earlier. timers expire at tick granularity, never early.
+     */
+    template <class ClockPolicy>
+    class BasicTimerWheel : protected EventHandler
+    {
+    public:
+        using Timer = BasicWheelTimer<ClockPolicy>;
+
+        /**
+         * @brief create instance.
+         * @param reactor event loop reactor.
+         * @param resolution tick duration.
+         */
+        explicit BasicTimerWheel (Reactor& reactor = ReactorThread::reactor (),
+                                  std::chrono::nanoseconds resolution = std::chrono::milliseconds (1))
+        : _handle (timerfd_create (ClockPolicy::type (), TFD_NONBLOCK | TFD_CLOEXEC))
+        , _resolution (std::max (resolution.count (), int64_t (1)))
+        , _origin (clock ())
+        , _reactor (reactor)
+        {
+            if (_handle == -1)
+            {
+                throw std::system_error (errno, std::system_category (), "timerfd_create failed");
+            }
+
+            _buckets.fill (nullptr);
+            _bitmap.fill (0);
+
+            _reactor.addHandler (_handle, this);
+        }
+
+        /**
+         * @brief copy constructor.
+         * @param other other object to copy.
+         */
+        BasicTimerWheel (const BasicTimerWheel& other) = delete;
+
+        /**
+         * @brief copy assignment operator.
+         * @param other other object to assign.
+         * @return assigned object.
+         */
+        BasicTimerWheel& operator= (const BasicTimerWheel& other) = delete;
+
+        /**
+         * @brief move constructor.
+         * @param other other object to move.
+         */
+        BasicTimerWheel (BasicTimerWheel&& other) = delete;
+
+        /**
+         * @brief move assignment operator.
+         * @param other other object to assign.
+         * @return assigned object.
+         */
+        BasicTimerWheel& operator= (BasicTimerWheel&& other) = delete;
+
+        /**
+         * @brief destroy instance.
+         */
+        ~BasicTimerWheel () noexcept
+        {
+            _reactor.delHandler (_handle);
+            close (_handle);
+        }
+
+        /**
+         * @brief get the timer wheel of the global reactor.
+         * @return timer wheel.
+         */
+        static BasicTimerWheel& instance ()
+        {
+            static BasicTimerWheel wheel;
+            return wheel;
+        }
+
+        /**
+         * @brief get tick duration.
+         * @return tick duration.
+         */
+        std::chrono::nanoseconds resolution () const noexcept
+        {
+            return std::chrono::nanoseconds (_resolution);
+        }
+
+        /**
+         * @brief get the number of armed timers.
+         * @return number of armed timers.
+         */
+        size_t size () const
+        {
+            ScopedLock<Mutex> lock (_mutex);
+            return _count;
+        }
+
+        /**
+         * @brief get event loop reactor.
+         * @return event loop reactor.
+         */
+        Reactor& reactor () const noexcept
+        {
+            return _reactor;
+        }
+
+        /**
+         * @brief get the timer type.
+         * @return the timer type.
+         */
+        static constexpr int type () noexcept
+        {
+            return ClockPolicy::type ();
+        }
+
+    private:
+        /// number of slots of the first level.
+        static constexpr size_t _rootBits = 8;
+        static constexpr size_t _rootSlots = size_t (1) << _rootBits;
+
+        /// number of slots of the upper levels.
+        static constexpr size_t _levelBits = 6;
+        static constexpr size_t _levelSlots = size_t (1) << _levelBits;
+
+        /// number of upper levels.
+        static constexpr size_t _levels = 4;
+
+        /// bucket of the expired timers waiting for their callback.
+        static constexpr size_t _dueBucket = _rootSlots + (_levels * _levelSlots);
+
+        /// number of buckets.
+        static constexpr size_t _bucketCount = _dueBucket + 1;
+
+        /// unlinked timer.
+        static constexpr size_t _noBucket = size_t (-1);
+
+        /// farthest tick the wheel can hold.
+        static constexpr uint64_t _maxDelta = (uint64_t (1) << (_rootBits + (_levels * _levelBits))) - 1;
+
+        /// no expiry.
+        static constexpr uint64_t _never = uint64_t (-1);
+
+        /// ns per sec.
+        static constexpr int64_t _nsPerSec = 1000000000LL;
+
+        /**
+         * @brief arm a timer.
+         * @param timer timer to arm.
+         * @param ns delay before the first expiry.
+         * @param period interval between expiries (0 for a one-shot timer).
+         * @param callback function to call on expiry, swapped with the previous one.
+         */
+        void arm (Timer* timer, int64_t ns, int64_t period, std::function<void ()>& callback)
+        {
+            ScopedLock<Mutex> lock (_mutex);
+
+            if (_count == 0)
+            {
+                // nothing to expire, skip the ticks elapsed since the wheel went idle.
+                _now = std::max (_now, tick (clock ()));
+            }
+
+            unlink (timer);
+            timer->_callback.swap (callback);
+            timer->_period = (period > 0) ? uint64_t ((period + _resolution - 1) / _resolution) : 0;
+            timer->_state = Timer::Armed;
+            insert (timer, tick (clock () + std::max (ns, int64_t (0)) + _resolution - 1));
+
+            rearm ();
+        }
+
+        /**
+         * @brief cancel a timer.
+         * @param timer timer to cancel.
+         * @param callback receives the timer callback, to be destroyed outside of the lock.
+         */
+        void cancel (Timer* timer, std::function<void ()>& callback)
+        {
+            ScopedLock<Mutex> lock (_mutex);
+
+            unlink (timer);
+            timer->_callback.swap (callback);
+            timer->_state = Timer::Idle;
+        }
+
+        /**
+         * @brief release a destroyed timer, waiting for its callback if run by another thread.
+         * @param timer timer to release.
+         */
+        void release (Timer* timer)
+        {
+            {
+                ScopedLock<Mutex> lock (_mutex);
+
+                unlink (timer);
+                timer->_state = Timer::Idle;
+
+                if (_running.load (std::memory_order_relaxed) != timer)
+                {
+                    return;
+                }
+
+                if (_reactor.isReactorThread ())
+                {
+                    // destroyed by its own callback.
+                    _running.store (nullptr, std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            Backoff backoff;
+            while (_running.load (std::memory_order_acquire) == timer)
+            {
+                backoff ();
+            }
+        }
+
+        /**
+         * @brief check if a timer is armed.
+         * @param timer timer to check.
+         * @return true if armed.
+         */
+        bool active (const Timer* timer) const
+        {
+            ScopedLock<Mutex> lock (_mutex);
+            return (timer->_state == Timer::Armed) || ((timer->_state == Timer::Firing) && (timer->_period != 0));
+        }
+
+        /**
+         * @brief get the remaining time until a timer expires.
+         * @param timer timer to check.
+         * @return remaining duration.
+         */
+        std::chrono::nanoseconds remaining (const Timer* timer) const
+        {
+            ScopedLock<Mutex> lock (_mutex);
+
+            if (timer->_state != Timer::Armed)
+            {
+                return std::chrono::nanoseconds::zero ();
+            }
+
+            return std::chrono::nanoseconds (std::max (time (timer->_expires) - clock (), int64_t (0)));
+        }
+
+        /**
+         * @brief method called when the timerfd expires.
+         * @param fd file descriptor.
+         */
+        virtual void onReadable ([[maybe_unused]] int fd) override
+        {
+            uint64_t expirations;
+            if (read (_handle, &expirations, sizeof (expirations)) != sizeof (expirations))
+            {
+                return;
+            }
+
+            {
+                ScopedLock<Mutex> lock (_mutex);
+                _armed = _never;
+                advance (tick (clock ()));
+            }
+
+            for (;;)
+            {
+                std::function<void ()> callback;
+                uint64_t calls = 1;
+                Timer* timer;
+
+                {
+                    ScopedLock<Mutex> lock (_mutex);
+
+                    timer = _buckets[_dueBucket];
+                    if (timer == nullptr)
+                    {
+                        rearm ();
+                        break;
+                    }
+
+                    unlink (timer);
+                    timer->_state = Timer::Firing;
+                    if (timer->_period != 0)
+                    {
+                        // ticks missed since the expiry, as the timerfd of BasicTimer would count them.
+                        calls += (_now - 1 - timer->_expires) / timer->_period;
+                    }
+                    callback.swap (timer->_callback);
+                    _running.store (timer, std::memory_order_relaxed);
+                }
+
+                for (uint64_t i = 0; i < calls; ++i)
+                {
+                    if (callback)
+                    {
+                        callback ();
+                    }
+
+                    ScopedLock<Mutex> lock (_mutex);
+                    if ((_running.load (std::memory_order_relaxed) != timer) || (timer->_state != Timer::Firing))
+                    {
+                        break;
+                    }
+                }
+
+                ScopedLock<Mutex> lock (_mutex);
+
+                if (_running.load (std::memory_order_relaxed) == timer)
+                {
+                    // untouched by the callback: restore it and schedule the next period.
+                    if (timer->_state == Timer::Firing)
+                    {
+                        timer->_callback.swap (callback);
+                        timer->_state = Timer::Idle;
+
+                        if (timer->_period != 0)
+                        {
+                            timer->_state = Timer::Armed;
+                            insert (timer, timer->_expires + (calls * timer->_period));
+                        }
+                    }
+
+                    _running.store (nullptr, std::memory_order_release);
+                }
+            }
+        }
+
+        /**
+         * @brief link a timer in the bucket matching its expiry.
+         * @param timer timer to link.
+         * @param expires expiry tick.
+         */
+        void insert (Timer* timer, uint64_t expires) noexcept
+        {
+            timer->_expires = std::max (expires, _now);
+
+            const uint64_t delta = timer->_expires - _now;
+            size_t bucket;
+
+            if (delta < _rootSlots)
+            {
+                bucket = timer->_expires & (_rootSlots - 1);
+            }
+            else
+            {
+                // too far timers are parked in the last level and placed again on cascade.
+                const uint64_t target = _now + ((delta < _maxDelta) ? delta : _maxDelta);
+                size_t level = 0;
+
+                while (((target - _now) >> (_rootBits + ((level + 1) * _levelBits))) != 0)
+                {
+                    ++level;
+                }
+
+                bucket = _rootSlots + (level * _levelSlots) +
+                         ((target >> (_rootBits + (level * _levelBits))) & (_levelSlots - 1));
+            }
+
+            link (timer, bucket);
+            ++_count;
+        }
+
+        /**
+         * @brief link a timer at the head of a bucket.
+         * @param timer timer to link.
+         * @param bucket bucket index.
+         */
+        void link (Timer* timer, size_t bucket) noexcept
+        {
+            timer->_bucket = bucket;
+            timer->_prev = nullptr;
+            timer->_next = _buckets[bucket];
+
+            if (timer->_next != nullptr)
+            {
+                timer->_next->_prev = timer;
+            }
+
+            _buckets[bucket] = timer;
+
+            if (bucket < _rootSlots)
+            {
+                _bitmap[bucket >> 6] |= uint64_t (1) << (bucket & 63);
+            }
+        }
+
+        /**
+         * @brief unlink a timer from its bucket.
+         * @param timer timer to unlink.
+         */
+        void unlink (Timer* timer) noexcept
+        {
+            const size_t bucket = timer->_bucket;
+            if (bucket == _noBucket)
+            {
+                return;
+            }
+
+            if (timer->_prev != nullptr)
+            {
+                timer->_prev->_next = timer->_next;
+            }
+            else
+            {
+                _buckets[bucket] = timer->_next;
+            }
+
+            if (timer->_next != nullptr)
+            {
+                timer->_next->_prev = timer->_prev;
+            }
+
+            if ((bucket < _rootSlots) && (_buckets[bucket] == nullptr))
+            {
+                _bitmap[bucket >> 6] &= ~(uint64_t (1) << (bucket & 63));
+            }
+
+            timer->_prev = timer->_next = nullptr;
+            timer->_bucket = _noBucket;
+
+            if (bucket != _dueBucket)
+            {
+                --_count;
+            }
+        }
+
+        /**
+         * @brief move the timers of an upper level slot down the wheel.
+         * @param level upper level.
+         * @return slot index, 0 when the level wrapped.
+         */
+        size_t cascade (size_t level) noexcept
+        {
+            const size_t index = (_now >> (_rootBits + (level * _levelBits))) & (_levelSlots - 1);
+            const size_t bucket = _rootSlots + (level * _levelSlots) + index;
+
+            Timer* timer = _buckets[bucket];
+            _buckets[bucket] = nullptr;
+
+            while (timer != nullptr)
+            {
+                Timer* next = timer->_next;
+                timer->_bucket = _noBucket;
+                --_count;
+                insert (timer, timer->_expires);
+                timer = next;
+            }
+
+            return index;
+        }
+
+        /**
+         * @brief process ticks up to the given one, moving expired timers to the due bucket.
+         * @param target last tick to process.
+         */
+        void advance (uint64_t target) noexcept
+        {
+            while (_now <= target)
+            {
+                const size_t index = _now & (_rootSlots - 1);
+
+                if (index == 0)
+                {
+                    for (size_t level = 0; (level < _levels) && (cascade (level) == 0); ++level)
+                    {
+                    }
+                }
+
+                while (_buckets[index] != nullptr)
+                {
+                    Timer* timer = _buckets[index];
+                    unlink (timer);
+                    link (timer, _dueBucket);
+                }
+
+                // jump to the next slot holding timers, or to the next turn.
+                _now = std::min (_now - index + next (index + 1), target + 1);
+            }
+        }
+
+        /**
+         * @brief find the next first level slot holding timers.
+         * @param from first slot to check.
+         * @return slot index, or number of slots if none.
+         */
+        size_t next (size_t from) const noexcept
+        {
+            for (size_t word = from >> 6; word < _bitmap.size (); ++word)
+            {
+                uint64_t bits = _bitmap[word];
+                if (word == (from >> 6))
+                {
+                    bits &= ~uint64_t (0) << (from & 63);
+                }
+
+                if (bits != 0)
+                {
+                    return (word << 6) + size_t (__builtin_ctzll (bits));
+                }
+            }
+
+            return _rootSlots;
+        }
+
+        /**
+         * @brief arm the timerfd for the next tick holding timers, if earlier than the armed one.
+         */
+        void rearm () noexcept
+        {
+            if (_count == 0)
+            {
+                return;
+            }
+
+            const size_t index = _now & (_rootSlots - 1);
+            const uint64_t expires = _now - index + next (index);
+
+            if (expires < _armed)
+            {
+                _armed = expires;
+
+                itimerspec ts{};
+                ts.it_value.tv_sec = time (expires) / _nsPerSec;
+                ts.it_value.tv_nsec = time (expires) % _nsPerSec;
+                timerfd_settime (_handle, TFD_TIMER_ABSTIME, &ts, nullptr);
+            }
+        }
+
+        /**
+         * @brief read the wheel clock.
+         * @return current time in nanoseconds.
+         */
+        static int64_t clock () noexcept
+        {
+            timespec ts{};
+            ::clock_gettime (ClockPolicy::type (), &ts);
+            return (int64_t (ts.tv_sec) * _nsPerSec) + ts.tv_nsec;
+        }
+
+        /**
+         * @brief convert time to tick.
+         * @param ns time in nanoseconds.
+         * @return tick (rounded down).
+         */
+        uint64_t tick (int64_t ns) const noexcept
+        {
+            return uint64_t (std::max (ns - _origin, int64_t (0)) / _resolution);
+        }
+
+        /**
+         * @brief convert tick to time.
+         * @param tick tick.
+         * @return time in nanoseconds.
+         */
+        int64_t time (uint64_t tick) const noexcept
+        {
+            return _origin + (int64_t (tick) * _resolution);
+        }
+
+        /// timer handle.
+        int _handle = -1;
+
+        /// tick duration in nanoseconds.
+        int64_t _resolution;
+
+        /// time of tick 0.
+        int64_t _origin;
+
+        /// next tick to process.
+        uint64_t _now = 0;
+
+        /// tick the timerfd is armed for.
+        uint64_t _armed = _never;
+
+        /// number of timers linked in the wheel.
+        size_t _count = 0;
+
+        /// timer lists.
+        std::array<Timer*, _bucketCount> _buckets;
+
+        /// first level slots holding timers.
+        std::array<uint64_t, _rootSlots / 64> _bitmap;
+
+        /// timer whose callback is running.
+        std::atomic<Timer*> _running{nullptr};
+
+        /// protect wheel and timers.
+        mutable Mutex _mutex;
+
+        /// event loop reactor.
+        Reactor& _reactor;
+
+        /// friendship with timer.
+        friend Timer;
+    };
+
+    /**
+     * @brief timer scheduled by a timer wheel.
+     */
+    template <class ClockPolicy>
+    class BasicWheelTimer
+    {
+    public:
+        /**
+         * @brief create instance.
+         * @param wheel timer wheel.
+         */
+        explicit BasicWheelTimer (BasicTimerWheel<ClockPolicy>& wheel = BasicTimerWheel<ClockPolicy>::instance ())
+        : _wheel (wheel)
+        {
+        }
+
+        /**
+         * @brief copy constructor.
+         * @param other other object to copy.
+         */
+        BasicWheelTimer (const BasicWheelTimer& other) = delete;
+
+        /**
+         * @brief copy assignment operator.
+         * @param other other object to assign.
+         * @return assigned object.
+         */
+        BasicWheelTimer& operator= (const BasicWheelTimer& other) = delete;
+
+        /**
+         * @brief move constructor.
+         * @param other other object to move.
+         */
+        BasicWheelTimer (BasicWheelTimer&& other) = delete;
+
+        /**
+         * @brief move assignment operator.
+         * @param other other object to assign.
+         * @return assigned object.
+         */
+        BasicWheelTimer& operator= (BasicWheelTimer&& other) = delete;
+
+        /**
+         * @brief destroy instance.
+         */
+        ~BasicWheelTimer () noexcept
+        {
+            _wheel.release (this);
+        }
+
+        /**
+         * @brief arm the timer as a one-shot timer.
+         * @param duration timeout duration before timer expires.
+         * @param callback function to call when timer expires.
+         */
+        template <class Rep, class Period, typename Func>
+        void setOneShot (std::chrono::duration<Rep, Period> duration, Func&& callback)
+        {
+            std::function<void ()> func (std::forward<Func> (callback));
+            _oneShot = true;
+            _ns = std::chrono::nanoseconds::zero ();
+            _wheel.arm (this, std::chrono::duration_cast<std::chrono::nanoseconds> (duration).count (), 0, func);
+        }
+
+        /**
+         * @brief arm the timer as a one-shot timer with absolute time.
+         * @param timePoint absolute time when timer should expire.
+         * @param callback function to call when timer expires.
+         */
+        template <class Clock, class Duration, typename Func>
+        void setOneShot (std::chrono::time_point<Clock, Duration> timePoint, Func&& callback)
+        {
+            static_assert (
+                (std::is_same<ClockPolicy, RealTime>::value && std::is_same<Clock, std::chrono::system_clock>::value) ||
+                    (std::is_same<ClockPolicy, Monotonic>::value &&
+                     std::is_same<Clock, std::chrono::steady_clock>::value),
+                "Clock type mismatch timer policy");
+
+            this->setOneShot (timePoint - Clock::now (), std::forward<Func> (callback));
+        }
+
+        /**
+         * @brief arm the timer as a periodic timer.
+         * @param duration interval duration between timer expirations.
+         * @param callback function to call on each timer expiration.
+         */
+        template <class Rep, class Period, typename Func>
+        void setInterval (std::chrono::duration<Rep, Period> duration, Func&& callback)
+        {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds> (duration);
+            std::function<void ()> func (std::forward<Func> (callback));
+            _oneShot = false;
+            _ns = ns;
+            _wheel.arm (this, ns.count (), ns.count (), func);
+        }
+
+        /**
+         * @brief cancel the timer.
+         */
+        void cancel () noexcept
+        {
+            std::function<void ()> func;
+            _oneShot = true;
+            _ns = std::chrono::nanoseconds::zero ();
+            _wheel.cancel (this, func);
+        }
+
+        /**
+         * @brief check if timer is running.
+         * @return true if timer is active.
+         */
+        bool active () const
+        {
+            return _wheel.active (this);
+        }
+
+        /**
+         * @brief get the remaining time until expiration.
+         * @return remaining duration.
+         */
+        std::chrono::nanoseconds remaining () const
+        {
+            return _wheel.remaining (this);
+        }
+
+        /**
+         * @brief get the interval of the running periodic timer.
+         * @return interval duration in nanoseconds, zero if one-shot or inactive.
+         */
+        std::chrono::nanoseconds interval () const noexcept
+        {
+            return _ns;
+        }
+
+        /**
+         * @brief check if timer is a one-shot timer.
+         * @return true if timer is a one-shot timer.
+         */
+        bool oneShot () const noexcept
+        {
+            return _oneShot;
+        }
+
+        /**
+         * @brief get the timer type.
+         * @return the timer type.
+         */
+        static constexpr int type () noexcept
+        {
+            return ClockPolicy::type ();
+        }
+
+    private:
+        /**
+         * @brief timer state.
+         */
+        enum State
+        {
+            Idle,   /**< not armed. */
+            Armed,  /**< linked in the wheel. */
+            Firing, /**< callback running. */
+        };
+
+        /// timer wheel.
+        BasicTimerWheel<ClockPolicy>& _wheel;
+
+        /// callback function.
+        std::function<void ()> _callback;
+
+        /// interval.
+        std::chrono::nanoseconds _ns{};
+
+        /// timer type.
+        bool _oneShot = true;
+
+        /// timer state.
+        State _state = Idle;
+
+        /// expiry tick.
+        uint64_t _expires = 0;
+
+        /// period in ticks (0 for a one-shot timer).
+        uint64_t _period = 0;
+
+        /// wheel bucket.
+        size_t _bucket = size_t (-1);
+
+        /// previous timer in bucket.
+        BasicWheelTimer* _prev = nullptr;
+
+        /// next timer in bucket.
+        BasicWheelTimer* _next = nullptr;
+
+        /// friendship with timer wheel.
+        friend class BasicTimerWheel<ClockPolicy>;
+    };
+}
+
+#endif
@@ -0,0 +1,331 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/thread_pool.hpp>
+
+// C++.
+#include <functional>
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <deque>
+
+// C.
+#include <unistd.h>
+
+/**
+ * @brief reference pool with a single job queue protected by a mutex.
+ */
+class LockedPool
+{
+public:
+    /**
+     * @brief create the pool.
+     * @param workers number of worker threads.
+     */
+    explicit LockedPool (int workers)
+    {
+        for (int i = 0; i < workers; ++i)
+        {
+            _workers.emplace_back ([this] () {
+                for (;;)
+                {
+                    std::function<void ()> job;
+                    {
+                        join::ScopedLock<join::Mutex> lock (_mutex);
+                        _condition.wait (lock, [this] () {
+                            return _stop || !_jobs.empty ();
+                        });
+                        if (_stop && _jobs.empty ())
+                        {
+                            return;
+                        }
+                        job = std::move (_jobs.front ());
+                        _jobs.pop_front ();
+                    }
+                    job ();
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief stop the workers once every job ran.
+     */
+    ~LockedPool ()
+    {
+        {
+            join::ScopedLock<join::Mutex> lock (_mutex);
+            _stop = true;
+        }
+        _condition.broadcast ();
+
+        for (auto& worker : _workers)
+        {
+            worker.join ();
+        }
+    }
+
+    /**
+     * @brief push a job.
+     * @param func callable to execute.
+     * @param args arguments to pass to the callable.
+     */
+    template <class Function, class... Args>
+    void push (Function&& func, Args&&... args)
+    {
+        join::ScopedLock<join::Mutex> lock (_mutex);
+        _jobs.emplace_back (std::bind (std::forward<Function> (func), std::forward<Args> (args)...));
+        _condition.signal ();
+    }
+
+private:
+    /// worker threads.
+    std::vector<join::Thread> _workers;
+
+    /// jobs queue.
+    std::deque<std::function<void ()>> _jobs;
+
+    /// condition shared with worker threads.
+    join::Condition _condition;
+
+    /// condition protection mutex.
+    join::Mutex _mutex;
+
+    /// gracefully stop all threads.
+    bool _stop = false;
+};
+
+/**
+ * @brief fork/join fibonacci, each call above the leaves pushes its two sub calls.
+ */
+template <class Pool>
+struct Fibonacci
+{
+    /**
+     * @brief compute a fibonacci number.
+     * @param n index.
+     */
+    void operator() (int n)
+    {
+        if (n < 2)
+        {
+            sum.fetch_add (n, std::memory_order_relaxed);
+        }
+        else
+        {
+            pending.fetch_add (2, std::memory_order_relaxed);
+            pool.push (std::ref (*this), n - 1);
+            pool.push (std::ref (*this), n - 2);
+        }
+
+        pending.fetch_sub (1, std::memory_order_release);
+    }
+
+    /// pool running the calls.
+    Pool& pool;
+
+    /// sum of the leaves.
+    std::atomic<uint64_t> sum{0};
+
+    /// calls not completed yet.
+    std::atomic<uint64_t> pending{1};
+};
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : usage
+// =========================================================================
+void usage ()
+{
+    std::cout << "Usage\n"
+              << "  poolbench [options]\n"
+              << "\n"
+              << "Options\n"
+              << "  -f index          fibonacci index of the fork/join run (default: 25)\n"
+              << "  -h                show available options\n"
+              << "  -l loops          number of parallel loops of the loop run (default: 1000)\n"
+              << "  -n tasks          number of empty tasks of the flood run (default: 1000000)\n"
+              << "  -w workers        number of worker threads (default: one per physical core)\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : wait
+// =========================================================================
+void wait (const std::atomic<uint64_t>& counter, uint64_t value)
+{
+    while (counter.load (std::memory_order_acquire) != value)
+    {
+        std::this_thread::yield ();
+    }
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : benchmark
+// =========================================================================
+template <class Pool>
+void benchmark (const std::string& name, int workers, int index, uint64_t tasks)
+{
+    Pool pool (workers);
+
+    Fibonacci<Pool> fib{pool};
+    auto beg = std::chrono::steady_clock::now ();
+    pool.push (std::ref (fib), index);
+    wait (fib.pending, 0);
+    auto mid = std::chrono::steady_clock::now ();
+
+    std::atomic<uint64_t> done{0};
+    for (uint64_t i = 0; i < tasks; ++i)
+    {
+        pool.push ([&done] () {
+            done.fetch_add (1, std::memory_order_release);
+        });
+    }
+    wait (done, tasks);
+    auto end = std::chrono::steady_clock::now ();
+
+    auto forkJoin = std::chrono::duration_cast<std::chrono::microseconds> (mid - beg);
+    auto flood = std::chrono::duration_cast<std::chrono::microseconds> (end - mid);
+
+    std::cout << name << "\n"
+              << "fib(" << index << "):                " << fib.sum << " in " << forkJoin.count () / 1000.0
+              << " ms\n"
+              << "flood:                  " << tasks << " tasks in " << flood.count () / 1000.0 << " ms ("
+              << flood.count () * 1000.0 / tasks << " ns/task)\n"
+              << "\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : threadForEach
+// =========================================================================
+template <class InputIt, class Func>
+void threadForEach (int workers, InputIt first, InputIt last, Func function)
+{
+    // reference loop creating its threads on each call and splitting the range statically.
+    size_t count = std::distance (first, last);
+    size_t concurrency = std::min (size_t (workers) + 1, count);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 1; i < concurrency; ++i)
+    {
+        threads.emplace_back ([&, i] () {
+            std::for_each (first + (count * i) / concurrency, first + (count * (i + 1)) / concurrency, function);
+        });
+    }
+
+    std::for_each (first, first + count / concurrency, function);
+
+    for (auto& thread : threads)
+    {
+        thread.join ();
+    }
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : loop
+// =========================================================================
+void loop (int workers, uint64_t loops)
+{
+    join::ThreadPool pool (workers);
+    std::vector<uint64_t> values (4096);
+    std::iota (values.begin (), values.end (), 0);
+
+    auto increment = [] (uint64_t& value) {
+        ++value;
+    };
+
+    auto beg = std::chrono::steady_clock::now ();
+    for (uint64_t i = 0; i < loops; ++i)
+    {
+        join::parallelForEach (pool, values.begin (), values.end (), increment, 256);
+    }
+    auto mid = std::chrono::steady_clock::now ();
+    for (uint64_t i = 0; i < loops; ++i)
+    {
+        threadForEach (workers, values.begin (), values.end (), increment);
+    }
+    auto end = std::chrono::steady_clock::now ();
+
+    auto pooled = std::chrono::duration_cast<std::chrono::microseconds> (mid - beg);
+    auto spawned = std::chrono::duration_cast<std::chrono::microseconds> (end - mid);
+
+    std::cout << "parallel loop (" << values.size () << " elements)\n"
+              << "pooled:                 " << loops << " loops in " << pooled.count () / 1000.0 << " ms ("
+              << double (pooled.count ()) / loops << " us/loop)\n"
+              << "per call threads:       " << loops << " loops in " << spawned.count () / 1000.0 << " ms ("
+              << double (spawned.count ()) / loops << " us/loop)\n"
+              << "\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : main
+// =========================================================================
+int main (int argc, char* argv[])
+{
+    int workers = int (join::CpuTopology::instance ()->cores ().size ());
+    int index = 25;
+    uint64_t tasks = 1000000;
+    uint64_t loops = 1000;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "f:hl:n:w:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'f':
+                index = std::stoi (optarg);
+                break;
+            case 'h':
+                usage ();
+                return EXIT_SUCCESS;
+            case 'l':
+                loops = std::stoull (optarg);
+                break;
+            case 'n':
+                tasks = std::stoull (optarg);
+                break;
+            case 'w':
+                workers = std::max (std::stoi (optarg), 1);
+                break;
+            default:
+                usage ();
+                return EXIT_FAILURE;
+        }
+    }
+
+    benchmark<join::ThreadPool> ("work-stealing pool", workers, index, tasks);
+    benchmark<LockedPool> ("locked pool", workers, index, tasks);
+    loop (workers, loops);
+
+    return EXIT_SUCCESS;
+}
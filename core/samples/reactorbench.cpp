@@ -0,0 +1,213 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/reactor.hpp>
+#include <join/thread.hpp>
+#include <join/utils.hpp>
+
+// C++.
+#include <iostream>
+#include <vector>
+
+// C.
+#include <sys/resource.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <cstring>
+
+/**
+ * @brief handler counting dispatched events.
+ */
+class Counter : public join::EventHandler
+{
+public:
+    /**
+     * @brief create the counter.
+     * @param reactor reactor to stop once all events have been dispatched.
+     * @param events number of events to dispatch.
+     */
+    Counter (join::Reactor& reactor, uint64_t events)
+    : _reactor (reactor)
+    , _events (events)
+    {
+    }
+
+protected:
+    /**
+     * @brief method called when data are ready to be read on handle.
+     * @param fd file descriptor.
+     */
+    void onReadable ([[maybe_unused]] int fd) override
+    {
+        // the event is never consumed so that the fd is reported again on each wait.
+        if (++_count == _events)
+        {
+            _reactor.stop ();
+        }
+    }
+
+    /// reactor.
+    join::Reactor& _reactor;
+
+    /// number of events to dispatch.
+    uint64_t _events;
+
+    /// number of events dispatched.
+    uint64_t _count = 0;
+};
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : usage
+// =========================================================================
+void usage ()
+{
+    std::cout << "Usage\n"
+              << "  reactorbench [options]\n"
+              << "\n"
+              << "Options\n"
+              << "  -a active         number of ready file descriptors (default: 1000)\n"
+              << "  -e events         number of events to dispatch (default: 10000000)\n"
+              << "  -h                show available options\n"
+              << "  -n fds            number of registered file descriptors (default: 10000 and 100000)\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : benchmark
+// =========================================================================
+int benchmark (size_t fds, size_t active, uint64_t events)
+{
+    struct rlimit limit;
+    getrlimit (RLIMIT_NOFILE, &limit);
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit (RLIMIT_NOFILE, &limit);
+
+    if (limit.rlim_cur < fds + 64)
+    {
+        std::cerr << fds << " fds: skipped, open files limited to " << limit.rlim_cur << "\n";
+        return -1;
+    }
+
+    join::Reactor reactor;
+    join::Thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    Counter counter (reactor, events);
+    std::vector<int> handles;
+    handles.reserve (fds);
+
+    for (size_t i = 0; i < fds; ++i)
+    {
+        int fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if ((fd == -1) || (reactor.addHandler (fd, &counter) == -1))
+        {
+            std::cerr << "failed to register fd: " << std::strerror (errno) << "\n";
+            return -1;
+        }
+        handles.push_back (fd);
+    }
+
+    // spread the ready fds over the whole table.
+    const size_t stride = std::max (fds / std::max (active, size_t (1)), size_t (1));
+
+    const auto elapsed = join::benchmark ([&] () {
+        uint64_t value = 1;
+        for (size_t i = 0; i < fds; i += stride)
+        {
+            if (::write (handles[i], &value, sizeof (value)) == -1)
+            {
+                break;
+            }
+        }
+        th.join ();
+    });
+
+    for (int fd : handles)
+    {
+        ::close (fd);
+    }
+
+    std::cout << "registered fds:         " << fds << "\n"
+              << "ready fds:              " << (fds + stride - 1) / stride << "\n"
+              << "dispatched events:      " << events << "\n"
+              << "time taken:             " << elapsed.count () << " ms\n"
+              << "dispatch cost:          " << elapsed.count () * 1e6 / events << " ns/event\n"
+              << "\n";
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : main
+// =========================================================================
+int main (int argc, char* argv[])
+{
+    std::vector<size_t> fds;
+    size_t active = 1000;
+    uint64_t events = 10000000;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "a:e:hn:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'a':
+                active = std::stoul (optarg);
+                break;
+            case 'e':
+                events = std::stoull (optarg);
+                break;
+            case 'h':
+                usage ();
+                return EXIT_SUCCESS;
+            case 'n':
+                fds.push_back (std::stoul (optarg));
+                break;
+            default:
+                usage ();
+                return EXIT_FAILURE;
+        }
+    }
+
+    if (fds.empty ())
+    {
+        fds = {10000, 100000};
+    }
+
+    int res = EXIT_SUCCESS;
+
+    for (size_t n : fds)
+    {
+        if (benchmark (n, active, events) == -1)
+        {
+            res = EXIT_FAILURE;
+        }
+    }
+
+    return res;
+}
@@ -0,0 +1,438 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/acceptor.hpp>
+#include <join/proactor.hpp>
+#include <join/thread.hpp>
+
+// C++.
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+// C.
+#include <sys/resource.h>
+#include <unistd.h>
+#include <cstring>
+
+using join::IoOperation;
+using join::Proactor;
+using join::Tcp;
+
+/**
+ * @brief handler keeping a stream socket busy with send operations for a given duration.
+ */
+class Sender : public join::CompletionHandler
+{
+public:
+    /**
+     * @brief create the sender.
+     * @param proactor proactor running the operations.
+     * @param fd connected socket.
+     * @param size payload size of each send.
+     * @param depth number of payload buffers.
+     * @param zeroCopy use zero-copy sends.
+     */
+    Sender (Proactor& proactor, int fd, size_t size, size_t depth, bool zeroCopy)
+    : _proactor (proactor)
+    , _payload (size * depth, 'x')
+    {
+        for (size_t i = 0; i < depth; ++i)
+        {
+            const char* buf = _payload.data () + (i * size);
+            _ops.push_back (zeroCopy ? IoOperation::makeSendZc (fd, buf, size, MSG_NOSIGNAL, this)
+                                     : IoOperation::makeSend (fd, buf, size, MSG_NOSIGNAL, this));
+        }
+
+        for (auto& op : _ops)
+        {
+            _free.push_back (&op);
+        }
+    }
+
+    /**
+     * @brief send until the deadline passed, then stop the proactor once every buffer was released.
+     * @param duration send duration.
+     */
+    void start (std::chrono::milliseconds duration)
+    {
+        _deadline = std::chrono::steady_clock::now () + duration;
+        sendNext ();
+    }
+
+    /**
+     * @brief get the number of bytes sent.
+     * @return number of bytes sent.
+     */
+    uint64_t bytes () const noexcept
+    {
+        return _bytes;
+    }
+
+    /**
+     * @brief check if a send failed.
+     * @return true if a send failed.
+     */
+    bool failed () const noexcept
+    {
+        return _failed;
+    }
+
+protected:
+    /**
+     * @brief method called when a send completes.
+     * @param op completed operation.
+     * @param result bytes sent or negative errno.
+     */
+    void onComplete (IoOperation* op, int result) override
+    {
+        _sending = false;
+
+        if (result < 0)
+        {
+            _failed = true;
+        }
+        else
+        {
+            _bytes += result;
+        }
+
+        sendNext ();
+
+        if (!op->zeroCopy ())
+        {
+            // idle once the handler returns, picked again on a later completion.
+            _free.push_back (op);
+            finish ();
+        }
+    }
+
+    /**
+     * @brief method called when a send is cancelled.
+     * @param op cancelled operation.
+     * @param result negative errno.
+     */
+    void onCancel ([[maybe_unused]] IoOperation* op, [[maybe_unused]] int result) override
+    {
+        _sending = false;
+        _failed = true;
+    }
+
+    /**
+     * @brief method called when the kernel releases the buffer of a zero-copy send.
+     * @param op released operation.
+     */
+    void onRelease (IoOperation* op) override
+    {
+        _free.push_back (op);
+
+        if (!_sending)
+        {
+            sendNext ();
+        }
+
+        finish ();
+    }
+
+    /**
+     * @brief submit a send using the next free buffer.
+     */
+    void sendNext ()
+    {
+        if (_failed || _free.empty () || (std::chrono::steady_clock::now () >= _deadline))
+        {
+            return;
+        }
+
+        IoOperation* op = _free.back ();
+        _free.pop_back ();
+
+        if (_proactor.submit (op, true) == -1)
+        {
+            _free.push_back (op);
+            _failed = true;
+            return;
+        }
+
+        _sending = true;
+    }
+
+    /**
+     * @brief stop the proactor once nothing is in flight anymore.
+     */
+    void finish ()
+    {
+        if (!_sending && (_free.size () == _ops.size ()))
+        {
+            _proactor.stop (false);
+        }
+    }
+
+    /// proactor.
+    Proactor& _proactor;
+
+    /// payload buffers.
+    std::vector<char> _payload;
+
+    /// send operations.
+    std::vector<IoOperation> _ops;
+
+    /// operations whose buffer can be reused.
+    std::vector<IoOperation*> _free;
+
+    /// a send is waiting for completion.
+    bool _sending = false;
+
+    /// a send failed.
+    bool _failed = false;
+
+    /// number of bytes sent.
+    uint64_t _bytes = 0;
+
+    /// end of the run.
+    std::chrono::steady_clock::time_point _deadline;
+};
+
+/**
+ * @brief result of a run.
+ */
+struct Result
+{
+    /// throughput in MB/s.
+    double throughput;
+
+    /// cpu time of the sending thread per KiB sent.
+    double cost;
+};
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : usage
+// =========================================================================
+void usage ()
+{
+    std::cout << "Usage\n"
+              << "  sendzcbench [options]\n"
+              << "\n"
+              << "Options\n"
+              << "  -a address        sink address, the data are discarded by a local sink if not set\n"
+              << "  -d duration       duration of each run in milliseconds (default: 1000)\n"
+              << "  -h                show available options\n"
+              << "  -m size           smallest payload size (default: 1024)\n"
+              << "  -M size           largest payload size (default: 1048576)\n"
+              << "  -p port           sink port (default: 5000)\n"
+              << "  -q depth          number of payload buffers in flight (default: 8)\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : cpuTime
+// =========================================================================
+std::chrono::nanoseconds cpuTime ()
+{
+    struct rusage usage;
+    getrusage (RUSAGE_THREAD, &usage);
+
+    return std::chrono::seconds (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           std::chrono::microseconds (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : benchmark
+// =========================================================================
+int benchmark (const Tcp::Endpoint& sink, size_t size, size_t depth, bool zeroCopy,
+               std::chrono::milliseconds duration, Result& result)
+{
+    Tcp::Socket sock (Tcp::Socket::Blocking);
+    if (sock.connect (sink) == -1)
+    {
+        std::cerr << "failed to connect: " << join::lastError.message () << "\n";
+        return -1;
+    }
+    sock.setMode (Tcp::Socket::NonBlocking);
+    sock.setOption (Tcp::Socket::NoDelay, 1);
+
+    Proactor proactor;
+    Sender sender (proactor, sock.handle (), size, depth, zeroCopy);
+
+    // run the proactor in the current thread so that its cpu time can be measured.
+    sender.start (duration);
+    auto cpu = cpuTime ();
+    auto beg = std::chrono::steady_clock::now ();
+    proactor.run ();
+    auto end = std::chrono::steady_clock::now ();
+    cpu = cpuTime () - cpu;
+
+    sock.close ();
+
+    if (sender.failed () || (sender.bytes () == 0))
+    {
+        std::cerr << "send failed: " << (zeroCopy ? "zero-copy" : "copy") << ", " << size << " bytes\n";
+        return -1;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds> (end - beg);
+    result.throughput = sender.bytes () * 1e3 / elapsed.count ();
+    result.cost = cpu.count () * 1024.0 / sender.bytes ();
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : main
+// =========================================================================
+int main (int argc, char* argv[])
+{
+    std::string address;
+    uint16_t port = 5000;
+    size_t minSize = 1024;
+    size_t maxSize = 1048576;
+    size_t depth = 8;
+    std::chrono::milliseconds duration (1000);
+
+    int opt;
+    while ((opt = getopt (argc, argv, "a:d:hm:M:p:q:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'a':
+                address = optarg;
+                break;
+            case 'd':
+                duration = std::chrono::milliseconds (std::stoul (optarg));
+                break;
+            case 'h':
+                usage ();
+                return EXIT_SUCCESS;
+            case 'm':
+                minSize = std::stoul (optarg);
+                break;
+            case 'M':
+                maxSize = std::stoul (optarg);
+                break;
+            case 'p':
+                port = std::stoul (optarg);
+                break;
+            case 'q':
+                depth = std::max (std::stoul (optarg), 2UL);
+                break;
+            default:
+                usage ();
+                return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<size_t> sizes;
+    for (size_t size = std::max (minSize, size_t (1)); size <= maxSize; size *= 2)
+    {
+        sizes.push_back (size);
+    }
+
+    Tcp::Acceptor acceptor;
+    join::Thread sink;
+
+    if (address.empty ())
+    {
+        std::cout << "local sink: the kernel copies the data delivered to a local peer, use -a to measure zero-copy "
+                     "against a remote sink\n\n";
+
+        address = "127.0.0.1";
+        if (acceptor.create ({address, port}) == -1)
+        {
+            std::cerr << "failed to create sink: " << join::lastError.message () << "\n";
+            return EXIT_FAILURE;
+        }
+
+        sink = join::Thread ([&acceptor, runs = sizes.size () * 2] () {
+            std::vector<char> buf (1048576);
+            for (size_t run = 0; run < runs; ++run)
+            {
+                Tcp::Socket peer = acceptor.accept ();
+                if (!peer.connected ())
+                {
+                    break;
+                }
+                peer.setMode (Tcp::Socket::Blocking);
+                while (peer.read (buf.data (), buf.size ()) > 0)
+                {
+                }
+            }
+        });
+    }
+
+    std::cout << std::setw (12) << "size" << std::setw (14) << "copy MB/s" << std::setw (14) << "zc MB/s"
+              << std::setw (16) << "copy ns/KiB" << std::setw (16) << "zc ns/KiB" << "\n";
+
+    size_t crossover = 0;
+
+    for (size_t size : sizes)
+    {
+        Result copy, zc;
+
+        if ((benchmark ({address, port}, size, depth, false, duration, copy) == -1) ||
+            (benchmark ({address, port}, size, depth, true, duration, zc) == -1))
+        {
+            if (sink.joinable ())
+            {
+                // wake up the sink blocked in accept.
+                ::shutdown (acceptor.handle (), SHUT_RDWR);
+                sink.join ();
+            }
+            return EXIT_FAILURE;
+        }
+
+        std::cout << std::fixed << std::setprecision (1) << std::setw (12) << size << std::setw (14)
+                  << copy.throughput << std::setw (14) << zc.throughput << std::setw (16) << copy.cost
+                  << std::setw (16) << zc.cost << "\n";
+
+        // smallest size from which zero-copy keeps costing less cpu per byte.
+        if (zc.cost >= copy.cost)
+        {
+            crossover = 0;
+        }
+        else if (crossover == 0)
+        {
+            crossover = size;
+        }
+    }
+
+    if (crossover)
+    {
+        std::cout << "\ncrossover:              " << crossover << " bytes\n";
+    }
+    else
+    {
+        std::cout << "\ncrossover:              not reached\n";
+    }
+
+    if (sink.joinable ())
+    {
+        sink.join ();
+    }
+
+    return EXIT_SUCCESS;
+}
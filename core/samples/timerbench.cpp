@@ -0,0 +1,147 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/timer_wheel.hpp>
+#include <join/timer.hpp>
+
+// C++.
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// C.
+#include <sys/resource.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : usage
+// =========================================================================
+void usage ()
+{
+    std::cout << "Usage\n"
+              << "  timerbench [options]\n"
+              << "\n"
+              << "Options\n"
+              << "  -h                show available options\n"
+              << "  -n timers         number of timers (default: 10000)\n"
+              << "  -r rounds         number of arm/cancel rounds (default: 10)\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : benchmark
+// =========================================================================
+template <class Timer>
+void benchmark (const std::string& name, size_t count, size_t rounds)
+{
+    std::vector<std::unique_ptr<Timer>> timers;
+    timers.reserve (count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        timers.emplace_back (new Timer);
+    }
+
+    std::chrono::nanoseconds arm{0}, cancel{0};
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        // delays spread over several seconds so that nothing expires during the run.
+        auto beg = std::chrono::steady_clock::now ();
+        for (size_t i = 0; i < count; ++i)
+        {
+            timers[i]->setOneShot (10s + std::chrono::milliseconds (i % 5000), [] () {
+            });
+        }
+        auto mid = std::chrono::steady_clock::now ();
+        for (auto& timer : timers)
+        {
+            timer->cancel ();
+        }
+        auto end = std::chrono::steady_clock::now ();
+
+        arm += mid - beg;
+        cancel += end - mid;
+    }
+
+    const double ops = double (count) * rounds;
+
+    std::cout << name << "\n"
+              << "timers:                 " << count << "\n"
+              << "arm cost:               " << arm.count () / ops << " ns/op\n"
+              << "cancel cost:            " << cancel.count () / ops << " ns/op\n"
+              << "\n";
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : main
+// =========================================================================
+int main (int argc, char* argv[])
+{
+    size_t count = 10000;
+    size_t rounds = 10;
+
+    int opt;
+    while ((opt = getopt (argc, argv, "hn:r:")) != -1)
+    {
+        switch (opt)
+        {
+            case 'h':
+                usage ();
+                return EXIT_SUCCESS;
+            case 'n':
+                count = std::stoul (optarg);
+                break;
+            case 'r':
+                rounds = std::stoul (optarg);
+                break;
+            default:
+                usage ();
+                return EXIT_FAILURE;
+        }
+    }
+
+    benchmark<join::Monotonic::WheelTimer> ("timer wheel", count, rounds);
+
+    // one timerfd per timer.
+    struct rlimit limit;
+    getrlimit (RLIMIT_NOFILE, &limit);
+    limit.rlim_cur = limit.rlim_max;
+    setrlimit (RLIMIT_NOFILE, &limit);
+
+    if (limit.rlim_cur < count + 64)
+    {
+        std::cerr << "timerfd: skipped, open files limited to " << limit.rlim_cur << "\n";
+        return EXIT_FAILURE;
+    }
+
+    benchmark<join::Monotonic::Timer> ("timerfd", count, rounds);
+
+    return EXIT_SUCCESS;
+}
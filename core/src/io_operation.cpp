@@ -29,6 +29,9 @@
 using join::IoOperation;
 using join::CompletionHandler;
 
+constexpr uint32_t IoOperation::allocSlot;
+constexpr uint64_t IoOperation::noOffset;
+
 // =========================================================================
 //   CLASS     : IoOperation
 //   METHOD    : makeAccept
@@ -43,6 +46,21 @@ IoOperation IoOperation::makeAccept (int fd, sockaddr* addr, socklen_t* addrlen,
     op.data.accept.addr = addr;
     op.data.accept.addrlen = addrlen;
     op.data.accept.flags = flags;
+    op.data.accept.direct = false;
+    op.data.accept.slot = 0;
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeAcceptDirect
+// =========================================================================
+IoOperation IoOperation::makeAcceptDirect (int fd, sockaddr* addr, socklen_t* addrlen, int flags, uint32_t slot,
+                                           CompletionHandler* handler) noexcept
+{
+    IoOperation op = makeAccept (fd, addr, addrlen, flags, handler);
+    op.data.accept.direct = true;
+    op.data.accept.slot = slot;
     return op;
 }
 
@@ -77,6 +95,7 @@ IoOperation IoOperation::makeRead (int fd, void* buf, uint32_t len, CompletionHa
     op.data.rw.len = len;
     op.data.rw.index = 0;
     op.data.rw.fixed = false;
+    op.data.rw.offset = noOffset;
     return op;
 }
 
@@ -96,6 +115,31 @@ IoOperation IoOperation::makeWrite (int fd, const void* buf, uint32_t len, Compl
     op.data.rw.len = len;
     op.data.rw.index = 0;
     op.data.rw.fixed = false;
+    op.data.rw.offset = noOffset;
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeReadAt
+// =========================================================================
+IoOperation IoOperation::makeReadAt (int fd, void* buf, uint32_t len, uint64_t offset, CompletionHandler* handler,
+                                     bool linked) noexcept
+{
+    IoOperation op = makeRead (fd, buf, len, handler, linked);
+    op.data.rw.offset = offset;
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeWriteAt
+// =========================================================================
+IoOperation IoOperation::makeWriteAt (int fd, const void* buf, uint32_t len, uint64_t offset,
+                                      CompletionHandler* handler, bool linked) noexcept
+{
+    IoOperation op = makeWrite (fd, buf, len, handler, linked);
+    op.data.rw.offset = offset;
     return op;
 }
 
@@ -115,6 +159,7 @@ IoOperation IoOperation::makeReadFixed (int fd, void* buf, uint32_t len, uint16_
     op.data.rw.len = len;
     op.data.rw.index = index;
     op.data.rw.fixed = true;
+    op.data.rw.offset = noOffset;
     return op;
 }
 
@@ -134,6 +179,7 @@ IoOperation IoOperation::makeWriteFixed (int fd, const void* buf, uint32_t len,
     op.data.rw.len = len;
     op.data.rw.index = index;
     op.data.rw.fixed = true;
+    op.data.rw.offset = noOffset;
     return op;
 }
 
@@ -206,6 +252,153 @@ IoOperation IoOperation::makeSend (int fd, const void* buf, uint32_t len, int fl
     return op;
 }
 
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeSendZc
+// =========================================================================
+IoOperation IoOperation::makeSendZc (int fd, const void* buf, uint32_t len, int flags, CompletionHandler* handler,
+                                     bool linked) noexcept
+{
+    IoOperation op = makeSend (fd, buf, len, flags, handler, linked);
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::SendZc);
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeAcceptMultishot
+// =========================================================================
+IoOperation IoOperation::makeAcceptMultishot (int fd, sockaddr* addr, socklen_t* addrlen, int flags,
+                                              CompletionHandler* handler) noexcept
+{
+    IoOperation op = makeAccept (fd, addr, addrlen, flags, handler);
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::AcceptMultishot);
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeRecvMultishot
+// =========================================================================
+IoOperation IoOperation::makeRecvMultishot (int fd, uint16_t group, int flags, CompletionHandler* handler) noexcept
+{
+    IoOperation op;
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::RecvMultishot);
+    op.handler = handler;
+    op.data.select.fd = fd;
+    op.data.select.group = group;
+    op.data.select.flags = flags;
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeReadv
+// =========================================================================
+IoOperation IoOperation::makeReadv (int fd, const iovec* iov, int iovcnt, CompletionHandler* handler,
+                                    bool linked) noexcept
+{
+    IoOperation op;
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::Readv);
+    op.handler = handler;
+    op.linked = linked;
+    op.data.vec.fd = fd;
+    op.data.vec.iov = const_cast<iovec*> (iov);
+    op.data.vec.iovcnt = iovcnt;
+    op.data.vec.offset = noOffset;
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeWritev
+// =========================================================================
+IoOperation IoOperation::makeWritev (int fd, const iovec* iov, int iovcnt, CompletionHandler* handler,
+                                     bool linked) noexcept
+{
+    IoOperation op = makeReadv (fd, iov, iovcnt, handler, linked);
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::Writev);
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeTimeout
+// =========================================================================
+IoOperation IoOperation::makeTimeout (std::chrono::nanoseconds timeout, CompletionHandler* handler,
+                                      bool linked) noexcept
+{
+    IoOperation op;
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::Timeout);
+    op.handler = handler;
+    op.linked = linked;
+    op.data.timeout.ts.tv_sec = timeout.count () / 1000000000;
+    op.data.timeout.ts.tv_nsec = timeout.count () % 1000000000;
+    op.data.timeout.deadline = 0;
+    op.data.timeout.target = nullptr;
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : makeLinkTimeout
+// =========================================================================
+IoOperation IoOperation::makeLinkTimeout (std::chrono::nanoseconds timeout, CompletionHandler* handler) noexcept
+{
+    IoOperation op = makeTimeout (timeout, handler);
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::LinkTimeout);
+    return op;
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : multishot
+// =========================================================================
+bool IoOperation::multishot () const noexcept
+{
+    return (code == static_cast<uint8_t> (Opcode::AcceptMultishot)) ||
+           (code == static_cast<uint8_t> (Opcode::RecvMultishot));
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : zeroCopy
+// =========================================================================
+bool IoOperation::zeroCopy () const noexcept
+{
+    return code == static_cast<uint8_t> (Opcode::SendZc);
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : timeout
+// =========================================================================
+bool IoOperation::timeout () const noexcept
+{
+    return (code == static_cast<uint8_t> (Opcode::Timeout)) || (code == static_cast<uint8_t> (Opcode::LinkTimeout));
+}
+
+// =========================================================================
+//   CLASS     : IoOperation
+//   METHOD    : positional
+// =========================================================================
+bool IoOperation::positional () const noexcept
+{
+    switch (static_cast<Opcode> (code))
+    {
+        case Opcode::Read:
+        case Opcode::ReadFixed:
+        case Opcode::Write:
+        case Opcode::WriteFixed:
+            return data.rw.offset != noOffset;
+        case Opcode::Readv:
+        case Opcode::Writev:
+            return data.vec.offset != noOffset;
+        default:
+            return false;
+    }
+}
+
 // =========================================================================
 //   CLASS     : IoOperation
 //   METHOD    : fd
@@ -215,6 +408,7 @@ int IoOperation::fd () const noexcept
     switch (static_cast<Opcode> (code))
     {
         case Opcode::Accept:
+        case Opcode::AcceptMultishot:
             return data.accept.fd;
         case Opcode::Connect:
             return data.connect.fd;
@@ -228,7 +422,13 @@ int IoOperation::fd () const noexcept
             return data.msg.fd;
         case Opcode::Recv:
         case Opcode::Send:
+        case Opcode::SendZc:
             return data.stream.fd;
+        case Opcode::RecvMultishot:
+            return data.select.fd;
+        case Opcode::Readv:
+        case Opcode::Writev:
+            return data.vec.fd;
         default:
             return -1;
     }
@@ -27,25 +27,34 @@
 #include <join/backoff.hpp>
 
 // C++.
+#include <algorithm>
 #include <array>
 
 // C.
 #include <sys/eventfd.h>
+#include <sys/socket.h>
 #include <unistd.h>
 #include <cassert>
 
 using join::Backoff;
 using join::EventHandler;
 using join::Reactor;
+using join::ReactorGroup;
 using join::ReactorThread;
+#ifdef JOIN_HAS_REACTOR_STATS
+using join::Monotonic;
+using join::Counter;
+using join::ReactorStats;
+#endif
 
 // =========================================================================
 //   CLASS     : Reactor
 //   METHOD    : Reactor
 // =========================================================================
-Reactor::Reactor ()
+Reactor::Reactor (uint32_t spin)
 : _wakeup (eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC))
 , _epoll (epoll_create1 (EPOLL_CLOEXEC))
+, _spin (spin)
 , _commands (_queueSize)
 {
     if (_wakeup == -1)
@@ -64,11 +73,11 @@ Reactor::Reactor ()
         // LCOV_EXCL_STOP
     }
 
-    _deleted.reserve (_deletedReserve);
+    _handlers.reserve (_handlersReserve);
 
     struct epoll_event ev = {};
     ev.events = EPOLLIN;
-    ev.data.fd = _wakeup;
+    ev.data.u64 = uint64_t (_wakeup);
 
     if (epoll_ctl (_epoll, EPOLL_CTL_ADD, _wakeup, &ev) == -1)
     {
@@ -97,13 +106,15 @@ Reactor::~Reactor () noexcept
 //   CLASS     : Reactor
 //   METHOD    : addHandler
 // =========================================================================
-int Reactor::addHandler (int fd, EventHandler* handler, bool wantRead, bool wantWrite, bool sync) noexcept
+int Reactor::addHandler (int fd, EventHandler* handler, bool wantRead, bool wantWrite, bool sync,
+                         uint32_t flags) noexcept
 {
     uint32_t events = 0;
 
     if (wantRead)
     {
-        events |= EPOLLIN | EPOLLRDHUP;
+        // EPOLLRDHUP can't be combined with EPOLLEXCLUSIVE, a hang up is still reported by EPOLLHUP.
+        events |= (flags & Exclusive) ? EPOLLIN : EPOLLIN | EPOLLRDHUP;
     }
 
     if (wantWrite)
@@ -111,11 +122,27 @@ int Reactor::addHandler (int fd, EventHandler* handler, bool wantRead, bool want
         events |= EPOLLOUT;
     }
 
+    if (events != 0)
+    {
+        events |= flags & (EdgeTriggered | Exclusive);
+    }
+
     if (isReactorThread ())
     {
         return registerHandler (fd, handler, events);
     }
 
+    if (_loop.tryLock ())
+    {
+        // no event loop runs, the commands still queued go first.
+        flushCommands ();
+        int result = registerHandler (fd, handler, events);
+        std::error_code errc = lastError;
+        unlockLoop ();
+        lastError = errc;
+        return result;
+    }
+
     std::atomic<bool> done{false}, *pdone = nullptr;
     std::error_code errc, *perrc = nullptr;
 
@@ -130,19 +157,19 @@ int Reactor::addHandler (int fd, EventHandler* handler, bool wantRead, bool want
         return -1;  // LCOV_EXCL_LINE
     }
 
-    if (JOIN_LIKELY (sync))
+    if (JOIN_UNLIKELY (!sync))
     {
-        Backoff backoff;
-        while (!done.load (std::memory_order_acquire))
-        {
-            backoff ();
-        }
+        // the event loop may have exited before reading the command.
+        drainCommands ();
+        return 0;
+    }
 
-        if (JOIN_UNLIKELY (errc))
-        {
-            lastError = errc;
-            return -1;
-        }
+    waitCommand (done);
+
+    if (JOIN_UNLIKELY (errc))
+    {
+        lastError = errc;
+        return -1;
     }
 
     return 0;
@@ -159,6 +186,17 @@ int Reactor::delHandler (int fd, bool sync) noexcept
         return unregisterHandler (fd);
     }
 
+    if (_loop.tryLock ())
+    {
+        // no event loop runs, the commands still queued go first.
+        flushCommands ();
+        int result = unregisterHandler (fd);
+        std::error_code errc = lastError;
+        unlockLoop ();
+        lastError = errc;
+        return result;
+    }
+
     std::atomic<bool> done{false}, *pdone = nullptr;
     std::error_code errc, *perrc = nullptr;
 
@@ -173,19 +211,19 @@ int Reactor::delHandler (int fd, bool sync) noexcept
         return -1;  // LCOV_EXCL_LINE
     }
 
-    if (JOIN_LIKELY (sync))
+    if (JOIN_UNLIKELY (!sync))
     {
-        Backoff backoff;
-        while (!done.load (std::memory_order_acquire))
-        {
-            backoff ();
-        }
+        // the event loop may have exited before reading the command.
+        drainCommands ();
+        return 0;
+    }
 
-        if (JOIN_UNLIKELY (errc))
-        {
-            lastError = errc;
-            return -1;
-        }
+    waitCommand (done);
+
+    if (JOIN_UNLIKELY (errc))
+    {
+        lastError = errc;
+        return -1;
     }
 
     return 0;
@@ -197,12 +235,28 @@ int Reactor::delHandler (int fd, bool sync) noexcept
 // =========================================================================
 void Reactor::run ()
 {
+    _loop.lock ();
+
+    // commands queued while no event loop ran, a stop requested before this run ends it right away.
+    flushCommands ();
+    if (JOIN_UNLIKELY (_stopped))
+    {
+        _stopped = false;
+        unlockLoop ();
+        return;
+    }
+
     _threadId.store (pthread_self (), std::memory_order_release);
 
     _running.store (true, std::memory_order_release);
     eventLoop ();
 
+    // nothing reads the queue once the loop exits, the commands still there are processed now.
+    flushCommands ();
+
     _threadId.store (_invalidThreadId, std::memory_order_release);
+
+    unlockLoop ();
 }
 
 // =========================================================================
@@ -229,6 +283,24 @@ void Reactor::stop (bool sync) noexcept
     }
 }
 
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : spin
+// =========================================================================
+void Reactor::spin (uint32_t spin) noexcept
+{
+    _spin.store (spin, std::memory_order_relaxed);
+}
+
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : spin
+// =========================================================================
+uint32_t Reactor::spin () const noexcept
+{
+    return _spin.load (std::memory_order_relaxed);
+}
+
 #ifdef JOIN_HAS_NUMA
 // =========================================================================
 //   CLASS     : Reactor
@@ -267,6 +339,17 @@ bool Reactor::isReactorThread () const noexcept
     return _threadId.load (std::memory_order_acquire) == pthread_self ();
 }
 
+#ifdef JOIN_HAS_REACTOR_STATS
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : stats
+// =========================================================================
+ReactorStats& Reactor::stats () noexcept
+{
+    return _stats;
+}
+#endif
+
 // =========================================================================
 //   CLASS     : Reactor
 //   METHOD    : registerHandler
@@ -291,9 +374,18 @@ int Reactor::registerHandler (int fd, EventHandler* handler, uint32_t events) no
         return -1;
     }
 
+    if (size_t (fd) >= _handlers.size ())
+    {
+        _handlers.resize (std::max (size_t (fd) + 1, _handlers.size () * 2));
+    }
+
+    // a new registration gets a new generation, updating one keeps it.
+    Slot& slot = _handlers[fd];
+    const uint32_t generation = (slot.handler == nullptr) ? slot.generation + 1 : slot.generation;
+
     struct epoll_event ev = {};
     ev.events = events;
-    ev.data.fd = fd;
+    ev.data.u64 = (uint64_t (generation) << 32) | uint32_t (fd);
 
     if (JOIN_UNLIKELY (epoll_ctl (_epoll, EPOLL_CTL_ADD, fd, &ev) == -1))
     {
@@ -316,8 +408,8 @@ int Reactor::registerHandler (int fd, EventHandler* handler, uint32_t events) no
         }
     }
 
-    _deleted.erase (fd);
-    _handlers[fd] = handler;
+    slot.handler = handler;
+    slot.generation = generation;
 
     return 0;
 }
@@ -338,13 +430,13 @@ int Reactor::unregisterHandler (int fd) noexcept
     {
         if (errno == EBADF || errno == ENOENT)
         {
-            _deleted.insert (fd);
+            release (fd);
         }
         lastError = std::make_error_code (static_cast<std::errc> (errno));
         return -1;
     }
 
-    _deleted.insert (fd);
+    release (fd);
 
     return 0;
 }
@@ -377,6 +469,82 @@ int Reactor::writeCommand (const Command& cmd) noexcept
     return 0;
 }
 
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : waitCommand
+// =========================================================================
+void Reactor::waitCommand (const std::atomic<bool>& done) noexcept
+{
+    Backoff backoff;
+    while (!done.load (std::memory_order_acquire))
+    {
+        if (!drainCommands ())
+        {
+            backoff ();
+        }
+    }
+}
+
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : drainCommands
+// =========================================================================
+bool Reactor::drainCommands () noexcept
+{
+    if (!_loop.tryLock ())
+    {
+        return false;
+    }
+
+    flushCommands ();
+    unlockLoop ();
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : flushCommands
+// =========================================================================
+void Reactor::flushCommands () noexcept
+{
+    std::error_code errc = lastError;
+
+    Command cmd;
+    while (_commands.tryPop (cmd) == 0)
+    {
+        if (cmd.type == CommandType::Stop)
+        {
+            // kept for the next run, as the command would have been.
+            _stopped = true;
+            continue;
+        }
+        processCommand (cmd);
+    }
+
+    lastError = errc;
+}
+
+// =========================================================================
+//   CLASS     : Reactor
+//   METHOD    : unlockLoop
+// =========================================================================
+void Reactor::unlockLoop () noexcept
+{
+    // a command queued while the mutex was held and no event loop ran would otherwise wait for the next run.
+    for (;;)
+    {
+        _loop.unlock ();
+
+        if (_commands.empty () || !_loop.tryLock ())
+        {
+            break;
+        }
+
+        flushCommands ();
+    }
+}
+
 // =========================================================================
 //   CLASS     : Reactor
 //   METHOD    : processCommand
@@ -426,10 +594,21 @@ void Reactor::readCommands () noexcept
     }
 
     Command cmd;
+#ifdef JOIN_HAS_REACTOR_STATS
+    int64_t pending = 0;
     while (_commands.tryPop (cmd) == 0)
     {
+        _stats.latency.stop (cmd.enqueued);
         processCommand (cmd);
+        ++pending;
     }
+    _stats.commands.record (Counter::Duration (pending));
+#else
+    while (_commands.tryPop (cmd) == 0)
+    {
+        processCommand (cmd);
+    }
+#endif
 }
 
 // =========================================================================
@@ -438,34 +617,47 @@ void Reactor::readCommands () noexcept
 // =========================================================================
 void Reactor::dispatchEvent (const epoll_event& event)
 {
-    int fd = event.data.fd;
+    const int fd = int (uint32_t (event.data.u64));
+    const uint32_t generation = uint32_t (event.data.u64 >> 32);
     assert (fd != _wakeup);
+    assert (size_t (fd) < _handlers.size ());
 
-    auto it = _handlers.find (fd);
-    if (JOIN_UNLIKELY (it == _handlers.end ()))
+    // the handler was deleted, or replaced, by a previous event of the same batch.
+    const Slot& slot = _handlers[fd];
+    if (JOIN_UNLIKELY ((slot.handler == nullptr) || (slot.generation != generation)))
     {
         return;
     }
 
-    if (JOIN_LIKELY (isActive (fd)))
+#ifdef JOIN_HAS_REACTOR_STATS
+    const auto beg = Monotonic::now ();
+#endif
+
+    if (JOIN_UNLIKELY (event.events & EPOLLERR))
     {
-        if (JOIN_UNLIKELY (event.events & EPOLLERR))
-        {
-            it->second->onError (fd);
-        }
-        else if (JOIN_UNLIKELY (event.events & (EPOLLRDHUP | EPOLLHUP)))
-        {
-            it->second->onClose (fd);
-        }
-        else if (JOIN_LIKELY (event.events & EPOLLIN))
-        {
-            it->second->onReadable (fd);
-        }
-        else if (event.events & EPOLLOUT)
-        {
-            it->second->onWriteable (fd);
-        }
+        slot.handler->onError (fd);
     }
+    else if (JOIN_UNLIKELY (event.events & (EPOLLRDHUP | EPOLLHUP)))
+    {
+        slot.handler->onClose (fd);
+    }
+    else if (JOIN_LIKELY (event.events & EPOLLIN))
+    {
+        slot.handler->onReadable (fd);
+    }
+    else if (event.events & EPOLLOUT)
+    {
+        slot.handler->onWriteable (fd);
+    }
+
+#ifdef JOIN_HAS_REACTOR_STATS
+    const auto elapsed = std::chrono::duration_cast<Monotonic::Duration> (Monotonic::now () - beg);
+    if (elapsed > _stats.dispatch.max ())
+    {
+        _stats.slowest.store (fd, std::memory_order_relaxed);
+    }
+    _stats.dispatch.record (elapsed);
+#endif
 }
 
 // =========================================================================
@@ -475,18 +667,36 @@ void Reactor::dispatchEvent (const epoll_event& event)
 void Reactor::eventLoop ()
 {
     std::array<epoll_event, _maxEvents> events;
+    Backoff backoff;
+    uint32_t idle = 0;
 
     while (_running.load (std::memory_order_acquire))
     {
-        int eventCount = epoll_wait (_epoll, events.data (), events.size (), -1);
+        // poll without blocking until the spin budget is exhausted, then park.
+        const uint32_t spin = _spin.load (std::memory_order_relaxed);
+        int eventCount = epoll_wait (_epoll, events.data (), events.size (), (idle < spin) ? 0 : -1);
         if (JOIN_UNLIKELY ((eventCount < 0) && (errno == EINTR)))
         {
             continue;
         }
 
+        if (eventCount == 0)
+        {
+            ++idle;
+            backoff ();
+            continue;
+        }
+
+        idle = 0;
+        backoff.reset ();
+
+#ifdef JOIN_HAS_REACTOR_STATS
+        _stats.events.record (Counter::Duration (eventCount));
+#endif
+
         for (int i = 0; i < eventCount; ++i)
         {
-            if (JOIN_UNLIKELY (events[i].data.fd == _wakeup))
+            if (JOIN_UNLIKELY (events[i].data.u64 == uint64_t (_wakeup)))
             {
                 readCommands ();
             }
@@ -494,28 +704,24 @@ void Reactor::eventLoop ()
 
         for (int i = 0; i < eventCount; ++i)
         {
-            if (JOIN_LIKELY (events[i].data.fd != _wakeup))
+            if (JOIN_LIKELY (events[i].data.u64 != uint64_t (_wakeup)))
             {
                 dispatchEvent (events[i]);
             }
         }
-
-        for (int fd : _deleted)
-        {
-            _handlers.erase (fd);
-        }
-
-        _deleted.clear ();
     }
 }
 
 // =========================================================================
 //   CLASS     : Reactor
-//   METHOD    : isActive
+//   METHOD    : release
 // =========================================================================
-bool Reactor::isActive (int fd) const noexcept
+void Reactor::release (int fd) noexcept
 {
-    return _deleted.count (fd) == 0;
+    if (size_t (fd) < _handlers.size ())
+    {
+        _handlers[fd].handler = nullptr;
+    }
 }
 
 // =========================================================================
@@ -592,6 +798,17 @@ int ReactorThread::mlock ()
     return instance ()._reactor.mlock ();
 }
 
+#ifdef JOIN_HAS_REACTOR_STATS
+// =========================================================================
+//   CLASS     : ReactorThread
+//   METHOD    : stats
+// =========================================================================
+ReactorStats& ReactorThread::stats ()
+{
+    return instance ()._reactor.stats ();
+}
+#endif
+
 // =========================================================================
 //   CLASS     : ReactorThread
 //   METHOD    : instance
@@ -622,3 +839,325 @@ ReactorThread::~ReactorThread ()
     _reactor.stop ();
     _dispatcher.join ();
 }
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : ReactorGroup
+// =========================================================================
+ReactorGroup::ReactorGroup (int reactors, Placement placement, uint32_t spin)
+: _placement (placement)
+{
+    if (reactors <= 0)
+    {
+        throw std::invalid_argument ("invalid number of reactors");
+    }
+
+    const auto& cores = CpuTopology::instance ()->cores ();
+
+    for (int i = 0; i < reactors; ++i)
+    {
+        if (cores.empty ())
+        {
+            _shards.emplace_back (-1, -1, spin);  // LCOV_EXCL_LINE
+        }
+        else
+        {
+            const auto& core = cores[i % cores.size ()];
+            _shards.emplace_back (core.primaryThread (), core.numa, spin);
+        }
+    }
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : ~ReactorGroup
+// =========================================================================
+ReactorGroup::~ReactorGroup ()
+{
+    _shards.clear ();
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : addHandler
+// =========================================================================
+int ReactorGroup::addHandler (int fd, EventHandler* handler, bool wantRead, bool wantWrite, bool sync,
+                              uint32_t flags) noexcept
+{
+    int index = indexOf (fd);
+    if (index == -1)
+    {
+        index = int (choose (fd));
+    }
+
+    return addHandler (size_t (index), fd, handler, wantRead, wantWrite, sync, flags);
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : addHandler
+// =========================================================================
+int ReactorGroup::addHandler (size_t index, int fd, EventHandler* handler, bool wantRead, bool wantWrite,
+                              bool sync, uint32_t flags) noexcept
+{
+    if (JOIN_UNLIKELY (index >= _shards.size ()))
+    {
+        lastError = make_error_code (Errc::InvalidParam);
+        return -1;
+    }
+
+    bool added = false;
+
+    {
+        ScopedLock<Mutex> lock (_mutex);
+
+        Owner& owner = _owners[fd];
+        if (owner.indexes.empty ())
+        {
+            owner.exclusive = (flags & Reactor::Exclusive) != 0;
+        }
+
+        if (std::find (owner.indexes.begin (), owner.indexes.end (), index) == owner.indexes.end ())
+        {
+            // an fd can only be watched by several reactors of the group if all of them are woken exclusively.
+            if (JOIN_UNLIKELY (!owner.indexes.empty () && (!owner.exclusive || !(flags & Reactor::Exclusive))))
+            {
+                lastError = make_error_code (Errc::InUse);
+                return -1;
+            }
+
+            owner.indexes.push_back (index);
+            _shards[index].handlers.fetch_add (1, std::memory_order_relaxed);
+            added = true;
+        }
+    }
+
+    // don't hold the lock while waiting for the reactor, its handlers may use the group.
+    if (JOIN_UNLIKELY (_shards[index].reactor.addHandler (fd, handler, wantRead, wantWrite, sync, flags) == -1))
+    {
+        if (added)
+        {
+            ScopedLock<Mutex> lock (_mutex);
+            auto it = _owners.find (fd);
+            it->second.indexes.erase (std::find (it->second.indexes.begin (), it->second.indexes.end (), index));
+            if (it->second.indexes.empty ())
+            {
+                _owners.erase (it);
+            }
+            _shards[index].handlers.fetch_sub (1, std::memory_order_relaxed);
+        }
+        return -1;
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : delHandler
+// =========================================================================
+int ReactorGroup::delHandler (int fd, bool sync) noexcept
+{
+    std::vector<size_t> indexes;
+
+    {
+        ScopedLock<Mutex> lock (_mutex);
+
+        auto it = _owners.find (fd);
+        if (JOIN_UNLIKELY (it == _owners.end ()))
+        {
+            lastError = make_error_code (Errc::NotFound);
+            return -1;
+        }
+
+        indexes = std::move (it->second.indexes);
+        _owners.erase (it);
+
+        for (size_t index : indexes)
+        {
+            _shards[index].handlers.fetch_sub (1, std::memory_order_relaxed);
+        }
+    }
+
+    int result = 0;
+
+    for (size_t index : indexes)
+    {
+        if (_shards[index].reactor.delHandler (fd, sync) == -1)
+        {
+            result = -1;
+        }
+    }
+
+    return result;
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : size
+// =========================================================================
+size_t ReactorGroup::size () const noexcept
+{
+    return _shards.size ();
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : reactor
+// =========================================================================
+Reactor& ReactorGroup::reactor (size_t index)
+{
+    return _shards.at (index).reactor;
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : indexOf
+// =========================================================================
+int ReactorGroup::indexOf (int fd) const
+{
+    ScopedLock<Mutex> lock (_mutex);
+
+    auto it = _owners.find (fd);
+    if (it == _owners.end ())
+    {
+        return -1;
+    }
+
+    return int (it->second.indexes.front ());
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : load
+// =========================================================================
+size_t ReactorGroup::load (size_t index) const
+{
+    return _shards.at (index).handlers.load (std::memory_order_relaxed);
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : affinity
+// =========================================================================
+int ReactorGroup::affinity (size_t index) const
+{
+    return _shards.at (index).core;
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : placement
+// =========================================================================
+void ReactorGroup::placement (Placement placement) noexcept
+{
+    _placement.store (placement, std::memory_order_relaxed);
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : placement
+// =========================================================================
+ReactorGroup::Placement ReactorGroup::placement () const noexcept
+{
+    return _placement.load (std::memory_order_relaxed);
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : mlock
+// =========================================================================
+int ReactorGroup::mlock ()
+{
+    for (auto& shard : _shards)
+    {
+        if (shard.reactor.mlock () == -1)
+        {
+            return -1;  // LCOV_EXCL_LINE
+        }
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : ReactorGroup
+//   METHOD    : choose
+// =========================================================================
+size_t ReactorGroup::choose (int fd) noexcept
+{
+    switch (_placement.load (std::memory_order_relaxed))
+    {
+        case Placement::IncomingCpu:
+        {
+            int cpu = -1;
+            socklen_t len = sizeof (cpu);
+
+            if ((::getsockopt (fd, SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len) == 0) && (cpu >= 0))
+            {
+                for (size_t i = 0; i < _shards.size (); ++i)
+                {
+                    if (_shards[i].core == cpu)
+                    {
+                        return i;
+                    }
+                }
+
+                return size_t (cpu) % _shards.size ();
+            }
+
+            // not a socket or no traffic yet.
+            [[fallthrough]];
+        }
+
+        case Placement::LeastLoaded:
+        {
+            size_t best = 0;
+
+            for (size_t i = 1; i < _shards.size (); ++i)
+            {
+                if (_shards[i].handlers.load (std::memory_order_relaxed) <
+                    _shards[best].handlers.load (std::memory_order_relaxed))
+                {
+                    best = i;
+                }
+            }
+
+            return best;
+        }
+
+        default:
+            return _next.fetch_add (1, std::memory_order_relaxed) % _shards.size ();
+    }
+}
+
+// =========================================================================
+//   CLASS     : Shard
+//   METHOD    : Shard
+// =========================================================================
+ReactorGroup::Shard::Shard (int core, int numa, uint32_t spin)
+: reactor (spin)
+, thread (core, 0, [this] () {
+    reactor.run ();
+})
+, core (core)
+{
+#ifdef JOIN_HAS_NUMA
+    if (numa >= 0)
+    {
+        reactor.mbind (numa);
+    }
+#else
+    static_cast<void> (numa);
+#endif
+}
+
+// =========================================================================
+//   CLASS     : Shard
+//   METHOD    : ~Shard
+// =========================================================================
+ReactorGroup::Shard::~Shard ()
+{
+    reactor.stop ();
+    thread.join ();
+}
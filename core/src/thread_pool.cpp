@@ -21,20 +21,290 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 // libjoin.
 #include <join/thread_pool.hpp>
+#include <join/backoff.hpp>
+#include <join/utils.hpp>
+
+// C.
+#include <pthread.h>
+#include <sched.h>
 
+using join::details::TaskDeque;
+using join::details::TaskQueue;
+using join::details::Task;
 using join::WorkerThread;
 using join::ThreadPool;
 
+thread_local WorkerThread* WorkerThread::_self = nullptr;
+
+// =========================================================================
+//   CLASS     : TaskDeque
+//   METHOD    : TaskDeque
+// =========================================================================
+TaskDeque::TaskDeque (size_t capacity, int numa)
+: _storage (capacity * sizeof (Slot))
+, _slots (static_cast<Slot*> (_storage.get ()))
+, _mask (capacity - 1)
+{
+#ifdef JOIN_HAS_NUMA
+    if (numa >= 0)
+    {
+        _storage.mbind (numa);
+    }
+#else
+    static_cast<void> (numa);
+#endif
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        new (&_slots[i]) Slot;
+    }
+}
+
+// =========================================================================
+//   CLASS     : TaskDeque
+//   METHOD    : ~TaskDeque
+// =========================================================================
+TaskDeque::~TaskDeque () noexcept
+{
+    for (size_t i = 0; i <= _mask; ++i)
+    {
+        _slots[i].~Slot ();
+    }
+}
+
+// =========================================================================
+//   CLASS     : TaskDeque
+//   METHOD    : push
+// =========================================================================
+bool TaskDeque::push (Task& task) noexcept
+{
+    int64_t bottom = _bottom.load (std::memory_order_relaxed);
+    int64_t top = _top.load (std::memory_order_acquire);
+
+    if (static_cast<size_t> (bottom - top) > _mask)
+    {
+        return false;
+    }
+
+    Slot& slot = _slots[bottom & _mask];
+
+    // a thief may still be moving the previous task out of the slot.
+    if (slot.full.load (std::memory_order_acquire))
+    {
+        return false;  // LCOV_EXCL_LINE
+    }
+
+    slot.task = std::move (task);
+    slot.full.store (true, std::memory_order_relaxed);
+    _bottom.store (bottom + 1, std::memory_order_release);
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : TaskDeque
+//   METHOD    : pop
+// =========================================================================
+bool TaskDeque::pop (Task& task) noexcept
+{
+    int64_t bottom = _bottom.load (std::memory_order_relaxed) - 1;
+    _bottom.store (bottom, std::memory_order_release);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    int64_t top = _top.load (std::memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        _bottom.store (bottom + 1, std::memory_order_release);
+        return false;
+    }
+
+    if (top == bottom)
+    {
+        // last task, race with the thieves.
+        bool won = _top.compare_exchange_strong (top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        _bottom.store (bottom + 1, std::memory_order_release);
+
+        if (!won)
+        {
+            return false;  // LCOV_EXCL_LINE
+        }
+    }
+
+    Slot& slot = _slots[bottom & _mask];
+    task = std::move (slot.task);
+    slot.full.store (false, std::memory_order_release);
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : TaskDeque
+//   METHOD    : steal
+// =========================================================================
+bool TaskDeque::steal (Task& task) noexcept
+{
+    int64_t top = _top.load (std::memory_order_acquire);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+    int64_t bottom = _bottom.load (std::memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;
+    }
+
+    if (!_top.compare_exchange_strong (top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+    {
+        return false;  // LCOV_EXCL_LINE
+    }
+
+    Slot& slot = _slots[top & _mask];
+    task = std::move (slot.task);
+    slot.full.store (false, std::memory_order_release);
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : TaskDeque
+//   METHOD    : empty
+// =========================================================================
+bool TaskDeque::empty () const noexcept
+{
+    return _top.load (std::memory_order_acquire) >= _bottom.load (std::memory_order_acquire);
+}
+
+// =========================================================================
+//   CLASS     : TaskQueue
+//   METHOD    : TaskQueue
+// =========================================================================
+TaskQueue::TaskQueue (size_t capacity, int numa)
+: _storage (capacity * sizeof (Cell))
+, _cells (static_cast<Cell*> (_storage.get ()))
+, _mask (capacity - 1)
+{
+#ifdef JOIN_HAS_NUMA
+    if (numa >= 0)
+    {
+        _storage.mbind (numa);
+    }
+#else
+    static_cast<void> (numa);
+#endif
+
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        new (&_cells[i]) Cell;
+        _cells[i].seq.store (i, std::memory_order_relaxed);
+    }
+}
+
+// =========================================================================
+//   CLASS     : TaskQueue
+//   METHOD    : ~TaskQueue
+// =========================================================================
+TaskQueue::~TaskQueue () noexcept
+{
+    for (size_t i = 0; i <= _mask; ++i)
+    {
+        _cells[i].~Cell ();
+    }
+}
+
+// =========================================================================
+//   CLASS     : TaskQueue
+//   METHOD    : push
+// =========================================================================
+bool TaskQueue::push (Task& task) noexcept
+{
+    size_t pos = _tail.load (std::memory_order_relaxed);
+    Cell* cell;
+
+    for (;;)
+    {
+        cell = &_cells[pos & _mask];
+        intptr_t diff = intptr_t (cell->seq.load (std::memory_order_acquire)) - intptr_t (pos);
+
+        if (diff == 0)
+        {
+            if (_tail.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = _tail.load (std::memory_order_relaxed);
+        }
+    }
+
+    cell->task = std::move (task);
+    cell->seq.store (pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : TaskQueue
+//   METHOD    : pop
+// =========================================================================
+bool TaskQueue::pop (Task& task) noexcept
+{
+    size_t pos = _head.load (std::memory_order_relaxed);
+    Cell* cell;
+
+    for (;;)
+    {
+        cell = &_cells[pos & _mask];
+        intptr_t diff = intptr_t (cell->seq.load (std::memory_order_acquire)) - intptr_t (pos + 1);
+
+        if (diff == 0)
+        {
+            if (_head.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            pos = _head.load (std::memory_order_relaxed);
+        }
+    }
+
+    task = std::move (cell->task);
+    cell->seq.store (pos + _mask + 1, std::memory_order_release);
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : TaskQueue
+//   METHOD    : empty
+// =========================================================================
+bool TaskQueue::empty () const noexcept
+{
+    return _head.load (std::memory_order_acquire) >= _tail.load (std::memory_order_acquire);
+}
+
 // =========================================================================
 //   CLASS     : WorkerThread
 //   METHOD    : WorkerThread
 // =========================================================================
-WorkerThread::WorkerThread (ThreadPool& pool)
+WorkerThread::WorkerThread (ThreadPool& pool, size_t index, size_t node, int core)
 : _pool (std::addressof (pool))
-, _thread ([this] {
+, _index (index)
+, _node (node)
+, _tasks (ThreadPool::_dequeSize, pool._nodes[node]->numa)
+, _thread (core, 0, [this] {
     work ();
 })
 {
@@ -55,22 +325,43 @@ WorkerThread::~WorkerThread () noexcept
 // =========================================================================
 void WorkerThread::work ()
 {
+    {
+        // wait for the other workers to be created.
+        ScopedLock<Mutex> lock (_pool->_mutex);
+    }
+
+    _self = this;
+
+    Backoff backoff;
+    size_t idle = 0;
+
     for (;;)
     {
-        std::function<void ()> func;
+        Task task;
+
+        if (_pool->take (_index, task))
         {
-            ScopedLock<Mutex> lock (_pool->_mutex);
-            _pool->_condition.wait (lock, [&] () {
-                return _pool->_stop.load (std::memory_order_relaxed) || !_pool->_jobs.empty ();
-            });
-            if (_pool->_stop.load (std::memory_order_relaxed) && _pool->_jobs.empty ())
-            {
-                return;
-            }
-            func = std::move (_pool->_jobs.front ());
-            _pool->_jobs.pop_front ();
+            task ();
+            backoff.reset ();
+            idle = 0;
+            continue;
+        }
+
+        if (_pool->_stop.load (std::memory_order_acquire))
+        {
+            return;
         }
-        func ();
+
+        // spin first, a task is often pushed right after the previous one completed.
+        if (++idle < ThreadPool::_idleRounds)
+        {
+            backoff ();
+            continue;
+        }
+
+        _pool->park ();
+        backoff.reset ();
+        idle = 0;
     }
 }
 
@@ -78,7 +369,7 @@ void WorkerThread::work ()
 //   CLASS     : ThreadPool
 //   METHOD    : ThreadPool
 // =========================================================================
-ThreadPool::ThreadPool (int workers)
+ThreadPool::ThreadPool (int workers, Placement placement)
 : _stop (false)
 {
     if (workers <= 0)
@@ -86,11 +377,89 @@ ThreadPool::ThreadPool (int workers)
         throw std::invalid_argument ("invalid number of workers");
     }
 
+    const auto& cores = CpuTopology::instance ()->cores ();
+
+    // node index and pinned core of each worker.
+    std::vector<std::pair<size_t, int>> slots;
+    slots.reserve (workers);
+
+    // the queues memory is populated by the constructing thread, move it to the node before creating them.
+    cpu_set_t affinity;
+    bool pinning = (placement == Numa) && !cores.empty () &&
+                   (pthread_getaffinity_np (pthread_self (), sizeof (affinity), &affinity) == 0);
+
+    if ((placement == Numa) && !cores.empty ())
+    {
+        for (int i = 0; i < workers; ++i)
+        {
+            const auto& core = cores[i % cores.size ()];
+
+            size_t node = 0;
+            while ((node < _nodes.size ()) && (_nodes[node]->numa != core.numa))
+            {
+                ++node;
+            }
+
+            if (node == _nodes.size ())
+            {
+                if (pinning)
+                {
+                    Thread::affinity (pthread_self (), core.primaryThread ());
+                }
+                _nodes.emplace_back (new Node (core.numa));
+            }
+
+            _nodes[node]->workers.push_back (i);
+            slots.emplace_back (node, core.primaryThread ());
+        }
+
+        for (const auto& core : cores)
+        {
+            for (const auto& thread : core.threads)
+            {
+                if (size_t (thread.id) >= _cpus.size ())
+                {
+                    _cpus.resize (thread.id + 1, 0);
+                }
+
+                for (size_t node = 0; node < _nodes.size (); ++node)
+                {
+                    if (_nodes[node]->numa == thread.numa)
+                    {
+                        _cpus[thread.id] = node;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        _nodes.emplace_back (new Node (-1));
+
+        for (int i = 0; i < workers; ++i)
+        {
+            slots.emplace_back (0, -1);
+            _nodes.front ()->workers.push_back (i);
+        }
+    }
+
     _workers.reserve (workers);
 
+    // the workers steal from each other, hold them back until all of them exist.
+    ScopedLock<Mutex> lock (_mutex);
+
     for (int i = 0; i < workers; ++i)
     {
-        _workers.emplace_back (new WorkerThread (*this));
+        if (pinning)
+        {
+            Thread::affinity (pthread_self (), slots[i].second);
+        }
+        _workers.emplace_back (new WorkerThread (*this, i, slots[i].first, slots[i].second));
+    }
+
+    if (pinning)
+    {
+        pthread_setaffinity_np (pthread_self (), sizeof (affinity), &affinity);
     }
 }
 
@@ -100,8 +469,19 @@ ThreadPool::ThreadPool (int workers)
 // =========================================================================
 ThreadPool::~ThreadPool () noexcept
 {
-    _stop.store (true, std::memory_order_relaxed);
-    _condition.broadcast ();
+    _stop.store (true, std::memory_order_release);
+
+    {
+        ScopedLock<Mutex> lock (_mutex);
+        _condition.broadcast ();
+    }
+
+    // a worker may steal from any other one until it exits.
+    for (auto& worker : _workers)
+    {
+        worker->_thread.join ();
+    }
+
     _workers.clear ();
 }
 
@@ -113,3 +493,234 @@ size_t ThreadPool::size () const noexcept
 {
     return _workers.size ();
 }
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : nodes
+// =========================================================================
+std::vector<int> ThreadPool::nodes () const
+{
+    std::vector<int> ids;
+
+    for (const auto& node : _nodes)
+    {
+        ids.push_back (node->numa);
+    }
+
+    return ids;
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : instance
+// =========================================================================
+ThreadPool& ThreadPool::instance ()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : local
+// =========================================================================
+size_t ThreadPool::local () const noexcept
+{
+    WorkerThread* self = WorkerThread::_self;
+
+    if ((self != nullptr) && (self->_pool == this))
+    {
+        return self->_node;
+    }
+
+    if (_nodes.size () > 1)
+    {
+        int cpu = ::sched_getcpu ();
+        if ((cpu >= 0) && (size_t (cpu) < _cpus.size ()))
+        {
+            return _cpus[cpu];
+        }
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : find
+// =========================================================================
+size_t ThreadPool::find (int numa) const noexcept
+{
+    if (numa >= 0)
+    {
+        for (size_t i = 0; i < _nodes.size (); ++i)
+        {
+            if (_nodes[i]->numa == numa)
+            {
+                return i;
+            }
+        }
+    }
+
+    return local ();
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : submit
+// =========================================================================
+void ThreadPool::submit (size_t node, Task&& task)
+{
+    WorkerThread* self = WorkerThread::_self;
+
+    if ((self != nullptr) && (self->_pool == this))
+    {
+        // a task for another node goes through its queue so that it runs on that node first.
+        bool pushed = (self->_node == node) && self->_tasks.push (task);
+
+        if (!pushed && !_nodes[node]->jobs.push (task))
+        {
+            // every queue is full and this worker is the one that should drain them.
+            task ();
+            return;
+        }
+    }
+    else
+    {
+        Backoff backoff;
+        while (!_nodes[node]->jobs.push (task))
+        {
+            backoff ();
+        }
+    }
+
+    wakeup ();
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : take
+// =========================================================================
+bool ThreadPool::take (size_t index, Task& task) noexcept
+{
+    WorkerThread* worker = _workers[index].get ();
+
+    if (worker->_tasks.pop (task))
+    {
+        return true;
+    }
+
+    // local node first, the remote nodes only once it ran dry.
+    for (size_t i = 0; i < _nodes.size (); ++i)
+    {
+        if (take (*_nodes[(worker->_node + i) % _nodes.size ()], index, task))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : take
+// =========================================================================
+bool ThreadPool::take (Node& node, size_t index, Task& task) noexcept
+{
+    if (node.jobs.pop (task))
+    {
+        return true;
+    }
+
+    for (size_t i = 0; i < node.workers.size (); ++i)
+    {
+        size_t victim = node.workers[(index + i) % node.workers.size ()];
+
+        if ((victim != index) && _workers[victim]->_tasks.steal (task))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : pending
+// =========================================================================
+bool ThreadPool::pending () const noexcept
+{
+    for (auto& node : _nodes)
+    {
+        if (!node->jobs.empty ())
+        {
+            return true;
+        }
+    }
+
+    for (auto& worker : _workers)
+    {
+        if (!worker->_tasks.empty ())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : wakeup
+// =========================================================================
+void ThreadPool::wakeup () noexcept
+{
+    // pairs with the fences of park, either the worker sees the task or we see the worker.
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+
+    size_t sleepers = _sleepers.load (std::memory_order_relaxed);
+    if (JOIN_LIKELY (sleepers == 0) || (_signals.load (std::memory_order_relaxed) >= sleepers))
+    {
+        // nobody to wake up or every parked worker is already being woken up.
+        return;
+    }
+
+    {
+        ScopedLock<Mutex> lock (_mutex);
+        if (_signals.load (std::memory_order_relaxed) >= _sleepers.load (std::memory_order_relaxed))
+        {
+            return;
+        }
+        _signals.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    _condition.signal ();
+}
+
+// =========================================================================
+//   CLASS     : ThreadPool
+//   METHOD    : park
+// =========================================================================
+void ThreadPool::park ()
+{
+    _sleepers.fetch_add (1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+
+    if (!pending ())
+    {
+        ScopedLock<Mutex> lock (_mutex);
+        _condition.wait (lock, [this] () {
+            return _stop.load (std::memory_order_acquire) || (_signals.load (std::memory_order_relaxed) > 0);
+        });
+
+        if (_signals.load (std::memory_order_relaxed) > 0)
+        {
+            _signals.fetch_sub (1, std::memory_order_relaxed);
+        }
+    }
+
+    _sleepers.fetch_sub (1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_seq_cst);
+}
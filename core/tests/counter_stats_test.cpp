@@ -0,0 +1,98 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/statistics.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+using join::Counter;
+
+/**
+ * @brief Test record.
+ */
+TEST (CounterStats, record)
+{
+    Counter::Stats stats ("events");
+    EXPECT_EQ (stats.name (), "events");
+
+    stats.record (Counter::Duration (3));
+    stats.record (Counter::Duration (1));
+    stats.record (Counter::Duration (8));
+
+    EXPECT_EQ (stats.count (), 3);
+    EXPECT_EQ (stats.last ().count (), 8);
+    EXPECT_EQ (stats.min ().count (), 1);
+    EXPECT_EQ (stats.max ().count (), 8);
+    EXPECT_DOUBLE_EQ (stats.mean ().count (), 4.0);
+
+    stats.reset ();
+    EXPECT_EQ (stats.count (), 0);
+    EXPECT_EQ (stats.max ().count (), 0);
+}
+
+/**
+ * @brief Test percentile.
+ */
+TEST (CounterStats, percentile)
+{
+    Counter::Stats stats;
+
+    for (int i = 1; i <= 100; ++i)
+    {
+        stats.record (Counter::Duration (i));
+    }
+
+    EXPECT_GE (stats.percentile (50.0).count (), 50);
+    EXPECT_LE (stats.percentile (50.0).count (), 52);
+    EXPECT_GE (stats.percentile (99.0).count (), 99);
+    EXPECT_LE (stats.percentile (99.0).count (), 101);
+    EXPECT_DOUBLE_EQ (stats.mean ().count (), 50.5);
+}
+
+/**
+ * @brief Test stream insertion.
+ */
+TEST (CounterStats, print)
+{
+    Counter::Stats stats ("commands");
+    stats.record (Counter::Duration (12));
+
+    std::ostringstream oss;
+    oss << join::usec << join::kops << stats;
+
+    EXPECT_NE (oss.str ().find ("commands"), std::string::npos);
+    EXPECT_NE (oss.str ().find ("12.0"), std::string::npos);
+    EXPECT_EQ (oss.str ().find ("("), std::string::npos);
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -207,6 +207,124 @@ TEST (IoOperation, makeSend)
     ASSERT_EQ (op.data.stream.flags, MSG_DONTWAIT);
 }
 
+/**
+ * @brief Test makeSendZc.
+ */
+TEST (IoOperation, makeSendZc)
+{
+    const char* payload = "makeSendZc";
+
+    auto op = IoOperation::makeSendZc (8, payload, strlen (payload), MSG_DONTWAIT, nullptr);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::SendZc));
+    ASSERT_EQ (op.handler, nullptr);
+    ASSERT_EQ (op.data.stream.fd, 8);
+    ASSERT_EQ (op.data.stream.buf, payload);
+    ASSERT_EQ (op.data.stream.len, strlen (payload));
+    ASSERT_EQ (op.data.stream.flags, MSG_DONTWAIT);
+    ASSERT_TRUE (op.zeroCopy ());
+    ASSERT_FALSE (op.multishot ());
+
+    op = IoOperation::makeSend (8, payload, strlen (payload), MSG_DONTWAIT, nullptr);
+    ASSERT_FALSE (op.zeroCopy ());
+}
+
+/**
+ * @brief Test makeReadAt.
+ */
+TEST (IoOperation, makeReadAt)
+{
+    auto op = IoOperation::makeReadAt (8, buffer, sizeof (buffer), 4096, nullptr);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::Read));
+    ASSERT_EQ (op.data.rw.fd, 8);
+    ASSERT_EQ (op.data.rw.buf, buffer);
+    ASSERT_EQ (op.data.rw.len, sizeof (buffer));
+    ASSERT_EQ (op.data.rw.offset, 4096u);
+    ASSERT_TRUE (op.positional ());
+    ASSERT_FALSE (IoOperation::makeRead (8, buffer, sizeof (buffer), nullptr).positional ());
+}
+
+/**
+ * @brief Test makeWriteAt.
+ */
+TEST (IoOperation, makeWriteAt)
+{
+    auto op = IoOperation::makeWriteAt (8, buffer, sizeof (buffer), 4096, nullptr);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::Write));
+    ASSERT_EQ (op.data.rw.fd, 8);
+    ASSERT_EQ (op.data.rw.buf, buffer);
+    ASSERT_EQ (op.data.rw.len, sizeof (buffer));
+    ASSERT_EQ (op.data.rw.offset, 4096u);
+    ASSERT_TRUE (op.positional ());
+    ASSERT_FALSE (IoOperation::makeWrite (8, buffer, sizeof (buffer), nullptr).positional ());
+}
+
+/**
+ * @brief Test makeReadv.
+ */
+TEST (IoOperation, makeReadv)
+{
+    iovec iov[2] = {{buffer, 16}, {buffer + 16, 16}};
+
+    auto op = IoOperation::makeReadv (8, iov, 2, nullptr, true);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::Readv));
+    ASSERT_EQ (op.handler, nullptr);
+    ASSERT_TRUE (op.linked);
+    ASSERT_EQ (op.data.vec.fd, 8);
+    ASSERT_EQ (op.data.vec.iov, iov);
+    ASSERT_EQ (op.data.vec.iovcnt, 2);
+    ASSERT_EQ (op.data.vec.offset, IoOperation::noOffset);
+    ASSERT_FALSE (op.positional ());
+}
+
+/**
+ * @brief Test makeWritev.
+ */
+TEST (IoOperation, makeWritev)
+{
+    iovec iov[2] = {{buffer, 16}, {buffer + 16, 16}};
+
+    auto op = IoOperation::makeWritev (8, iov, 2, nullptr);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::Writev));
+    ASSERT_FALSE (op.linked);
+    ASSERT_EQ (op.data.vec.fd, 8);
+    ASSERT_EQ (op.data.vec.iov, iov);
+    ASSERT_EQ (op.data.vec.iovcnt, 2);
+    ASSERT_EQ (op.data.vec.offset, IoOperation::noOffset);
+}
+
+/**
+ * @brief Test makeTimeout.
+ */
+TEST (IoOperation, makeTimeout)
+{
+    auto op = IoOperation::makeTimeout (std::chrono::milliseconds (1500), nullptr);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::Timeout));
+    ASSERT_EQ (op.data.timeout.ts.tv_sec, 1);
+    ASSERT_EQ (op.data.timeout.ts.tv_nsec, 500000000);
+    ASSERT_TRUE (op.timeout ());
+    ASSERT_EQ (op.fd (), -1);
+}
+
+/**
+ * @brief Test makeLinkTimeout.
+ */
+TEST (IoOperation, makeLinkTimeout)
+{
+    auto op = IoOperation::makeLinkTimeout (std::chrono::microseconds (250), nullptr);
+
+    ASSERT_EQ (op.code, static_cast<uint8_t> (IoOperation::Opcode::LinkTimeout));
+    ASSERT_EQ (op.data.timeout.ts.tv_sec, 0);
+    ASSERT_EQ (op.data.timeout.ts.tv_nsec, 250000);
+    ASSERT_TRUE (op.timeout ());
+    ASSERT_EQ (op.fd (), -1);
+}
+
 /**
  * @brief Test fd.
  */
@@ -254,6 +372,18 @@ TEST (IoOperation, fd)
     op.data.stream.fd = 9;
     ASSERT_EQ (op.fd (), 9);
 
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::Readv);
+    op.data.vec.fd = 10;
+    ASSERT_EQ (op.fd (), 10);
+
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::Writev);
+    op.data.vec.fd = 11;
+    ASSERT_EQ (op.fd (), 11);
+
+    op.code = static_cast<uint8_t> (IoOperation::Opcode::SendZc);
+    op.data.stream.fd = 12;
+    ASSERT_EQ (op.fd (), 12);
+
     op.code = 255;
     ASSERT_EQ (op.fd (), -1);
 }
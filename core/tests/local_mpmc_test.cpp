@@ -30,6 +30,15 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <chrono>
+#include <vector>
+
+// C.
+#include <ctime>
+
+using namespace std::chrono_literals;
+
 using join::ScopedStats;
 using join::Rdtsc;
 using join::LocalMem;
@@ -406,6 +415,94 @@ TEST (LocalMpmc, popBenchmark)
     std::cout << join::mops << join::usec << std::fixed << std::setprecision (2) << stats << "\n";
 }
 
+/**
+ * @brief get the cpu time of the calling thread.
+ * @return cpu time of the calling thread.
+ */
+std::chrono::nanoseconds threadTime ()
+{
+    timespec ts{};
+    ::clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts);
+    return std::chrono::seconds (ts.tv_sec) + std::chrono::nanoseconds (ts.tv_nsec);
+}
+
+/**
+ * @brief test parking on an empty or full queue.
+ */
+TEST (LocalMpmc, park)
+{
+    LocalMem::Mpmc::Queue<uint64_t, join::SpinPark> queue (4);
+    std::chrono::nanoseconds cpu{0};
+    uint64_t data = 0;
+
+    Thread consumer ([&] () {
+        auto beg = threadTime ();
+        EXPECT_EQ (queue.pop (data), 0) << join::lastError.message ();
+        cpu = threadTime () - beg;
+    });
+    std::this_thread::sleep_for (200ms);
+    ASSERT_EQ (queue.push (uint64_t (42)), 0) << join::lastError.message ();
+    consumer.join ();
+    ASSERT_EQ (data, 42);
+    // the consumer slept instead of spinning.
+    ASSERT_LT (cpu, 50ms);
+
+    for (uint64_t i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ (queue.push (i), 0) << join::lastError.message ();
+    }
+    Thread producer ([&] () {
+        uint64_t batch[2] = {4, 5};
+        EXPECT_EQ (queue.push (batch, 2), 0) << join::lastError.message ();
+    });
+    std::this_thread::sleep_for (50ms);
+    uint64_t out[6] = {};
+    ASSERT_EQ (queue.pop (out, 6), 0) << join::lastError.message ();
+    producer.join ();
+    for (uint64_t i = 0; i < 6; ++i)
+    {
+        ASSERT_EQ (out[i], i);
+    }
+}
+
+/**
+ * @brief test that parked producers and consumers are all woken up.
+ */
+TEST (LocalMpmc, parkStress)
+{
+    const uint64_t num = 100000;
+    const int threads = 4;
+    LocalMem::Mpmc::Queue<uint64_t, join::SpinPark> queue (16);
+    std::atomic<uint64_t> sum{0};
+
+    std::vector<Thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back ([&] () {
+            for (uint64_t i = 1; i <= num / threads; ++i)
+            {
+                EXPECT_EQ (queue.push (i), 0) << join::lastError.message ();
+            }
+        });
+        workers.emplace_back ([&] () {
+            uint64_t data = 0;
+            for (uint64_t i = 1; i <= num / threads; ++i)
+            {
+                EXPECT_EQ (queue.pop (data), 0) << join::lastError.message ();
+                sum += data;
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join ();
+    }
+
+    const uint64_t count = num / threads;
+    ASSERT_EQ (sum, threads * (count * (count + 1) / 2));
+    ASSERT_TRUE (queue.empty ());
+}
+
 /**
  * @brief test pending.
  */
@@ -351,6 +351,30 @@ TEST (LocalSpsc, popBenchmark)
     std::cout << join::mops << join::usec << std::fixed << std::setprecision (2) << stats << "\n";
 }
 
+/**
+ * @brief test busy spin wait policy.
+ */
+TEST (LocalSpsc, busySpin)
+{
+    // large enough for the producer to never wait, a spinning thread only yields its core on preemption.
+    const uint64_t num = 10000;
+    LocalMem::Spsc::Queue<uint64_t, join::BusySpin> queue (num);
+
+    Thread producer ([&] () {
+        for (uint64_t i = 0; i < num; ++i)
+        {
+            EXPECT_EQ (queue.push (i), 0) << join::lastError.message ();
+        }
+    });
+    uint64_t data = 0;
+    for (uint64_t i = 0; i < num; ++i)
+    {
+        ASSERT_EQ (queue.pop (data), 0) << join::lastError.message ();
+        ASSERT_EQ (data, i);
+    }
+    producer.join ();
+}
+
 /**
  * @brief test pending.
  */
@@ -0,0 +1,306 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/condition.hpp>
+#include <join/proactor.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <utility>
+#include <vector>
+
+// C.
+#include <sys/socket.h>
+
+using join::Errc;
+using join::Mutex;
+using join::Condition;
+using join::ScopedLock;
+using join::ProactorGroup;
+using join::IoOperation;
+using join::CompletionHandler;
+
+/**
+ * @brief Class used to test ProactorGroup.
+ */
+class ProactorGroupTest : public CompletionHandler, public ::testing::Test
+{
+protected:
+    /**
+     * @brief Sets up the test fixture.
+     */
+    void SetUp () override
+    {
+        ASSERT_EQ (::socketpair (AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, _fds), 0);
+        _chained = nullptr;
+        _results.clear ();
+        _proactors.clear ();
+    }
+
+    /**
+     * @brief Tears down the test fixture.
+     */
+    void TearDown () override
+    {
+        ::close (_fds[0]);
+        ::close (_fds[1]);
+    }
+
+    /**
+     * @brief wait for a number of completions.
+     * @param count expected number of completions.
+     * @return true if received before timeout.
+     */
+    bool waitResults (size_t count)
+    {
+        {
+            ScopedLock<Mutex> lock (_mut);
+            if (!_cond.timedWait (lock, std::chrono::milliseconds (1000), [&] () {
+                    return _results.size () >= count;
+                }))
+            {
+                return false;
+            }
+        }
+
+        // operations live on the test stack and proactors reset their state after the callback,
+        // a synchronous command makes sure each proactor is done with them before they go out of scope.
+        for (size_t i = 0; i < _group.size (); ++i)
+        {
+            _group.proactor (i).migrate (_fds[0], _group.proactor (i), true);
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief method called when an operation completes.
+     * @param op completed operation.
+     * @param result bytes transferred or negative errno.
+     */
+    void onComplete ([[maybe_unused]] IoOperation* op, int result) override
+    {
+        IoOperation* chained = nullptr;
+
+        {
+            ScopedLock<Mutex> lock (_mut);
+            _results.push_back (result);
+            _proactors.push_back (_group.current ());
+            chained = std::exchange (_chained, nullptr);
+        }
+
+        if (chained != nullptr)
+        {
+            // submitted from a proactor thread of the group.
+            ASSERT_EQ (_group.submit (1, chained), 0) << join::lastError.message ();
+        }
+
+        _cond.signal ();
+    }
+
+    /**
+     * @brief method called when an operation is cancelled.
+     * @param op cancelled operation.
+     * @param result negative errno.
+     */
+    void onCancel (IoOperation* op, int result) override
+    {
+        onComplete (op, result);
+    }
+
+    /// proactor group.
+    static ProactorGroup _group;
+
+    /// connected sockets.
+    int _fds[2];
+
+    /// operation to submit on the next completion.
+    IoOperation* _chained = nullptr;
+
+    /// completion results.
+    std::vector<int> _results;
+
+    /// index of the proactor that dispatched each completion.
+    std::vector<int> _proactors;
+
+    /// condition variable.
+    Condition _cond;
+
+    /// condition mutex.
+    Mutex _mut;
+};
+
+ProactorGroup ProactorGroupTest::_group (2);
+
+/**
+ * @brief test size.
+ */
+TEST_F (ProactorGroupTest, size)
+{
+    ASSERT_EQ (_group.size (), 2);
+    ASSERT_THROW (ProactorGroup (0), std::invalid_argument);
+    ASSERT_THROW (_group.proactor (2), std::out_of_range);
+}
+
+/**
+ * @brief test affinity.
+ */
+TEST_F (ProactorGroupTest, affinity)
+{
+    const auto& cores = join::CpuTopology::instance ()->cores ();
+    ASSERT_FALSE (cores.empty ());
+
+    for (size_t i = 0; i < _group.size (); ++i)
+    {
+        ASSERT_EQ (_group.affinity (i), cores[i % cores.size ()].primaryThread ());
+    }
+}
+
+/**
+ * @brief test round robin.
+ */
+TEST_F (ProactorGroupTest, next)
+{
+    size_t first = _group.next ();
+    ASSERT_EQ (_group.next (), (first + 1) % _group.size ());
+    ASSERT_EQ (_group.next (), first);
+}
+
+/**
+ * @brief test current.
+ */
+TEST_F (ProactorGroupTest, current)
+{
+    ASSERT_EQ (_group.current (), -1);
+}
+
+/**
+ * @brief test submit.
+ */
+TEST_F (ProactorGroupTest, submit)
+{
+    char buf[16];
+    IoOperation op = IoOperation::makeRecv (_fds[0], buf, sizeof (buf), 0, this);
+
+    ASSERT_EQ (_group.submit (2, &op), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+
+    ASSERT_EQ (_group.submit (1, &op), 0) << join::lastError.message ();
+    ASSERT_EQ (::write (_fds[1], "ping", 4), 4);
+    ASSERT_TRUE (waitResults (1));
+    ASSERT_EQ (_results[0], 4);
+    ASSERT_EQ (_proactors[0], 1);
+}
+
+/**
+ * @brief test forward.
+ */
+TEST_F (ProactorGroupTest, forward)
+{
+    char buf[16];
+    IoOperation op = IoOperation::makeRecv (_fds[0], buf, sizeof (buf), 0, this);
+    IoOperation send = IoOperation::makeSend (_fds[0], "pong", 4, MSG_NOSIGNAL, this);
+    _chained = &send;
+
+    ASSERT_EQ (_group.submit (0, &op), 0) << join::lastError.message ();
+    ASSERT_EQ (::write (_fds[1], "ping", 4), 4);
+    ASSERT_TRUE (waitResults (2));
+    ASSERT_EQ (_results[0], 4);
+    ASSERT_EQ (_proactors[0], 0);
+    ASSERT_EQ (_results[1], 4);
+    ASSERT_EQ (_proactors[1], 1);
+
+    ASSERT_EQ (::read (_fds[1], buf, sizeof (buf)), 4);
+    ASSERT_EQ (std::string (buf, 4), "pong");
+}
+
+/**
+ * @brief test migrate.
+ */
+TEST_F (ProactorGroupTest, migrate)
+{
+    char buf[16];
+    IoOperation op = IoOperation::makeRecv (_fds[0], buf, sizeof (buf), 0, this);
+
+    ASSERT_EQ (_group.migrate (_fds[0], 0, 2), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+
+    ASSERT_EQ (_group.migrate (-1, 0, 1, true), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+
+    // nothing in flight.
+    ASSERT_EQ (_group.migrate (_fds[0], 0, 1, true), 0) << join::lastError.message ();
+
+    ASSERT_EQ (_group.submit (0, &op), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.migrate (_fds[0], 0, 1, true), 0) << join::lastError.message ();
+    ASSERT_EQ (::write (_fds[1], "ping", 4), 4);
+    ASSERT_TRUE (waitResults (1));
+    ASSERT_EQ (_results[0], 4);
+    ASSERT_EQ (_proactors[0], 1);
+}
+
+/**
+ * @brief test migrate with a registered file.
+ */
+TEST_F (ProactorGroupTest, migrateFixedFile)
+{
+    // slot number and descriptor are the same, so that both designate the operation.
+    std::vector<int> files (_fds[0] + 1, -1);
+    files[_fds[0]] = _fds[0];
+    ASSERT_EQ (_group.proactor (0).registerFiles (files), 0) << join::lastError.message ();
+
+    char buf[16];
+    IoOperation op = IoOperation::makeRecv (_fds[0], buf, sizeof (buf), 0, this);
+    op.fixedFile = true;
+
+    // the slot only exists in the file table of the first proactor.
+    ASSERT_EQ (_group.submit (0, &op), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.migrate (_fds[0], 0, 1, true), 0) << join::lastError.message ();
+    ASSERT_EQ (::write (_fds[1], "ping", 4), 4);
+    ASSERT_TRUE (waitResults (1));
+    ASSERT_EQ (_results[0], 4);
+    ASSERT_EQ (_proactors[0], 0);
+
+    ASSERT_EQ (_group.proactor (0).unregisterFiles (), 0) << join::lastError.message ();
+}
+
+/**
+ * @brief test mlock.
+ */
+TEST_F (ProactorGroupTest, mlock)
+{
+    ASSERT_EQ (_group.mlock (), 0) << join::lastError.message ();
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
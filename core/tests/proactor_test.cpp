@@ -30,6 +30,13 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <algorithm>
+#include <vector>
+
+// C.
+#include <fcntl.h>
+
 using join::Errc;
 using join::Mutex;
 using join::Condition;
@@ -145,6 +152,118 @@ protected:
     static char _buf[256];
 };
 
+/**
+ * @brief Class used to collect the completions of operations.
+ */
+class ResultHandler : public CompletionHandler
+{
+public:
+    /**
+     * @brief wait for a number of completions.
+     * @param count expected number of completions.
+     * @return true if received before timeout.
+     */
+    bool waitResults (size_t count)
+    {
+        ScopedLock<Mutex> lock (_mut);
+        return _cond.timedWait (lock, std::chrono::milliseconds (1000), [&] () {
+            return results.size () >= count;
+        });
+    }
+
+    /**
+     * @brief wait for the operation to be cancelled.
+     * @return true if cancelled before timeout.
+     */
+    bool waitCancelled ()
+    {
+        ScopedLock<Mutex> lock (_mut);
+        return _cond.timedWait (lock, std::chrono::milliseconds (1000), [&] () {
+            return cancelled;
+        });
+    }
+
+    /**
+     * @brief wait for a number of buffer releases.
+     * @param count expected number of releases.
+     * @return true if received before timeout.
+     */
+    bool waitReleased (size_t count)
+    {
+        ScopedLock<Mutex> lock (_mut);
+        return _cond.timedWait (lock, std::chrono::milliseconds (1000), [&] () {
+            return released >= count;
+        });
+    }
+
+    /// completion results.
+    std::vector<int> results;
+
+    /// provided buffer IDs of the completions.
+    std::vector<uint16_t> buffers;
+
+    /// operation cancelled.
+    bool cancelled = false;
+
+    /// number of buffers released.
+    size_t released = 0;
+
+    /// buffer released before the completion of its operation.
+    bool releasedEarly = false;
+
+    /// condition mutex.
+    Mutex _mut;
+
+    /// condition variable.
+    Condition _cond;
+
+protected:
+    /**
+     * @brief method called when an operation completes.
+     * @param op completed operation.
+     * @param result operation result.
+     */
+    void onComplete (IoOperation* op, int result) override
+    {
+        {
+            ScopedLock<Mutex> lock (_mut);
+            results.push_back (result);
+            buffers.push_back (op->buffer);
+        }
+
+        _cond.signal ();
+    }
+
+    /**
+     * @brief method called when an operation is cancelled.
+     * @param op cancelled operation.
+     * @param result negative errno.
+     */
+    void onCancel ([[maybe_unused]] IoOperation* op, [[maybe_unused]] int result) override
+    {
+        {
+            ScopedLock<Mutex> lock (_mut);
+            cancelled = (result == -ECANCELED);
+        }
+
+        _cond.signal ();
+    }
+
+    /**
+     * @brief method called when the buffer of a zero-copy send is released.
+     * @param op released operation.
+     */
+    void onRelease ([[maybe_unused]] IoOperation* op) override
+    {
+        {
+            ScopedLock<Mutex> lock (_mut);
+            releasedEarly |= (++released > results.size ());
+        }
+
+        _cond.signal ();
+    }
+};
+
 Tcp::Acceptor ProactorTest::_acceptor;
 Tcp::Socket ProactorTest::_client (Tcp::Socket::Blocking);
 Tcp::Socket ProactorTest::_server;
@@ -761,6 +880,485 @@ TEST_F (ProactorTest, asyncRecv)
     }
 }
 
+/**
+ * @brief Test multishot accept.
+ */
+TEST_F (ProactorTest, asyncAcceptMultishot)
+{
+    Proactor proactor;
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ResultHandler handler;
+    sockaddr_storage addr = {};
+    socklen_t addrlen = sizeof (addr);
+    auto op = IoOperation::makeAcceptMultishot (_acceptor.handle (), reinterpret_cast<sockaddr*> (&addr), &addrlen,
+                                                SOCK_NONBLOCK | SOCK_CLOEXEC, &handler);
+    ASSERT_TRUE (op.multishot ());
+    ASSERT_EQ (proactor.submit (&op, true, true), 0) << join::lastError.message ();
+
+    std::vector<Tcp::Socket> clients;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        clients.emplace_back (Tcp::Socket::Blocking);
+        ASSERT_EQ (clients.back ().connect ({_host, _port}), 0) << join::lastError.message ();
+    }
+
+    ASSERT_TRUE (handler.waitResults (clients.size ()));
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        for (size_t i = 0; i < clients.size (); ++i)
+        {
+            ASSERT_GE (handler.results[i], 0);
+            ::close (handler.results[i]);
+        }
+    }
+
+    ASSERT_EQ (proactor.cancel (&op, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitCancelled ());
+    ASSERT_EQ (op.state, IoOperation::State::Idle);
+
+    proactor.stop ();
+    th.join ();
+}
+
+/**
+ * @brief Test multishot recv with provided buffers.
+ */
+TEST_F (ProactorTest, asyncRecvMultishot)
+{
+    Proactor proactor;
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ASSERT_EQ (proactor.registerBufferRing (1, 3, 16), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+    ASSERT_EQ (proactor.registerBufferRing (1, 2, 0), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+    ASSERT_EQ (proactor.registerBufferRing (1, 2, 16), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.registerBufferRing (1, 2, 16), -1);
+    ASSERT_EQ (join::lastError, Errc::InUse);
+    ASSERT_NE (proactor.buffer (1, 1), nullptr);
+    ASSERT_EQ (proactor.buffer (1, 2), nullptr);
+    ASSERT_EQ (proactor.buffer (2, 0), nullptr);
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+
+    ResultHandler handler;
+    auto op = IoOperation::makeRecvMultishot (_server.handle (), 2, 0, &handler);
+    ASSERT_EQ (proactor.submit (&op, true, true), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+
+    op = IoOperation::makeRecvMultishot (_server.handle (), 1, 0, &handler);
+    ASSERT_EQ (proactor.submit (&op, true, true), 0) << join::lastError.message ();
+
+    // each completion holds a buffer until released.
+    std::vector<std::string> messages = {"hello", "world", "again"};
+    for (size_t i = 0; i < messages.size (); ++i)
+    {
+        ASSERT_EQ (_client.writeExactly (messages[i].c_str (), messages[i].size (), _timeout), 0)
+            << join::lastError.message ();
+        ASSERT_TRUE (handler.waitResults (i + 1));
+    }
+
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        std::vector<uint16_t> ids;
+        for (size_t i = 0; i < 2; ++i)
+        {
+            ASSERT_EQ (handler.results[i], int (messages[i].size ()));
+            ASSERT_EQ (std::string (static_cast<char*> (proactor.buffer (1, handler.buffers[i])), handler.results[i]),
+                       messages[i]);
+            ids.push_back (handler.buffers[i]);
+        }
+        ASSERT_NE (ids[0], ids[1]);
+
+        // ring exhausted, last completion.
+        ASSERT_EQ (handler.results[2], -ENOBUFS);
+
+        ASSERT_EQ (proactor.releaseBuffer (1, ids[0], true), 0) << join::lastError.message ();
+        ASSERT_EQ (proactor.releaseBuffer (1, ids[1], true), 0) << join::lastError.message ();
+        ASSERT_EQ (proactor.releaseBuffer (1, 2, true), -1);
+        ASSERT_EQ (join::lastError, Errc::InvalidParam);
+        handler.results.clear ();
+        handler.buffers.clear ();
+    }
+
+    ASSERT_EQ (op.state, IoOperation::State::Idle);
+    ASSERT_EQ (proactor.submit (&op, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (1));
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        ASSERT_EQ (handler.results[0], int (messages[2].size ()));
+    }
+
+    ASSERT_EQ (proactor.cancel (&op, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitCancelled ());
+
+    proactor.stop ();
+    th.join ();
+
+    ASSERT_EQ (proactor.unregisterBufferRing (1), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.unregisterBufferRing (1), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+}
+
+/**
+ * @brief Test operations on registered files.
+ */
+TEST_F (ProactorTest, asyncRecvFixedFile)
+{
+    Proactor proactor;
+
+    ASSERT_EQ (proactor.updateFiles (0, {-1}), -1);
+    ASSERT_EQ (proactor.unregisterFiles (), -1);
+    ASSERT_EQ (proactor.registerFiles ({}), -1);
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+
+    ASSERT_EQ (proactor.registerFiles ({-1, _server.handle ()}), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.registerFiles ({-1}), -1);
+
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ResultHandler handler;
+    char buf[64] = {};
+
+#ifndef JOIN_HAS_IO_URING
+    auto empty = IoOperation::makeRecv (0, buf, sizeof (buf), 0, &handler);
+    empty.fixedFile = true;
+    ASSERT_EQ (proactor.submit (&empty, true, true), -1);
+    ASSERT_EQ (join::lastError, std::errc::bad_file_descriptor);
+#endif
+
+    auto op = IoOperation::makeRecv (1, buf, sizeof (buf), 0, &handler);
+    op.fixedFile = true;
+    ASSERT_EQ (proactor.submit (&op, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (_client.writeExactly ("fixedFile", strlen ("fixedFile"), _timeout), 0) << join::lastError.message ();
+
+    ASSERT_TRUE (handler.waitResults (1));
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        ASSERT_EQ (handler.results[0], int (strlen ("fixedFile")));
+        ASSERT_EQ (std::string (buf, handler.results[0]), "fixedFile");
+    }
+
+    proactor.stop ();
+    th.join ();
+
+    ASSERT_EQ (proactor.updateFiles (1, {-1, -1}), -1);
+    ASSERT_EQ (proactor.updateFiles (1, {-1}), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.unregisterFiles (), 0) << join::lastError.message ();
+    ASSERT_TRUE (_server.opened ());
+}
+
+/**
+ * @brief Test direct accept.
+ */
+TEST_F (ProactorTest, asyncAcceptDirect)
+{
+    Proactor proactor;
+    ASSERT_EQ (proactor.registerFiles ({-1, -1}), 0) << join::lastError.message ();
+
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ResultHandler handler;
+    std::vector<Tcp::Socket> clients;
+    for (size_t i = 0; i < 3; ++i)
+    {
+        clients.emplace_back (Tcp::Socket::Blocking);
+    }
+
+    // accept in a given slot.
+    auto op1 = IoOperation::makeAcceptDirect (_acceptor.handle (), nullptr, nullptr, 0, 1, &handler);
+    ASSERT_EQ (proactor.submit (&op1, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (clients[0].connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (1));
+
+    // the accepted socket is only reachable through its slot.
+    char buf[64] = {};
+    auto op2 = IoOperation::makeRecv (1, buf, sizeof (buf), 0, &handler);
+    op2.fixedFile = true;
+    ASSERT_EQ (proactor.submit (&op2, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (clients[0].writeExactly ("acceptDirect", strlen ("acceptDirect"), _timeout), 0)
+        << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (2));
+
+    // accept in the first free slot.
+    auto op3 = IoOperation::makeAcceptDirect (_acceptor.handle (), nullptr, nullptr, 0, IoOperation::allocSlot,
+                                              &handler);
+    ASSERT_EQ (proactor.submit (&op3, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (clients[1].connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (3));
+
+    // table full.
+    auto op4 = IoOperation::makeAcceptDirect (_acceptor.handle (), nullptr, nullptr, 0, IoOperation::allocSlot,
+                                              &handler);
+    ASSERT_EQ (proactor.submit (&op4, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (clients[2].connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (4));
+
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        ASSERT_EQ (handler.results[0], 0);
+        ASSERT_EQ (handler.results[1], int (strlen ("acceptDirect")));
+        ASSERT_EQ (std::string (buf, handler.results[1]), "acceptDirect");
+        ASSERT_EQ (handler.results[2], 0);
+        ASSERT_EQ (handler.results[3], -ENFILE);
+    }
+
+    proactor.stop ();
+    th.join ();
+
+    // emptying the slots closes the accepted sockets.
+    ASSERT_EQ (proactor.updateFiles (0, {-1, -1}), 0) << join::lastError.message ();
+    ASSERT_EQ (::recv (clients[0].handle (), buf, sizeof (buf), 0), 0);
+    ASSERT_EQ (::recv (clients[1].handle (), buf, sizeof (buf), 0), 0);
+    ASSERT_EQ (proactor.unregisterFiles (), 0) << join::lastError.message ();
+}
+
+/**
+ * @brief Test timeout.
+ */
+TEST_F (ProactorTest, asyncTimeout)
+{
+    Proactor proactor;
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ResultHandler handler;
+    auto op = IoOperation::makeTimeout (std::chrono::milliseconds (20), &handler);
+    ASSERT_TRUE (op.timeout ());
+
+    auto beg = std::chrono::steady_clock::now ();
+    ASSERT_EQ (proactor.submit (&op, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (1));
+    ASSERT_GE (std::chrono::steady_clock::now () - beg, std::chrono::milliseconds (20));
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        ASSERT_EQ (handler.results[0], -ETIME);
+    }
+
+    ResultHandler cancelled;
+    auto op2 = IoOperation::makeTimeout (std::chrono::seconds (10), &cancelled);
+    ASSERT_EQ (proactor.submit (&op2, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.cancel (&op2, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (cancelled.waitCancelled ());
+
+    ResultHandler stopped;
+    auto op3 = IoOperation::makeTimeout (std::chrono::seconds (10), &stopped);
+    ASSERT_EQ (proactor.submit (&op3, true, true), 0) << join::lastError.message ();
+
+    proactor.stop ();
+    th.join ();
+
+    ASSERT_TRUE (stopped.waitCancelled ());
+}
+
+/**
+ * @brief Test link timeout.
+ */
+TEST_F (ProactorTest, asyncLinkTimeout)
+{
+    Proactor proactor;
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+
+    char buf[64] = {};
+
+    // the receive is cancelled on expiry.
+    ResultHandler recv1, timeout1;
+    auto op1 = IoOperation::makeRecv (_server.handle (), buf, sizeof (buf), 0, &recv1, true);
+    auto link1 = IoOperation::makeLinkTimeout (std::chrono::milliseconds (20), &timeout1);
+    ASSERT_EQ (proactor.submit (&op1, false, true), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.submit (&link1, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (recv1.waitCancelled ());
+    ASSERT_TRUE (timeout1.waitResults (1));
+    {
+        ScopedLock<Mutex> lock (timeout1._mut);
+        ASSERT_EQ (timeout1.results[0], -ETIME);
+    }
+
+    // the timeout is cancelled on completion.
+    ResultHandler recv2, timeout2;
+    auto op2 = IoOperation::makeRecv (_server.handle (), buf, sizeof (buf), 0, &recv2, true);
+    auto link2 = IoOperation::makeLinkTimeout (std::chrono::seconds (10), &timeout2);
+    ASSERT_EQ (proactor.submit (&op2, false, true), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.submit (&link2, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (_client.writeExactly ("linked", strlen ("linked"), _timeout), 0) << join::lastError.message ();
+    ASSERT_TRUE (recv2.waitResults (1));
+    ASSERT_TRUE (timeout2.waitCancelled ());
+    {
+        ScopedLock<Mutex> lock (recv2._mut);
+        ASSERT_EQ (recv2.results[0], int (strlen ("linked")));
+    }
+
+#ifndef JOIN_HAS_IO_URING
+    // nothing to bound.
+    auto link3 = IoOperation::makeLinkTimeout (std::chrono::seconds (10), nullptr);
+    ASSERT_EQ (proactor.submit (&link3, true, true), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+#else
+    // a linked operation waiting for the end of its chain can be cancelled.
+    ResultHandler recv3;
+    auto op3 = IoOperation::makeRecv (_server.handle (), buf, sizeof (buf), 0, &recv3, true);
+    ASSERT_EQ (proactor.submit (&op3, false, true), 0) << join::lastError.message ();
+    ASSERT_EQ (proactor.cancel (&op3, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (recv3.waitCancelled ());
+    ASSERT_EQ (op3.state, IoOperation::State::Idle);
+#endif
+
+    proactor.stop ();
+    th.join ();
+}
+
+/**
+ * @brief Test vectored and positional operations.
+ */
+TEST_F (ProactorTest, asyncVectored)
+{
+    Proactor proactor;
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+
+    // gather on a socket.
+    char head[] = "vec", tail[] = "tored";
+    iovec out[2] = {{head, 3}, {tail, 5}};
+    ResultHandler writev;
+    auto op1 = IoOperation::makeWritev (_server.handle (), out, 2, &writev);
+    ASSERT_EQ (proactor.submit (&op1, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (writev.waitResults (1));
+
+    char buf[64] = {};
+    ASSERT_EQ (_client.readExactly (buf, 8, _timeout), 0) << join::lastError.message ();
+    ASSERT_EQ (std::string (buf, 8), "vectored");
+
+    // positional writes on a regular file.
+    int fd = ::open ("/tmp/join_proactor_test", O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    ASSERT_NE (fd, -1);
+
+    ResultHandler write;
+    auto op2 = IoOperation::makeWriteAt (fd, "world", 5, 6, &write);
+    auto op3 = IoOperation::makeWriteAt (fd, "hello ", 6, 0, &write);
+    ASSERT_TRUE (op2.positional ());
+    ASSERT_EQ (proactor.submit (&op2, false, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (write.waitResults (1));
+    ASSERT_EQ (proactor.submit (&op3, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (write.waitResults (2));
+
+    // scatter from a regular file.
+    char first[6] = {}, second[5] = {};
+    iovec in[2] = {{first, sizeof (first)}, {second, sizeof (second)}};
+    ResultHandler readv;
+    auto op4 = IoOperation::makeReadv (fd, in, 2, &readv);
+    op4.data.vec.offset = 0;
+    ASSERT_EQ (proactor.submit (&op4, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (readv.waitResults (1));
+
+    ResultHandler read;
+    auto op5 = IoOperation::makeReadAt (fd, buf, sizeof (buf), 6, &read);
+    ASSERT_EQ (proactor.submit (&op5, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (read.waitResults (1));
+
+    {
+        ScopedLock<Mutex> lock (write._mut);
+        ASSERT_EQ (write.results[0], 5);
+        ASSERT_EQ (write.results[1], 6);
+    }
+    {
+        ScopedLock<Mutex> lock (readv._mut);
+        ASSERT_EQ (readv.results[0], 11);
+        ASSERT_EQ (std::string (first, sizeof (first)), "hello ");
+        ASSERT_EQ (std::string (second, sizeof (second)), "world");
+    }
+    {
+        ScopedLock<Mutex> lock (read._mut);
+        ASSERT_EQ (read.results[0], 5);
+        ASSERT_EQ (std::string (buf, 5), "world");
+    }
+
+    proactor.stop ();
+    th.join ();
+
+    ::close (fd);
+    ::unlink ("/tmp/join_proactor_test");
+}
+
+/**
+ * @brief Test zero-copy send.
+ */
+TEST_F (ProactorTest, asyncSendZc)
+{
+    Proactor proactor;
+    Thread th ([&proactor] () {
+        proactor.run ();
+    });
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+
+    std::vector<char> payload (65536);
+    for (size_t i = 0; i < payload.size (); ++i)
+    {
+        payload[i] = static_cast<char> (i % 251);
+    }
+
+    ResultHandler handler;
+    auto op1 = IoOperation::makeSendZc (_server.handle (), payload.data (), payload.size (), 0, &handler);
+    ASSERT_TRUE (op1.zeroCopy ());
+    ASSERT_EQ (proactor.submit (&op1, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitResults (1));
+
+    int sent = 0;
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        sent = handler.results[0];
+    }
+    ASSERT_GT (sent, 0);
+
+    std::vector<char> received (sent);
+    ASSERT_EQ (_client.readExactly (received.data (), sent, _timeout), 0) << join::lastError.message ();
+    ASSERT_TRUE (std::equal (received.begin (), received.end (), payload.begin ()));
+    ASSERT_TRUE (handler.waitReleased (1));
+    ASSERT_EQ (op1.state, IoOperation::State::Idle);
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        ASSERT_FALSE (handler.releasedEarly);
+    }
+
+    // nothing queued, the buffer is released right away.
+    auto op2 = IoOperation::makeSendZc (_server.handle (), payload.data (), 0, 0, &handler);
+    ASSERT_EQ (proactor.submit (&op2, true, true), 0) << join::lastError.message ();
+    ASSERT_TRUE (handler.waitReleased (2));
+
+    {
+        ScopedLock<Mutex> lock (handler._mut);
+        ASSERT_EQ (handler.results.size (), 2u);
+        ASSERT_EQ (handler.results[1], 0);
+        ASSERT_FALSE (handler.releasedEarly);
+    }
+
+    proactor.stop ();
+    th.join ();
+}
+
 /**
  * @brief Test onClose.
  */
@@ -222,6 +222,38 @@ TEST (RdtscStats, percentile)
     EXPECT_GE (stats.percentile (99.0), stats.min ());
 }
 
+/**
+ * @brief Test merge.
+ */
+TEST (RdtscStats, merge)
+{
+    Rdtsc::Stats stats1, stats2, total;
+
+    for (int i = 1; i <= 5; ++i)
+    {
+        auto beg = stats1.start ();
+        std::this_thread::sleep_for (std::chrono::milliseconds (i));
+        stats1.stop (beg);
+    }
+
+    auto beg = stats2.start ();
+    std::this_thread::sleep_for (20ms);
+    stats2.stop (beg);
+
+    total.merge (Rdtsc::Stats ());
+    EXPECT_EQ (total.count (), 0);
+
+    total.merge (stats1);
+    total.merge (stats2);
+    EXPECT_EQ (total.count (), 6);
+    EXPECT_EQ (total.min (), stats1.min ());
+    EXPECT_EQ (total.max (), stats2.max ());
+    EXPECT_EQ (total.last (), stats2.last ());
+    EXPECT_NEAR (total.mean ().count (), (stats1.mean ().count () * 5 + stats2.mean ().count ()) / 6, 1.0);
+    EXPECT_LE (total.percentile (50.0), stats1.percentile (99.0));
+    EXPECT_EQ (total.percentile (99.9), stats2.percentile (50.0));
+}
+
 #ifdef JOIN_HAS_NUMA
 /**
  * @brief Test mbind.
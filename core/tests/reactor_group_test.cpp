@@ -0,0 +1,361 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/reactor.hpp>
+#include <join/acceptor.hpp>
+#include <join/condition.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <thread>
+
+// C.
+#include <sys/eventfd.h>
+#include <fcntl.h>
+
+using join::Errc;
+using join::Mutex;
+using join::Condition;
+using join::ScopedLock;
+using join::ReactorGroup;
+using join::Tcp;
+
+/**
+ * @brief Class used to test ReactorGroup.
+ */
+class ReactorGroupTest : public join::EventHandler, public ::testing::Test
+{
+protected:
+    /**
+     * @brief Sets up the test fixture.
+     */
+    void SetUp () override
+    {
+        for (auto& fd : _fds)
+        {
+            fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+            ASSERT_NE (fd, -1);
+        }
+    }
+
+    /**
+     * @brief Tears down the test fixture.
+     */
+    void TearDown () override
+    {
+        for (auto& fd : _fds)
+        {
+            _group.delHandler (fd);
+            ::close (fd);
+        }
+    }
+
+    /**
+     * @brief method called when data are ready to be read on handle.
+     * @param fd file descriptor.
+     */
+    virtual void onReadable (int fd) override
+    {
+        uint64_t value;
+        ASSERT_GT (::read (fd, &value, sizeof (value)), 0);
+
+        {
+            ScopedLock<Mutex> lock (_mut);
+            _thread = _group.reactor (_group.indexOf (fd)).isReactorThread ();
+            _fired = fd;
+        }
+
+        _cond.signal ();
+    }
+
+    /// reactor group.
+    static ReactorGroup _group;
+
+    /// event file descriptors.
+    int _fds[4];
+
+    /// last fired file descriptor.
+    int _fired = -1;
+
+    /// event dispatched by the owning reactor thread.
+    bool _thread = false;
+
+    /// condition variable.
+    Condition _cond;
+
+    /// condition mutex.
+    Mutex _mut;
+};
+
+ReactorGroup ReactorGroupTest::_group (2);
+
+/**
+ * @brief test size.
+ */
+TEST_F (ReactorGroupTest, size)
+{
+    ASSERT_EQ (_group.size (), 2);
+    ASSERT_THROW (ReactorGroup (0), std::invalid_argument);
+    ASSERT_THROW (_group.reactor (2), std::out_of_range);
+}
+
+/**
+ * @brief test affinity.
+ */
+TEST_F (ReactorGroupTest, affinity)
+{
+    const auto& cores = join::CpuTopology::instance ()->cores ();
+    ASSERT_FALSE (cores.empty ());
+
+    for (size_t i = 0; i < _group.size (); ++i)
+    {
+        ASSERT_EQ (_group.affinity (i), cores[i % cores.size ()].primaryThread ());
+    }
+}
+
+/**
+ * @brief test round robin placement.
+ */
+TEST_F (ReactorGroupTest, roundRobin)
+{
+    _group.placement (ReactorGroup::Placement::RoundRobin);
+    ASSERT_EQ (_group.placement (), ReactorGroup::Placement::RoundRobin);
+
+    for (auto& fd : _fds)
+    {
+        ASSERT_EQ (_group.addHandler (fd, this), 0) << join::lastError.message ();
+    }
+
+    ASSERT_EQ (_group.load (0), 2);
+    ASSERT_EQ (_group.load (1), 2);
+    ASSERT_NE (_group.indexOf (_fds[0]), _group.indexOf (_fds[1]));
+    ASSERT_EQ (_group.indexOf (_fds[0]), _group.indexOf (_fds[2]));
+
+    // adding again keeps the handler on its reactor.
+    const int index = _group.indexOf (_fds[0]);
+    ASSERT_EQ (_group.addHandler (_fds[0], this, true, true), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.indexOf (_fds[0]), index);
+    ASSERT_EQ (_group.load (0) + _group.load (1), 4);
+}
+
+/**
+ * @brief test least loaded placement.
+ */
+TEST_F (ReactorGroupTest, leastLoaded)
+{
+    _group.placement (ReactorGroup::Placement::LeastLoaded);
+    ASSERT_EQ (_group.placement (), ReactorGroup::Placement::LeastLoaded);
+
+    ASSERT_EQ (_group.addHandler (1, _fds[0], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.addHandler (1, _fds[1], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.addHandler (_fds[2], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.indexOf (_fds[2]), 0);
+    ASSERT_EQ (_group.addHandler (_fds[3], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.indexOf (_fds[3]), 0);
+    ASSERT_EQ (_group.load (0), 2);
+    ASSERT_EQ (_group.load (1), 2);
+}
+
+/**
+ * @brief test incoming CPU placement.
+ */
+TEST_F (ReactorGroupTest, incomingCpu)
+{
+    _group.placement (ReactorGroup::Placement::IncomingCpu);
+    ASSERT_EQ (_group.placement (), ReactorGroup::Placement::IncomingCpu);
+
+    Tcp::Acceptor acceptor;
+    ASSERT_EQ (acceptor.create ({"127.0.0.1", 5050}), 0) << join::lastError.message ();
+
+    Tcp::Socket client (Tcp::Socket::Blocking);
+    ASSERT_EQ (client.connect ({"127.0.0.1", 5050}), 0) << join::lastError.message ();
+    ASSERT_EQ (client.write ("x", 1), 1) << join::lastError.message ();
+
+    Tcp::Socket server = acceptor.accept ();
+    ASSERT_TRUE (server.connected ()) << join::lastError.message ();
+
+    int cpu = -1;
+    socklen_t len = sizeof (cpu);
+    ASSERT_EQ (::getsockopt (server.handle (), SOL_SOCKET, SO_INCOMING_CPU, &cpu, &len), 0);
+
+    ASSERT_EQ (_group.addHandler (server.handle (), this), 0) << join::lastError.message ();
+    const int index = _group.indexOf (server.handle ());
+    ASSERT_NE (index, -1);
+    if (_group.affinity (index) != cpu)
+    {
+        ASSERT_EQ (index, cpu % int (_group.size ()));
+    }
+    ASSERT_EQ (_group.delHandler (server.handle ()), 0) << join::lastError.message ();
+
+    // not a socket: fall back to least loaded.
+    ASSERT_EQ (_group.addHandler (1, _fds[0], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.addHandler (_fds[1], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.indexOf (_fds[1]), 0);
+
+    server.close ();
+    client.close ();
+    acceptor.close ();
+}
+
+/**
+ * @brief test addHandler.
+ */
+TEST_F (ReactorGroupTest, addHandler)
+{
+    ASSERT_EQ (_group.addHandler (2, _fds[0], this), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+
+    ASSERT_EQ (_group.addHandler (0, _fds[0], nullptr), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+    ASSERT_EQ (_group.indexOf (_fds[0]), -1);
+    ASSERT_EQ (_group.load (0), 0);
+
+    ASSERT_EQ (_group.addHandler (0, _fds[0], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.addHandler (1, _fds[0], this), -1);
+    ASSERT_EQ (join::lastError, Errc::InUse);
+    ASSERT_EQ (_group.indexOf (_fds[0]), 0);
+}
+
+/**
+ * @brief test delHandler.
+ */
+TEST_F (ReactorGroupTest, delHandler)
+{
+    ASSERT_EQ (_group.delHandler (_fds[0]), -1);
+    ASSERT_EQ (join::lastError, Errc::NotFound);
+
+    ASSERT_EQ (_group.addHandler (1, _fds[0], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.load (1), 1);
+    ASSERT_EQ (_group.delHandler (_fds[0]), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.load (1), 0);
+    ASSERT_EQ (_group.indexOf (_fds[0]), -1);
+}
+
+/**
+ * @brief test an exclusive handler added to several reactors.
+ */
+TEST_F (ReactorGroupTest, exclusive)
+{
+    struct Listener : public join::EventHandler
+    {
+        void onReadable (int fd) override
+        {
+            int sock = ::accept4 (fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (sock != -1)
+            {
+                ::close (sock);
+                ++count;
+            }
+        }
+
+        std::atomic<int> count{0};
+    };
+
+    Tcp::Acceptor acceptor;
+    ASSERT_EQ (acceptor.create ({"127.0.0.1", 5051}), 0) << join::lastError.message ();
+    ASSERT_EQ (::fcntl (acceptor.handle (), F_SETFL, ::fcntl (acceptor.handle (), F_GETFL) | O_NONBLOCK), 0);
+
+    Listener listener;
+    for (size_t i = 0; i < _group.size (); ++i)
+    {
+        ASSERT_EQ (_group.addHandler (i, acceptor.handle (), &listener, true, false, true, join::Reactor::Exclusive), 0)
+            << join::lastError.message ();
+        ASSERT_EQ (_group.load (i), 1);
+    }
+    ASSERT_EQ (_group.indexOf (acceptor.handle ()), 0);
+
+    // a non exclusive handler can't share the fd.
+    ASSERT_EQ (_group.addHandler (1, _fds[0], this), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.addHandler (0, _fds[0], this, true, false, true, join::Reactor::Exclusive), -1);
+    ASSERT_EQ (join::lastError, Errc::InUse);
+    ASSERT_EQ (_group.delHandler (_fds[0]), 0) << join::lastError.message ();
+
+    for (int i = 0; i < 8; ++i)
+    {
+        Tcp::Socket client (Tcp::Socket::Blocking);
+        ASSERT_EQ (client.connect ({"127.0.0.1", 5051}), 0) << join::lastError.message ();
+        client.close ();
+    }
+
+    for (int i = 0; (i < 100) && (listener.count != 8); ++i)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (10));
+    }
+    ASSERT_EQ (listener.count, 8);
+
+    ASSERT_EQ (_group.delHandler (acceptor.handle ()), 0) << join::lastError.message ();
+    ASSERT_EQ (_group.indexOf (acceptor.handle ()), -1);
+    for (size_t i = 0; i < _group.size (); ++i)
+    {
+        ASSERT_EQ (_group.load (i), 0);
+    }
+
+    acceptor.close ();
+}
+
+/**
+ * @brief test events are dispatched by the owning reactor.
+ */
+TEST_F (ReactorGroupTest, dispatch)
+{
+    for (size_t i = 0; i < _group.size (); ++i)
+    {
+        ASSERT_EQ (_group.addHandler (i, _fds[i], this), 0) << join::lastError.message ();
+    }
+
+    for (size_t i = 0; i < _group.size (); ++i)
+    {
+        ScopedLock<Mutex> lock (_mut);
+        _fired = -1;
+        _thread = false;
+
+        uint64_t value = 1;
+        ASSERT_EQ (::write (_fds[i], &value, sizeof (value)), ssize_t (sizeof (value)));
+
+        ASSERT_TRUE (_cond.timedWait (lock, std::chrono::seconds (5), [&] () {
+            return _fired == _fds[i];
+        }));
+        ASSERT_TRUE (_thread);
+    }
+}
+
+/**
+ * @brief test mlock.
+ */
+TEST_F (ReactorGroupTest, mlock)
+{
+    ASSERT_EQ (_group.mlock (), 0) << join::lastError.message ();
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -30,6 +30,13 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <thread>
+
+// C.
+#include <sys/eventfd.h>
+#include <fcntl.h>
+
 using join::Errc;
 using join::Mutex;
 using join::Condition;
@@ -291,6 +298,336 @@ TEST_F (ReactorTest, delHandler)
     th.join ();
 }
 
+/**
+ * @brief Test handler deleted by a previous event of the same batch.
+ */
+TEST_F (ReactorTest, delHandlerPending)
+{
+    struct Deleter : public join::EventHandler
+    {
+        void onReadable (int fd) override
+        {
+            uint64_t value;
+            ASSERT_GT (::read (fd, &value, sizeof (value)), 0);
+            reactor->delHandler (other);
+            ++count;
+        }
+
+        Reactor* reactor;
+        int other;
+        std::atomic<int> count{0};
+    };
+
+    Reactor reactor;
+    Deleter first, second;
+    int fds[2];
+
+    for (auto& fd : fds)
+    {
+        fd = eventfd (1, EFD_NONBLOCK | EFD_CLOEXEC);
+        ASSERT_NE (fd, -1);
+    }
+
+    first.reactor = second.reactor = &reactor;
+    first.other = fds[1];
+    second.other = fds[0];
+
+    // both handlers are registered before the first wait so both fds are reported in the same batch.
+    ASSERT_EQ (reactor.addHandler (fds[0], &first, true, false, false), 0) << join::lastError.message ();
+    ASSERT_EQ (reactor.addHandler (fds[1], &second, true, false, false), 0) << join::lastError.message ();
+
+    Thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    ASSERT_EQ (first.count + second.count, 1);
+
+    // the fd that was deleted can be registered again.
+    const int fd = first.count ? fds[1] : fds[0];
+    Deleter& deleted = first.count ? second : first;
+    deleted.other = -1;
+    uint64_t value = 1;
+    ASSERT_EQ (::write (fd, &value, sizeof (value)), ssize_t (sizeof (value)));
+    ASSERT_EQ (reactor.addHandler (fd, &deleted), 0) << join::lastError.message ();
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    ASSERT_EQ (deleted.count, 1);
+    ASSERT_EQ (reactor.delHandler (fd), 0) << join::lastError.message ();
+
+    reactor.stop ();
+    th.join ();
+
+    for (auto& fd : fds)
+    {
+        ::close (fd);
+    }
+}
+
+/**
+ * @brief Test handlers updated while no event loop runs.
+ */
+TEST_F (ReactorTest, stopped)
+{
+    struct Counter : public join::EventHandler
+    {
+        void onReadable (int fd) override
+        {
+            uint64_t value;
+            ASSERT_GT (::read (fd, &value, sizeof (value)), 0);
+            ++count;
+        }
+
+        std::atomic<int> count{0};
+    };
+
+    Reactor reactor;
+    Counter counter;
+    int fd = eventfd (1, EFD_NONBLOCK | EFD_CLOEXEC);
+    ASSERT_NE (fd, -1);
+
+    // more commands than the queue holds, nothing reads it.
+    for (int i = 0; i < 2048; ++i)
+    {
+        ASSERT_EQ (reactor.addHandler (fd, &counter, true, false, false), 0) << join::lastError.message ();
+        ASSERT_EQ (reactor.delHandler (fd, false), 0) << join::lastError.message ();
+    }
+    ASSERT_EQ (reactor.delHandler (fd), -1);
+    ASSERT_EQ (join::lastError, std::errc::no_such_file_or_directory);
+    ASSERT_EQ (reactor.addHandler (fd, &counter), 0) << join::lastError.message ();
+
+    Thread th ([&reactor] () {
+        reactor.run ();
+    });
+    while (!reactor.isRunning ())
+    {
+    }
+    std::this_thread::sleep_for (std::chrono::milliseconds (50));
+    ASSERT_EQ (counter.count, 1);
+
+    // a synchronous update racing with the end of the loop doesn't wait for it.
+    std::atomic<bool> stop{false};
+    std::thread updater ([&] () {
+        while (!stop)
+        {
+            reactor.delHandler (fd);
+            reactor.addHandler (fd, &counter);
+        }
+    });
+    std::this_thread::sleep_for (std::chrono::milliseconds (10));
+    reactor.stop ();
+    th.join ();
+    stop = true;
+    updater.join ();
+
+    ASSERT_EQ (reactor.delHandler (fd), 0) << join::lastError.message ();
+    ::close (fd);
+}
+
+/**
+ * @brief Test spin.
+ */
+TEST_F (ReactorTest, spin)
+{
+    Reactor reactor (1000);
+    ASSERT_EQ (reactor.spin (), 1000);
+
+    Thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+    ASSERT_EQ (reactor.addHandler (handle (), this), 0) << join::lastError.message ();
+
+    for (uint32_t spin : {1000u, 0u, 1000u})
+    {
+        reactor.spin (spin);
+        ASSERT_EQ (reactor.spin (), spin);
+
+        // let the loop park when spin budget is exhausted.
+        std::this_thread::sleep_for (std::chrono::milliseconds (10));
+
+        {
+            ScopedLock<Mutex> lock (_mut);
+            _event.clear ();
+            ASSERT_EQ (_client.write ("spin", 4), 4) << join::lastError.message ();
+            ASSERT_TRUE (_cond.timedWait (lock, std::chrono::milliseconds (_timeout), [] () {
+                return !_event.empty ();
+            }));
+            ASSERT_EQ (_event, "spin");
+        }
+    }
+
+    ASSERT_EQ (reactor.delHandler (handle ()), 0) << join::lastError.message ();
+
+    reactor.stop ();
+    th.join ();
+}
+
+/**
+ * @brief Test edge triggered handler.
+ */
+TEST_F (ReactorTest, edgeTriggered)
+{
+    struct Edge : public join::EventHandler
+    {
+        void onReadable (int fd) override
+        {
+            // don't drain the fd.
+            static_cast<void> (fd);
+            ++count;
+        }
+
+        std::atomic<int> count{0};
+    };
+
+    Reactor reactor;
+    Thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    Edge edge;
+    int fd = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ASSERT_NE (fd, -1);
+    ASSERT_EQ (reactor.addHandler (fd, &edge, true, false, true, Reactor::EdgeTriggered), 0)
+        << join::lastError.message ();
+
+    uint64_t value = 1;
+    ASSERT_EQ (::write (fd, &value, sizeof (value)), ssize_t (sizeof (value)));
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    ASSERT_EQ (edge.count, 1);
+
+    // a new write is a new edge.
+    ASSERT_EQ (::write (fd, &value, sizeof (value)), ssize_t (sizeof (value)));
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    ASSERT_EQ (edge.count, 2);
+
+    ASSERT_EQ (reactor.delHandler (fd), 0) << join::lastError.message ();
+    ::close (fd);
+
+    reactor.stop ();
+    th.join ();
+}
+
+/**
+ * @brief Test exclusive handler.
+ */
+TEST_F (ReactorTest, exclusive)
+{
+    struct Listener : public join::EventHandler
+    {
+        void onReadable (int fd) override
+        {
+            int sock = ::accept4 (fd, nullptr, nullptr, SOCK_CLOEXEC);
+            if (sock != -1)
+            {
+                ::close (sock);
+                ++count;
+            }
+        }
+
+        std::atomic<int> count{0};
+    };
+
+    Reactor first, second;
+    Thread th1 ([&first] () {
+        first.run ();
+    });
+    Thread th2 ([&second] () {
+        second.run ();
+    });
+
+    // both reactors may still be woken up.
+    ASSERT_EQ (::fcntl (_acceptor.handle (), F_SETFL, ::fcntl (_acceptor.handle (), F_GETFL) | O_NONBLOCK), 0);
+
+    Listener listener;
+    ASSERT_EQ (first.addHandler (_acceptor.handle (), &listener, true, false, true, Reactor::Exclusive), 0)
+        << join::lastError.message ();
+    ASSERT_EQ (second.addHandler (_acceptor.handle (), &listener, true, false, true, Reactor::Exclusive), 0)
+        << join::lastError.message ();
+
+    // an exclusive registration can't be modified.
+    ASSERT_EQ (first.addHandler (_acceptor.handle (), &listener, true, true, true, Reactor::Exclusive), -1);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        Tcp::Socket client (Tcp::Socket::Blocking);
+        ASSERT_EQ (client.connect ({_host, _port}), 0) << join::lastError.message ();
+        client.close ();
+    }
+
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+    ASSERT_EQ (listener.count, 8);
+
+    ASSERT_EQ (first.delHandler (_acceptor.handle ()), 0) << join::lastError.message ();
+    ASSERT_EQ (second.delHandler (_acceptor.handle ()), 0) << join::lastError.message ();
+
+    first.stop ();
+    second.stop ();
+    th1.join ();
+    th2.join ();
+}
+
+#ifdef JOIN_HAS_REACTOR_STATS
+/**
+ * @brief Test stats.
+ */
+TEST_F (ReactorTest, stats)
+{
+    Reactor reactor;
+    reactor.stats ().reset ();
+    ASSERT_EQ (reactor.stats ().events.count (), 0);
+    ASSERT_EQ (reactor.stats ().slowest.load (), -1);
+
+    Thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    // commands only go through the queue, and its latency collector, once the loop runs.
+    while (!reactor.isRunning ())
+    {
+        std::this_thread::yield ();
+    }
+
+    ASSERT_EQ (_client.connect ({_host, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE ((_server = _acceptor.accept ()).connected ()) << join::lastError.message ();
+    ASSERT_EQ (reactor.addHandler (handle (), this), 0) << join::lastError.message ();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ScopedLock<Mutex> lock (_mut);
+        _event.clear ();
+        ASSERT_EQ (_client.write ("stat", 4), 4) << join::lastError.message ();
+        ASSERT_TRUE (_cond.timedWait (lock, std::chrono::milliseconds (_timeout), [] () {
+            return !_event.empty ();
+        }));
+    }
+
+    ASSERT_EQ (reactor.delHandler (handle ()), 0) << join::lastError.message ();
+
+    auto& stats = reactor.stats ();
+    EXPECT_GE (stats.events.count (), 4);
+    EXPECT_GE (stats.events.min ().count (), 1);
+    EXPECT_GE (stats.events.mean ().count (), 1.0);
+    EXPECT_EQ (stats.dispatch.count (), 3);
+    EXPECT_GT (stats.dispatch.max ().count (), 0);
+    EXPECT_EQ (stats.slowest.load (), handle ());
+    EXPECT_GE (stats.commands.count (), 1);
+    EXPECT_GE (stats.commands.max ().count (), 1);
+    EXPECT_EQ (stats.latency.count (), 2);
+    EXPECT_GT (stats.latency.max ().count (), 0);
+
+    stats.reset ();
+    EXPECT_EQ (stats.dispatch.count (), 0);
+    EXPECT_EQ (stats.slowest.load (), -1);
+
+    ASSERT_GE (ReactorThread::stats ().events.count (), 0);
+
+    reactor.stop ();
+    th.join ();
+}
+#endif
+
 #ifdef JOIN_HAS_NUMA
 /**
  * @brief Test mbind.
@@ -31,6 +31,14 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <chrono>
+
+// C.
+#include <ctime>
+
+using namespace std::chrono_literals;
+
 using join::ScopedStats;
 using join::Rdtsc;
 using join::Semaphore;
@@ -463,6 +471,41 @@ TEST_F (ShmMpmc, popBenchmark)
     ASSERT_EQ (WEXITSTATUS (status), 0);
 }
 
+/**
+ * @brief test parking on an empty queue shared between processes.
+ */
+TEST_F (ShmMpmc, park)
+{
+    ShmMem::Mpmc::Queue<uint64_t, join::SpinPark> prod (512, _name);
+
+    pid_t child = fork ();
+    if (child == 0)
+    {
+        ShmMem::Mpmc::Queue<uint64_t, join::SpinPark> cons (512, _name);
+        uint64_t data = 0;
+        timespec beg{}, end{};
+        ::clock_gettime (CLOCK_THREAD_CPUTIME_ID, &beg);
+        if ((cons.pop (data) == -1) || (data != 42))
+        {
+            _exit (1);
+        }
+        ::clock_gettime (CLOCK_THREAD_CPUTIME_ID, &end);
+        auto cpu = std::chrono::seconds (end.tv_sec - beg.tv_sec) +
+                   std::chrono::nanoseconds (end.tv_nsec - beg.tv_nsec);
+        // the consumer slept instead of spinning.
+        _exit (cpu < 50ms ? 0 : 2);
+    }
+
+    EXPECT_NE (child, -1);
+    std::this_thread::sleep_for (200ms);
+    ASSERT_EQ (prod.push (uint64_t (42)), 0) << join::lastError.message ();
+
+    int status;
+    waitpid (child, &status, 0);
+    ASSERT_TRUE (WIFEXITED (status));
+    ASSERT_EQ (WEXITSTATUS (status), 0);
+}
+
 /**
  * @brief test pending.
  */
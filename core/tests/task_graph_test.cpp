@@ -0,0 +1,249 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/task_graph.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+using join::Monotonic;
+using join::ThreadPool;
+using join::Errc;
+
+/**
+ * @brief test add.
+ */
+TEST (TaskGraph, add)
+{
+    ThreadPool pool (2);
+    Monotonic::TaskGraph graph (pool);
+    ASSERT_EQ (graph.size (), 0u);
+    ASSERT_EQ (graph.run (), 0);
+
+    int value = 0;
+    ASSERT_EQ (graph.add ("first", [&value] () {
+        ++value;
+    }), 0u);
+    ASSERT_EQ (graph.add (
+                   "second",
+                   [&value] (int inc) {
+                       value += inc;
+                   },
+                   2),
+               1u);
+    ASSERT_EQ (graph.size (), 2u);
+    ASSERT_EQ (graph.stats (1).name (), "second");
+    ASSERT_THROW (graph.stats (2), std::out_of_range);
+
+    ASSERT_EQ (graph.run (), 0);
+    ASSERT_EQ (value, 3);
+
+    // the graph can't be modified while it runs.
+    graph.add ("third", [&graph] () {
+        graph.add ("fourth", [] () {});
+    });
+    ASSERT_THROW (graph.run (), std::system_error);
+    ASSERT_EQ (graph.size (), 3u);
+}
+
+/**
+ * @brief test precede.
+ */
+TEST (TaskGraph, precede)
+{
+    ThreadPool pool (2);
+    Monotonic::TaskGraph graph (pool);
+    size_t a = graph.add ("a", [] () {});
+    size_t b = graph.add ("b", [] () {});
+    size_t c = graph.add ("c", [] () {});
+
+    ASSERT_EQ (graph.precede (a, 3), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+    ASSERT_EQ (graph.precede (a, a), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+
+    ASSERT_EQ (graph.precede (a, b), 0);
+    ASSERT_EQ (graph.precede (b, c), 0);
+    ASSERT_EQ (graph.run (), 0);
+
+    // cycle.
+    ASSERT_EQ (graph.precede (c, a), 0);
+    ASSERT_EQ (graph.run (), -1);
+    ASSERT_EQ (join::lastError, Errc::InvalidParam);
+}
+
+/**
+ * @brief test run.
+ */
+TEST (TaskGraph, run)
+{
+    ThreadPool pool (4);
+    Monotonic::TaskGraph graph (pool);
+
+    // decode → (classify, enrich) → serialize.
+    std::atomic<int> step{0};
+    int decoded = -1, classified = -1, enriched = -1, serialized = -1;
+
+    size_t decode = graph.add ("decode", [&] () {
+        decoded = step++;
+    });
+    size_t classify = graph.add ("classify", [&] () {
+        classified = step++;
+    });
+    size_t enrich = graph.add ("enrich", [&] () {
+        enriched = step++;
+    });
+    size_t serialize = graph.add ("serialize", [&] () {
+        serialized = step++;
+    });
+
+    ASSERT_EQ (graph.precede (decode, classify), 0);
+    ASSERT_EQ (graph.precede (decode, enrich), 0);
+    ASSERT_EQ (graph.precede (classify, serialize), 0);
+    ASSERT_EQ (graph.precede (enrich, serialize), 0);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        step = 0;
+        ASSERT_EQ (graph.run (), 0);
+        ASSERT_EQ (step, 4);
+        ASSERT_EQ (decoded, 0);
+        ASSERT_LT (decoded, classified);
+        ASSERT_LT (decoded, enriched);
+        ASSERT_EQ (serialized, 3);
+    }
+
+    ASSERT_EQ (graph.stats ().count (), 1000u);
+    for (size_t i = 0; i < graph.size (); ++i)
+    {
+        ASSERT_EQ (graph.stats (i).count (), 1000u);
+    }
+
+    std::cout << join::mops << join::usec << std::fixed << std::setprecision (3) << graph.stats () << "\n";
+}
+
+/**
+ * @brief test destroying the graph right after a run.
+ */
+TEST (TaskGraph, destroy)
+{
+    ThreadPool pool (4);
+    std::atomic<int> count{0};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        Monotonic::TaskGraph graph (pool);
+        size_t first = graph.add ("first", [&count] () {
+            ++count;
+        });
+        for (int j = 0; j < 4; ++j)
+        {
+            size_t next = graph.add ("next", [&count] () {
+                ++count;
+            });
+            ASSERT_EQ (graph.precede (first, next), 0);
+        }
+        ASSERT_EQ (graph.run (), 0);
+    }
+
+    ASSERT_EQ (count, 5000);
+}
+
+/**
+ * @brief test that a chain of tasks stays on the same worker.
+ */
+TEST (TaskGraph, continuation)
+{
+    ThreadPool pool (4);
+    Monotonic::TaskGraph graph (pool);
+
+    std::vector<std::thread::id> ids (8);
+    for (size_t i = 0; i < ids.size (); ++i)
+    {
+        graph.add ("step", [&ids, i] () {
+            ids[i] = std::this_thread::get_id ();
+        });
+        if (i > 0)
+        {
+            ASSERT_EQ (graph.precede (i - 1, i), 0);
+        }
+    }
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ (graph.run (), 0);
+        for (auto& id : ids)
+        {
+            ASSERT_EQ (id, ids.front ());
+        }
+    }
+}
+
+/**
+ * @brief test exception propagation.
+ */
+TEST (TaskGraph, exception)
+{
+    ThreadPool pool (2);
+    Monotonic::TaskGraph graph (pool);
+
+    bool skipped = true, independent = false;
+    size_t fail = graph.add ("fail", [] () {
+        throw std::runtime_error ("failed");
+    });
+    size_t after = graph.add ("after", [&skipped] () {
+        skipped = false;
+    });
+    size_t last = graph.add ("last", [&skipped] () {
+        skipped = false;
+    });
+    size_t other = graph.add ("other", [&independent] () {
+        independent = true;
+    });
+    ASSERT_EQ (graph.precede (fail, after), 0);
+    ASSERT_EQ (graph.precede (after, last), 0);
+    ASSERT_EQ (graph.precede (other, last), 0);
+
+    ASSERT_THROW (graph.run (), std::runtime_error);
+    ASSERT_TRUE (skipped);
+    ASSERT_TRUE (independent);
+
+    // the graph can run again.
+    ASSERT_THROW (graph.run (), std::runtime_error);
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
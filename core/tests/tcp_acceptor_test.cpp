@@ -28,6 +28,9 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C.
+#include <poll.h>
+
 using join::Errc;
 using join::IpAddress;
 using join::Tcp;
@@ -67,6 +70,29 @@ TEST (TcpAcceptor, create)
     ASSERT_EQ (join::lastError, Errc::InUse);
 }
 
+/**
+ * @brief Test create method with port reuse.
+ */
+TEST (TcpAcceptor, reusePort)
+{
+    Tcp::Socket clientSocket (Tcp::Socket::Blocking);
+    Tcp::Acceptor server1, server2, server3;
+
+    ASSERT_EQ (server1.create ({address, port}, true), 0) << join::lastError.message ();
+    ASSERT_EQ (server2.create ({address, port}, true), 0) << join::lastError.message ();
+    ASSERT_EQ (server3.create ({address, port}), -1);
+
+    ASSERT_EQ (clientSocket.connect ({address, port}), 0) << join::lastError.message ();
+    struct pollfd fds[2] = {{server1.handle (), POLLIN, 0}, {server2.handle (), POLLIN, 0}};
+    ASSERT_EQ (::poll (fds, 2, 1000), 1);
+    Tcp::Acceptor& ready = (fds[0].revents & POLLIN) ? server1 : server2;
+    ASSERT_TRUE (ready.accept ().connected ());
+    clientSocket.close ();
+
+    server1.close ();
+    server2.close ();
+}
+
 /**
  * @brief Test close method.
  */
@@ -29,6 +29,9 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C.
+#include <cstring>
+
 using join::Errc;
 using join::IpAddress;
 using join::ReactorThread;
@@ -335,6 +338,30 @@ TEST_F (TcpSocket, read)
     tcpSocket.close ();
 }
 
+/**
+ * @brief Test peek method.
+ */
+TEST_F (TcpSocket, peek)
+{
+    Tcp::Socket tcpSocket (Tcp::Socket::Blocking);
+    char data[] = {0x00, 0x65, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x5B, 0x22, 0x6B, 0x6F, 0x22, 0x5D};
+    char peeked[sizeof (data)] = {};
+
+    ASSERT_EQ (tcpSocket.peek (data, sizeof (data)), -1);
+    ASSERT_EQ (join::lastError, Errc::OperationFailed);
+    ASSERT_EQ (tcpSocket.connect ({_hostv4, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE (tcpSocket.waitReadyWrite (_timeout)) << join::lastError.message ();
+    ASSERT_EQ (tcpSocket.writeExactly (data, sizeof (data)), 0) << join::lastError.message ();
+    ASSERT_TRUE (tcpSocket.waitReadyRead (_timeout)) << join::lastError.message ();
+    int nread = tcpSocket.peek (peeked, sizeof (peeked));
+    ASSERT_GT (nread, 0) << join::lastError.message ();
+    ASSERT_GE (tcpSocket.canRead (), nread);
+    ASSERT_EQ (tcpSocket.read (data, nread), nread) << join::lastError.message ();
+    ASSERT_EQ (std::memcmp (data, peeked, nread), 0);
+    ASSERT_EQ (tcpSocket.disconnect (), 0) << join::lastError.message ();
+    tcpSocket.close ();
+}
+
 /**
  * @brief Test readExactly method.
  */
@@ -411,6 +438,23 @@ TEST_F (TcpSocket, writeExactly)
     tcpSocket.close ();
 }
 
+/**
+ * @brief Test writeZeroCopy method.
+ */
+TEST_F (TcpSocket, writeZeroCopy)
+{
+    Tcp::Socket tcpSocket (Tcp::Socket::Blocking);
+    char data[] = {0x00, 0x65, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x5B, 0x22, 0x6B, 0x6F, 0x22, 0x5D};
+
+    ASSERT_EQ (tcpSocket.writeZeroCopy (data, sizeof (data)), -1);
+    ASSERT_EQ (tcpSocket.connect ({_hostv4, _port}), 0) << join::lastError.message ();
+    ASSERT_TRUE (tcpSocket.waitReadyWrite (_timeout)) << join::lastError.message ();
+    ASSERT_EQ (tcpSocket.writeZeroCopy (data, sizeof (data), _timeout), 0) << join::lastError.message ();
+    ASSERT_TRUE (tcpSocket.waitReadyRead (_timeout)) << join::lastError.message ();
+    ASSERT_EQ (tcpSocket.disconnect (), 0) << join::lastError.message ();
+    tcpSocket.close ();
+}
+
 /**
  * @brief Test setMode method.
  */
@@ -30,8 +30,18 @@
 // Libraries.
 #include <gtest/gtest.h>
 
+// C++.
+#include <functional>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <array>
+#include <list>
+
 // C.
+#include <pthread.h>
 #include <unistd.h>
+#include <sched.h>
 
 using namespace std::chrono_literals;
 
@@ -68,6 +78,149 @@ TEST (ThreadPool, push)
     ASSERT_EQ (count, nthread);
 }
 
+/**
+ * @brief test push with arguments.
+ */
+TEST (ThreadPool, pushArgs)
+{
+    std::atomic<int> sum{0};
+    {
+        ThreadPool pool;
+        pool.push (
+            [&sum] (int a, int b) {
+                sum += a + b;
+            },
+            1, 2);
+    }
+    ASSERT_EQ (sum, 3);
+}
+
+/**
+ * @brief test push of a callable larger than the task storage.
+ */
+TEST (ThreadPool, pushLarge)
+{
+    std::atomic<int> sum{0};
+    std::array<int, 64> values;
+    values.fill (1);
+    {
+        ThreadPool pool;
+        pool.push ([&sum, values] () {
+            sum += std::accumulate (values.begin (), values.end (), 0);
+        });
+    }
+    ASSERT_EQ (sum, 64);
+}
+
+/**
+ * @brief test push from worker threads.
+ */
+TEST (ThreadPool, pushNested)
+{
+    std::atomic<int> count{0};
+    std::function<void (int)> spawn;
+    {
+        ThreadPool pool (2);
+        spawn = [&] (int depth) {
+            ++count;
+            if (depth > 0)
+            {
+                pool.push (spawn, depth - 1);
+                pool.push (spawn, depth - 1);
+            }
+        };
+        pool.push (spawn, 12);
+    }
+    ASSERT_EQ (count, (1 << 13) - 1);
+}
+
+/**
+ * @brief test push flood.
+ */
+TEST (ThreadPool, pushFlood)
+{
+    std::atomic<int> count{0};
+    {
+        ThreadPool pool (2);
+        for (int i = 0; i < 100000; ++i)
+        {
+            pool.push ([&count] {
+                ++count;
+            });
+        }
+    }
+    ASSERT_EQ (count, 100000);
+}
+
+/**
+ * @brief test numa placement.
+ */
+TEST (ThreadPool, numa)
+{
+    ThreadPool floating;
+    ASSERT_EQ (floating.nodes (), std::vector<int> ({-1}));
+
+    std::vector<int> primaries;
+    for (const auto& core : CpuTopology::instance ()->cores ())
+    {
+        primaries.push_back (core.primaryThread ());
+    }
+
+    std::vector<int> cpus (nthread * 4, -1);
+    cpu_set_t before, after;
+    ASSERT_EQ (pthread_getaffinity_np (pthread_self (), sizeof (before), &before), 0);
+
+    std::atomic<size_t> remote{0};
+    size_t nodes = 0;
+    {
+        ThreadPool pool (nthread, ThreadPool::Numa);
+
+        // the constructing thread gets its affinity back.
+        ASSERT_EQ (pthread_getaffinity_np (pthread_self (), sizeof (after), &after), 0);
+        ASSERT_TRUE (CPU_EQUAL (&before, &after));
+
+        ASSERT_EQ (pool.size (), nthread);
+        nodes = pool.nodes ().size ();
+        ASSERT_GT (nodes, 0u);
+
+        for (size_t i = 0; i < cpus.size (); ++i)
+        {
+            pool.push ([&cpus, i] () {
+                cpus[i] = ::sched_getcpu ();
+            });
+        }
+
+        for (int numa : pool.nodes ())
+        {
+            for (size_t i = 0; i < 64; ++i)
+            {
+                // a task may be stolen by another node, so only check that the job runs.
+                pool.pushOn (numa, [&remote] () {
+                    ++remote;
+                });
+            }
+        }
+
+        // unknown node falls back to the node of the calling thread.
+        pool.pushOn (-1, [&remote] () {
+            ++remote;
+        });
+
+        // too large for the task storage, allocated in the node arena.
+        std::array<int, 64> values;
+        values.fill (1);
+        pool.push ([&remote, values] () {
+            remote += std::accumulate (values.begin (), values.end (), 0) - 63;
+        });
+    }
+
+    for (int cpu : cpus)
+    {
+        ASSERT_NE (std::find (primaries.begin (), primaries.end (), cpu), primaries.end ());
+    }
+    ASSERT_EQ (remote, (nodes * 64) + 2);
+}
+
 /**
  * @brief test parallelForEach.
  */
@@ -82,6 +235,150 @@ TEST (ThreadPool, parallelForEach)
     ASSERT_GE (elapsed, 20ms);
 }
 
+/**
+ * @brief test parallelForEach on a forward range.
+ */
+TEST (ThreadPool, parallelForEachList)
+{
+    std::list<int> values (10000, 0);
+    join::parallelForEach (
+        values.begin (), values.end (),
+        [] (int& value) {
+            ++value;
+        },
+        16);
+    ASSERT_EQ (std::count (values.begin (), values.end (), 1), 10000);
+}
+
+/**
+ * @brief test parallelForEach called from a task.
+ */
+TEST (ThreadPool, parallelForEachNested)
+{
+    std::vector<int> values (10000, 0);
+    std::atomic<bool> done{false};
+    {
+        ThreadPool pool (2);
+        pool.push ([&] {
+            join::parallelForEach (pool, values.begin (), values.end (), [] (int& value) {
+                ++value;
+            });
+            done = true;
+        });
+    }
+    ASSERT_TRUE (done);
+    ASSERT_EQ (std::count (values.begin (), values.end (), 1), 10000);
+}
+
+/**
+ * @brief test distribute.
+ */
+TEST (ThreadPool, distribute)
+{
+    ThreadPool pool (4);
+    std::vector<int> values (100000, 0);
+    std::atomic<size_t> chunks{0};
+    join::distribute (
+        pool, values.begin (), values.end (),
+        [&] (std::vector<int>::iterator beg, std::vector<int>::iterator end) {
+            // only the last chunk may be smaller than the grain.
+            if ((end - beg) < 100)
+            {
+                ASSERT_EQ (end, values.end ());
+            }
+            for (; beg != end; ++beg)
+            {
+                ++*beg;
+            }
+            ++chunks;
+        },
+        100);
+    ASSERT_EQ (std::count (values.begin (), values.end (), 1), 100000);
+    ASSERT_GT (chunks, 1u);
+    ASSERT_LE (chunks, 1000u);
+
+    ASSERT_THROW (join::distribute (
+                      pool, values.begin (), values.end (),
+                      [] (std::vector<int>::iterator, std::vector<int>::iterator) {
+                          throw std::runtime_error ("failed");
+                      },
+                      100),
+                  std::runtime_error);
+
+    chunks = 0;
+    join::distribute (values.begin (), values.begin (), [&] (std::vector<int>::iterator, std::vector<int>::iterator) {
+        ++chunks;
+    });
+    ASSERT_EQ (chunks, 0u);
+}
+
+/**
+ * @brief test parallelReduce.
+ */
+TEST (ThreadPool, parallelReduce)
+{
+    std::vector<uint64_t> values (100000);
+    std::iota (values.begin (), values.end (), 1);
+    ASSERT_EQ (join::parallelReduce (values.begin (), values.end (), uint64_t (0)), 5000050000u);
+    ASSERT_EQ (join::parallelReduce (
+                   values.begin (), values.end (), uint64_t (0),
+                   [] (uint64_t a, uint64_t b) {
+                       return std::max (a, b);
+                   },
+                   64),
+               100000u);
+
+    std::list<int> list (1000, 2);
+    ASSERT_EQ (join::parallelReduce (list.begin (), list.end (), 0), 2000);
+}
+
+/**
+ * @brief test parallelTransform.
+ */
+TEST (ThreadPool, parallelTransform)
+{
+    std::vector<int> values (100000);
+    std::iota (values.begin (), values.end (), 0);
+    std::vector<int> squares (values.size ());
+    auto end = join::parallelTransform (values.begin (), values.end (), squares.begin (), [] (int value) {
+        return value * 2;
+    });
+    ASSERT_EQ (end, squares.end ());
+    for (size_t i = 0; i < values.size (); ++i)
+    {
+        ASSERT_EQ (squares[i], values[i] * 2);
+    }
+}
+
+/**
+ * @brief test parallelSort.
+ */
+TEST (ThreadPool, parallelSort)
+{
+    std::mt19937 gen (42);
+    std::vector<int> values (100000);
+    for (auto& value : values)
+    {
+        value = int (gen ());
+    }
+
+    std::vector<int> expected (values);
+    std::sort (expected.begin (), expected.end ());
+
+    std::vector<int> sorted (values);
+    join::parallelSort (sorted.begin (), sorted.end ());
+    ASSERT_EQ (sorted, expected);
+
+    ThreadPool pool (3);
+    sorted = values;
+    join::parallelSort (pool, sorted.begin (), sorted.end (), std::greater<> (), 1000);
+    ASSERT_TRUE (std::is_sorted (sorted.begin (), sorted.end (), std::greater<> ()));
+
+    std::vector<int> few{3, 1, 2};
+    join::parallelSort (few.begin (), few.end ());
+    ASSERT_EQ (few, std::vector<int> ({1, 2, 3}));
+}
+
 /**
  * @brief main function.
  */
@@ -0,0 +1,331 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/timer_wheel.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+using join::Monotonic;
+
+/**
+ * @brief Test setOneShot.
+ */
+TEST (TimerWheel, setOneShot)
+{
+    Monotonic::WheelTimer timer;
+    std::atomic<int> count{0};
+
+    timer.setOneShot (10ms, [&] {
+        ++count;
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (count, 1);
+    EXPECT_FALSE (timer.active ());
+    EXPECT_TRUE (timer.oneShot ());
+    EXPECT_EQ (timer.interval (), 0ms);
+
+    timer.setOneShot (std::chrono::steady_clock::now () + 10ms, [&] {
+        ++count;
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (count, 2);
+    EXPECT_FALSE (timer.active ());
+
+    timer.setOneShot (0ms, [&] {
+        ++count;
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (count, 3);
+    EXPECT_FALSE (timer.active ());
+
+    // re-arming replaces the pending expiry.
+    timer.setOneShot (10ms, [&] {
+        count += 10;
+    });
+    timer.setOneShot (20ms, [&] {
+        ++count;
+    });
+    std::this_thread::sleep_for (50ms);
+    EXPECT_EQ (count, 4);
+}
+
+/**
+ * @brief Test setInterval.
+ */
+TEST (TimerWheel, setInterval)
+{
+    Monotonic::WheelTimer timer;
+    std::atomic<int> count{0};
+
+    timer.setInterval (10ms, [&] {
+        ++count;
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_GT (count, 1);
+    EXPECT_TRUE (timer.active ());
+    EXPECT_FALSE (timer.oneShot ());
+    EXPECT_EQ (timer.interval (), 10ms);
+
+    timer.cancel ();
+
+    std::atomic<int> fired{0};
+
+    timer.setInterval (0ms, [&] {
+        ++fired;
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (fired, 1);
+    EXPECT_FALSE (timer.active ());
+}
+
+/**
+ * @brief Test cancel.
+ */
+TEST (TimerWheel, cancel)
+{
+    Monotonic::WheelTimer timer;
+    std::atomic<int> count1{0};
+    int count2 = 0;
+
+    timer.setInterval (10ms, [&] {
+        count1++;
+    });
+    std::this_thread::sleep_for (35ms);
+    timer.cancel ();
+    count2 = count1;
+    EXPECT_GT (count2, 1);
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (count1, count2);
+}
+
+/**
+ * @brief Test timer modified by its own callback.
+ */
+TEST (TimerWheel, callback)
+{
+    Monotonic::WheelTimer timer;
+    std::atomic<int> count{0};
+
+    // cancel.
+    timer.setInterval (5ms, [&] {
+        ++count;
+        timer.cancel ();
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (count, 1);
+    EXPECT_FALSE (timer.active ());
+
+    // re-arm.
+    std::function<void ()> retry = [&] {
+        if (++count < 4)
+        {
+            timer.setOneShot (5ms, retry);
+        }
+    };
+    timer.setOneShot (5ms, retry);
+    std::this_thread::sleep_for (60ms);
+    EXPECT_EQ (count, 4);
+    EXPECT_FALSE (timer.active ());
+
+    // destroy.
+    auto owned = std::make_unique<Monotonic::WheelTimer> ();
+    owned->setInterval (5ms, [&] {
+        ++count;
+        owned.reset ();
+    });
+    std::this_thread::sleep_for (35ms);
+    EXPECT_EQ (count, 5);
+    EXPECT_EQ (owned, nullptr);
+}
+
+/**
+ * @brief Test timers spread over the wheel levels.
+ */
+TEST (TimerWheel, levels)
+{
+    // 10us ticks: 2.56ms on the first level, 164ms on the second.
+    Monotonic::TimerWheel wheel (join::ReactorThread::reactor (), 10us);
+    EXPECT_EQ (wheel.resolution (), 10us);
+    EXPECT_EQ (wheel.type (), CLOCK_MONOTONIC);
+
+    const std::vector<std::chrono::milliseconds> delays = {1ms, 5ms, 30ms, 200ms, 400ms};
+    std::vector<std::unique_ptr<Monotonic::WheelTimer>> timers;
+    std::vector<std::chrono::steady_clock::time_point> fired (delays.size ());
+    std::atomic<size_t> count{0};
+
+    const auto start = std::chrono::steady_clock::now ();
+
+    for (size_t i = 0; i < delays.size (); ++i)
+    {
+        timers.emplace_back (new Monotonic::WheelTimer (wheel));
+        timers.back ()->setOneShot (delays[i], [&, i] {
+            fired[i] = std::chrono::steady_clock::now ();
+            ++count;
+        });
+    }
+    EXPECT_EQ (wheel.size (), delays.size ());
+
+    std::this_thread::sleep_for (500ms);
+    ASSERT_EQ (count, delays.size ());
+    EXPECT_EQ (wheel.size (), 0);
+
+    for (size_t i = 0; i < delays.size (); ++i)
+    {
+        EXPECT_GE (fired[i] - start, delays[i]);
+        EXPECT_LT (fired[i] - start, delays[i] + 50ms);
+    }
+}
+
+/**
+ * @brief Test expiry of many timers.
+ */
+TEST (TimerWheel, batch)
+{
+    Monotonic::TimerWheel wheel;
+    std::vector<std::unique_ptr<Monotonic::WheelTimer>> timers;
+    std::atomic<int> count{0};
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        timers.emplace_back (new Monotonic::WheelTimer (wheel));
+        timers.back ()->setOneShot (std::chrono::milliseconds (100 + (i % 50)), [&] {
+            ++count;
+        });
+    }
+
+    // cancel every other timer.
+    for (size_t i = 0; i < timers.size (); i += 2)
+    {
+        timers[i]->cancel ();
+    }
+    EXPECT_EQ (wheel.size (), 5000);
+
+    std::this_thread::sleep_for (300ms);
+    EXPECT_EQ (count, 5000);
+    EXPECT_EQ (wheel.size (), 0);
+}
+
+/**
+ * @brief Test active.
+ */
+TEST (TimerWheel, active)
+{
+    Monotonic::WheelTimer timer;
+
+    ASSERT_FALSE (timer.active ());
+    timer.setInterval (10ms, [] {
+    });
+    ASSERT_TRUE (timer.active ());
+    timer.cancel ();
+    ASSERT_FALSE (timer.active ());
+}
+
+/**
+ * @brief Test remaining.
+ */
+TEST (TimerWheel, remaining)
+{
+    Monotonic::WheelTimer timer;
+
+    timer.setOneShot (20ms, [] {
+    });
+    auto t1 = timer.remaining ();
+    std::this_thread::sleep_for (15ms);
+    auto t2 = timer.remaining ();
+    EXPECT_GT (t2.count (), 0);
+    EXPECT_LT (t2.count (), t1.count ());
+    std::this_thread::sleep_for (15ms);
+    auto t3 = timer.remaining ();
+    EXPECT_EQ (t3.count (), 0);
+
+    timer.setInterval (20ms, [] {
+    });
+    t1 = timer.remaining ();
+    std::this_thread::sleep_for (15ms);
+    t2 = timer.remaining ();
+    EXPECT_GT (t2.count (), 0);
+    EXPECT_LT (t2.count (), t1.count ());
+    std::this_thread::sleep_for (15ms);
+    t3 = timer.remaining ();
+    EXPECT_GT (t3.count (), 0);
+}
+
+/**
+ * @brief Test interval.
+ */
+TEST (TimerWheel, interval)
+{
+    Monotonic::WheelTimer timer;
+
+    ASSERT_EQ (timer.interval (), 0ms);
+    timer.setInterval (10ms, [] {
+    });
+    ASSERT_EQ (timer.interval (), 10ms);
+    timer.cancel ();
+    ASSERT_EQ (timer.interval (), 0ms);
+}
+
+/**
+ * @brief Test oneShot.
+ */
+TEST (TimerWheel, oneShot)
+{
+    Monotonic::WheelTimer timer;
+
+    ASSERT_TRUE (timer.oneShot ());
+    timer.setInterval (10ms, [] {
+    });
+    ASSERT_FALSE (timer.oneShot ());
+    timer.cancel ();
+    ASSERT_TRUE (timer.oneShot ());
+}
+
+/**
+ * @brief Test type.
+ */
+TEST (TimerWheel, type)
+{
+    Monotonic::WheelTimer timer;
+
+    ASSERT_EQ (timer.type (), CLOCK_MONOTONIC);
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -567,6 +567,29 @@ namespace join
             return _socket.read (buf, len);
         }
 
+        /**
+         * @brief read data from the TLS stream without consuming it.
+         * incoming records are processed, so post-handshake messages are consumed on the way.
+         * @param buf buffer to read into.
+         * @param len maximum number of bytes to read.
+         * @return number of bytes read on success, -1 on failure.
+         */
+        int peek (char* buf, unsigned long len) noexcept
+        {
+            if (_ssl)
+            {
+                int nread = SSL_peek (_ssl.get (), buf, static_cast<int> (len));
+                if (nread < 1)
+                {
+                    return handleTlsError (nread);
+                }
+
+                return nread;
+            }
+
+            return _socket.peek (buf, len);
+        }
+
         /**
          * @brief read data until size is reached or an error occurred.
          * @param data buffer used to store the data received.
@@ -26,12 +26,16 @@
 #define JOIN_SERVICES_CACHE_HPP
 
 // libjoin.
+#include <join/reactor.hpp>
 #include <join/mutex.hpp>
 
 // C++.
+#include <unordered_map>
+#include <chrono>
 #include <string>
 #include <memory>
-#include <map>
+#include <atomic>
+#include <list>
 
 // C.
 #include <sys/stat.h>
@@ -40,14 +44,39 @@ namespace join
 {
     /**
      * @brief File cache.
+     * cached files are spread over shards each protected by its own lock, the mapped bytes are
+     * bounded by a budget enforced with LRU eviction, and a cached file is checked on disk at most
+     * once per revalidation interval, or never once its directory is watched with inotify.
      */
-    class Cache
+    class Cache : protected EventHandler
     {
     public:
+        /**
+         * @brief cached file.
+         */
+        struct File
+        {
+            /**
+             * @brief unmap and close the file.
+             */
+            ~File ();
+
+            void* addr; /**< file content address. */
+            off_t size; /**< file size. */
+            int fd;     /**< file descriptor. */
+        };
+
+        /// shared cached file, kept mapped as long as referenced even if evicted.
+        using FilePtr = std::shared_ptr<const File>;
+
         /**
          * @brief create instance.
+         * @param budget maximum number of mapped bytes (0 for unlimited).
+         * @param revalidate interval between two checks of a cached file on disk (0 to check every time).
+         * @param shards number of shards.
          */
-        Cache () = default;
+        explicit Cache (size_t budget = 0, std::chrono::milliseconds revalidate = std::chrono::milliseconds::zero (),
+                        size_t shards = 16);
 
         /**
          * @brief create instance by copy.
@@ -82,11 +111,22 @@ namespace join
 
         /**
          * @brief get or create the cache entry for the given file.
+         * the returned buffer can be unmapped as soon as another thread evicts, invalidates or removes the entry.
          * @param fileName path of the file that we want to get cache.
          * @param sbuf file stat.
          * @return a pointer to the buffer where the cached file is saved.
+         * @deprecated use acquire() that keeps the file mapped while referenced.
          */
-        void* get (const std::string& fileName, struct stat& sbuf);
+        [[deprecated ("use acquire () that keeps the file mapped while referenced")]] void* get (
+            const std::string& fileName, struct stat& sbuf);
+
+        /**
+         * @brief get or create the cache entry for the given file and keep it mapped while referenced.
+         * @param fileName path of the file that we want to get cache.
+         * @param sbuf file stat.
+         * @return the cached file on success, nullptr on failure.
+         */
+        FilePtr acquire (const std::string& fileName, struct stat& sbuf);
 
         /**
          * @brief remove a cached entry identified by the given file name.
@@ -104,22 +144,226 @@ namespace join
          */
         size_t size ();
 
+        /**
+         * @brief set the maximum number of mapped bytes.
+         * @param bytes maximum number of mapped bytes (0 for unlimited).
+         */
+        void budget (size_t bytes) noexcept;
+
+        /**
+         * @brief get the maximum number of mapped bytes.
+         * @return maximum number of mapped bytes (0 for unlimited).
+         */
+        size_t budget () const noexcept;
+
+        /**
+         * @brief set the maximum number of entries, each one holding an open file descriptor.
+         * @param entries maximum number of entries (0 for unlimited).
+         */
+        void capacity (size_t entries) noexcept;
+
+        /**
+         * @brief get the maximum number of entries.
+         * @return maximum number of entries (0 for unlimited).
+         */
+        size_t capacity () const noexcept;
+
+        /**
+         * @brief set the interval between two checks of a cached file on disk.
+         * @param interval revalidation interval (0 to check every time).
+         */
+        void revalidate (std::chrono::milliseconds interval) noexcept;
+
+        /**
+         * @brief get the interval between two checks of a cached file on disk.
+         * @return revalidation interval.
+         */
+        std::chrono::milliseconds revalidate () const noexcept;
+
+        /**
+         * @brief watch the directories of the cached files with inotify through the given reactor.
+         * cached files are then dropped when changed on disk and served without any system call.
+         * @param reactor reactor used to dispatch the inotify events.
+         * @return 0 on success, -1 on failure.
+         */
+        int watch (Reactor& reactor);
+
+        /**
+         * @brief stop watching the directories of the cached files.
+         */
+        void unwatch ();
+
+        /**
+         * @brief check if the directories of the cached files are watched.
+         * @return true if watched.
+         */
+        bool watching () const noexcept;
+
+        /**
+         * @brief get number of mapped bytes.
+         * @return number of mapped bytes.
+         */
+        size_t bytes () const noexcept;
+
+        /**
+         * @brief get number of lookups served from the cache.
+         * @return number of hits.
+         */
+        uint64_t hits () const noexcept;
+
+        /**
+         * @brief get number of lookups that had to map the file.
+         * @return number of misses.
+         */
+        uint64_t misses () const noexcept;
+
+        /**
+         * @brief get number of entries evicted to honor the budget or the capacity.
+         * @return number of evictions.
+         */
+        uint64_t evictions () const noexcept;
+
     protected:
         /**
          *  @brief cache entry.
          */
         struct CacheEntry
         {
-            off_t size;                /**< file size. */
-            struct timespec modifTime; /**< file modification date. */
-            void* addr;                /**< file content address. */
+            FilePtr file;                                /**< cached file. */
+            struct stat sbuf;                            /**< file stat at last check. */
+            std::chrono::steady_clock::time_point check; /**< last check on disk. */
+            std::list<std::string>::iterator lru;        /**< position in the LRU list. */
+            bool watched;                                /**< changes are notified by inotify. */
         };
 
-        /// cached entries map.
-        std::map<std::string, std::unique_ptr<CacheEntry>> _entries;
+        /**
+         * @brief cache shard.
+         */
+        struct Shard
+        {
+            /// cached entries map.
+            std::unordered_map<std::string, CacheEntry> entries;
+
+            /// file names, most recently used first.
+            std::list<std::string> lru;
+
+            /// protection mutex for the shard.
+            Mutex mutex;
+        };
+
+        /**
+         * @brief watched directory.
+         */
+        struct Watch
+        {
+            /// directory path.
+            std::string directory;
+
+            /// cache keys by file name.
+            std::unordered_multimap<std::string, std::string> files;
+        };
+
+        /**
+         * @brief method called when inotify events are pending.
+         * @param fd file descriptor.
+         */
+        virtual void onReadable (int fd) override;
+
+        /**
+         * @brief watch the directory of the given file.
+         * @param fileName file name.
+         * @return true if the directory is watched.
+         */
+        bool watch (const std::string& fileName);
+
+        /**
+         * @brief stop watching the given file, the directory is no longer watched once it has no file left.
+         * @param fileName file name.
+         */
+        void unwatch (const std::string& fileName);
+
+        /**
+         * @brief drop the cache entries of a watched directory.
+         * @param wd watch descriptor.
+         * @param name changed file name or empty for the whole directory.
+         */
+        void invalidate (int wd, const std::string& name);
+
+        /**
+         * @brief get the shard of the given file.
+         * @param fileName file name.
+         * @return shard.
+         */
+        Shard& shard (const std::string& fileName) noexcept;
+
+        /**
+         * @brief remove an entry, shard lock must be held.
+         * @param shard shard.
+         * @param it entry to remove.
+         * @param forget stop watching the file of the entry.
+         */
+        void erase (Shard& shard, std::unordered_map<std::string, CacheEntry>::iterator it, bool forget = true);
+
+        /**
+         * @brief check if the budget or the capacity is exceeded.
+         * @return true if exceeded.
+         */
+        bool exceeded () const noexcept;
+
+        /**
+         * @brief evict the least recently used entries of a shard until the limits are honored, shard lock must be held.
+         * @param shard shard.
+         * @param keep file name that must not be evicted.
+         */
+        void evict (Shard& shard, const std::string* keep);
+
+        /// shards.
+        std::unique_ptr<Shard[]> _shards;
+
+        /// number of shards.
+        size_t _nshards;
+
+        /// maximum number of mapped bytes.
+        std::atomic<size_t> _budget;
+
+        /// maximum number of entries.
+        std::atomic<size_t> _capacity{0};
+
+        /// number of entries.
+        std::atomic<size_t> _count{0};
+
+        /// revalidation interval in milliseconds.
+        std::atomic<int64_t> _revalidate;
+
+        /// number of mapped bytes.
+        std::atomic<size_t> _bytes{0};
+
+        /// number of hits.
+        std::atomic<uint64_t> _hits{0};
+
+        /// number of misses.
+        std::atomic<uint64_t> _misses{0};
+
+        /// number of evictions.
+        std::atomic<uint64_t> _evictions{0};
+
+        /// reactor dispatching the inotify events.
+        Reactor* _reactor = nullptr;
+
+        /// inotify file descriptor.
+        std::atomic<int> _inotify{-1};
+
+        /// incremented on each inotify event.
+        std::atomic<uint64_t> _epoch{0};
+
+        /// watched directories by watch descriptor.
+        std::unordered_map<int, Watch> _watches;
+
+        /// watch descriptors by directory.
+        std::unordered_map<std::string, int> _directories;
 
-        /// protection mutex for the cache map.
-        Mutex _mutex;
+        /// protection mutex for the watches.
+        Mutex _watchMutex;
     };
 }
 
@@ -37,6 +37,7 @@
 
 // C++.
 #include <chrono>
+#include <deque>
 
 namespace join
 {
@@ -98,7 +99,10 @@ namespace join
         , _keep (other._keep)
         , _keepTimeout (other._keepTimeout)
         , _keepMax (other._keepMax)
+        , _heads (std::move (other._heads))
+        , _bodyEnd (other._bodyEnd)
         {
+            other._heads.clear ();
         }
 
         /**
@@ -114,6 +118,9 @@ namespace join
             this->_keep = other._keep;
             this->_keepTimeout = other._keepTimeout;
             this->_keepMax = other._keepMax;
+            this->_heads = std::move (other._heads);
+            this->_bodyEnd = other._bodyEnd;
+            other._heads.clear ();
             return *this;
         }
 
@@ -134,6 +141,8 @@ namespace join
             Protocol::Stream::close ();
             this->_keepTimeout = std::chrono::seconds::zero ();
             this->_keepMax = -1;
+            this->_heads.clear ();
+            this->_bodyEnd = this->_sockbuf.consumed ();
         }
 
         /**
@@ -233,6 +242,15 @@ namespace join
             return this->_keepMax;
         }
 
+        /**
+         * @brief get number of requests sent and still waiting for their response.
+         * @return number of pending requests.
+         */
+        int pending () const
+        {
+            return static_cast<int> (this->_heads.size ());
+        }
+
         /**
          * @brief send HTTP request.
          * @param request HTTP request to send.
@@ -240,60 +258,19 @@ namespace join
          */
         int send (HttpRequest& request)
         {
-            // restore concrete stream.
-            clearEncoding ();
-
-            // check if reconnection is required.
-            if (this->needReconnection ())
-            {
-                Endpoint endpoint{Dns::Resolver::lookupAddress (this->host ()), this->port ()};
-                endpoint.hostname (this->host ());
-
-                this->reconnect (endpoint);
-                if (this->fail ())
-                {
-                    return -1;
-                }
-            }
-
-            // set missing request headers.
-            if (!request.hasHeader ("Accept"))
-            {
-                request.header ("Accept", "*/*");
-            }
-            if (!request.hasHeader ("Connection"))
-            {
-                request.header ("Connection", this->_keep ? "keep-alive" : "close");
-            }
-            if (!request.hasHeader ("Host"))
-            {
-                request.header ("Host", this->authority ());
-            }
-            if (!request.hasHeader ("User-Agent"))
-            {
-                request.header ("User-Agent", "join/" JOIN_VERSION);
-            }
-
-            // write request headers.
-            if (request.writeHeaders (*this) == -1)
-            {
-                return -1;
-            }
-
-            // flush request headers.
-            this->flush ();
-
-            // set encoding.
-            if (request.hasHeader ("Transfer-Encoding"))
-            {
-                this->setEncoding (join::rsplit (request.header ("Transfer-Encoding"), ","));
-            }
-            if (request.hasHeader ("Content-Encoding"))
-            {
-                this->setEncoding (join::rsplit (request.header ("Content-Encoding"), ","));
-            }
+            return this->writeRequest (request, true);
+        }
 
-            return 0;
+        /**
+         * @brief queue HTTP request without flushing it, several requests can be queued
+         * on a persistent connection before reading their responses in order (pipelining).
+         * queued requests are flushed by the next send or receive.
+         * @param request HTTP request to queue.
+         * @return 0 on success, -1 on failure.
+         */
+        int queue (HttpRequest& request)
+        {
+            return this->writeRequest (request, false);
         }
 
         /**
@@ -306,12 +283,26 @@ namespace join
             // restore concrete stream.
             this->clearEncoding ();
 
+            // send queued requests.
+            if (!this->_heads.empty ())
+            {
+                this->flush ();
+            }
+
             // read response headers.
             if (response.readHeaders (*this) == -1)
             {
                 return -1;
             }
 
+            // the payload of a response to a HEAD request is empty.
+            bool head = false;
+            if (!this->_heads.empty ())
+            {
+                head = this->_heads.front ();
+                this->_heads.pop_front ();
+            }
+
             // get connection.
             std::string connection = response.header ("Connection");
             std::string alive = response.header ("Keep-Alive");
@@ -348,13 +339,111 @@ namespace join
                 this->setEncoding (join::rsplit (response.header ("Content-Encoding"), ","));
             }
 
+            this->_bodyEnd = this->_sockbuf.consumed () + (head ? 0 : response.contentLength ());
+
             // get timestamp.
             this->_timestamp = std::chrono::steady_clock::now ();
 
             return 0;
         }
 
+        /**
+         * @brief check if the payload of the last response was entirely read.
+         * an encoded payload has no known end and is never considered read.
+         * @return true if nothing is left to read, false otherwise.
+         */
+        bool drained ()
+        {
+            return !this->_wrapped && (this->_sockbuf.in_avail () == 0) &&
+                   (this->_sockbuf.consumed () == this->_bodyEnd);
+        }
+
     protected:
+        /**
+         * @brief write HTTP request.
+         * @param request HTTP request to write.
+         * @param flush flush request headers.
+         * @return 0 on success, -1 on failure.
+         */
+        int writeRequest (HttpRequest& request, bool flush)
+        {
+            // restore concrete stream.
+            clearEncoding ();
+
+            // check if reconnection is required.
+            if (this->establish () == -1)
+            {
+                return -1;
+            }
+
+            // set missing request headers.
+            if (!request.hasHeader ("Accept"))
+            {
+                request.header ("Accept", "*/*");
+            }
+            if (!request.hasHeader ("Connection"))
+            {
+                request.header ("Connection", this->_keep ? "keep-alive" : "close");
+            }
+            if (!request.hasHeader ("Host"))
+            {
+                request.header ("Host", this->authority ());
+            }
+            if (!request.hasHeader ("User-Agent"))
+            {
+                request.header ("User-Agent", "join/" JOIN_VERSION);
+            }
+
+            // write request headers.
+            if (request.writeHeaders (*this) == -1)
+            {
+                return -1;
+            }
+
+            this->_heads.push_back (request.method () == HttpMethod::Head);
+
+            // flush request headers.
+            if (flush)
+            {
+                this->flush ();
+            }
+
+            // set encoding.
+            if (request.hasHeader ("Transfer-Encoding"))
+            {
+                this->setEncoding (join::rsplit (request.header ("Transfer-Encoding"), ","));
+            }
+            if (request.hasHeader ("Content-Encoding"))
+            {
+                this->setEncoding (join::rsplit (request.header ("Content-Encoding"), ","));
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief connect to the host unless the current connection can be reused.
+         * @return 0 on success, -1 on failure.
+         */
+        int establish ()
+        {
+            if (this->needReconnection ())
+            {
+                Endpoint endpoint{Dns::Resolver::lookupAddress (this->host ()), this->port ()};
+                endpoint.hostname (this->host ());
+
+                this->reconnect (endpoint);
+                if (this->fail ())
+                {
+                    return -1;
+                }
+
+                this->_timestamp = std::chrono::steady_clock::now ();
+            }
+
+            return 0;
+        }
+
         /**
          * @brief set stream encoding.
          * @param encodings encodings applied to the stream.
@@ -417,7 +506,8 @@ namespace join
          */
         bool needReconnection ()
         {
-            return !this->connected () || this->expired ();
+            // keep the connection while pipelined responses are in flight.
+            return !this->connected () || (this->_heads.empty () && this->expired ());
         }
 
         /**
@@ -454,6 +544,15 @@ namespace join
 
         /// HTTP keep alive max.
         int _keepMax = -1;
+
+        /// requests waiting for their response, in order, flagged when sent with the HEAD method.
+        std::deque<bool> _heads;
+
+        /// input position at the end of the last response payload.
+        std::streamoff _bodyEnd = 0;
+
+        /// friendship with client pool.
+        friend class BasicHttpClientPool<Protocol>;
     };
 
     /**
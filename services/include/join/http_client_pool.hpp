@@ -0,0 +1,598 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef JOIN_SERVICES_HTTP_CLIENT_POOL_HPP
+#define JOIN_SERVICES_HTTP_CLIENT_POOL_HPP
+
+// libjoin.
+#include <join/http_client.hpp>
+#include <join/condition.hpp>
+#include <join/mutex.hpp>
+
+// C++.
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+
+namespace join
+{
+    /**
+     * @brief thread safe pool of persistent HTTP client connections, keyed by host and port
+     * (the scheme is given by the protocol).
+     */
+    template <class Protocol>
+    class BasicHttpClientPool
+    {
+    public:
+        using Client = typename Protocol::Client;
+        using ClientPtr = std::unique_ptr<Client>;
+        using Factory = std::function<ClientPtr (const std::string& host, uint16_t port)>;
+
+        /**
+         * @brief client connection leased from the pool, given back to the pool when released.
+         */
+        class Lease
+        {
+        public:
+            /**
+             * @brief create an empty lease.
+             */
+            Lease () = default;
+
+            /**
+             * @brief create instance by copy.
+             * @param other object to copy.
+             */
+            Lease (const Lease& other) = delete;
+
+            /**
+             * @brief assign instance by copy.
+             * @param other object to copy.
+             * @return a reference of the current object.
+             */
+            Lease& operator= (const Lease& other) = delete;
+
+            /**
+             * @brief create instance by move.
+             * @param other object to move.
+             */
+            Lease (Lease&& other) noexcept
+            : _pool (other._pool)
+            , _key (std::move (other._key))
+            , _client (std::move (other._client))
+            {
+                other._pool = nullptr;
+            }
+
+            /**
+             * @brief assign instance by move.
+             * @param other object to move.
+             * @return a reference of the current object.
+             */
+            Lease& operator= (Lease&& other) noexcept
+            {
+                this->release ();
+
+                this->_pool = other._pool;
+                this->_key = std::move (other._key);
+                this->_client = std::move (other._client);
+
+                other._pool = nullptr;
+
+                return *this;
+            }
+
+            /**
+             * @brief give the connection back to the pool.
+             */
+            ~Lease ()
+            {
+                this->release ();
+            }
+
+            /**
+             * @brief give the connection back to the pool.
+             * the response payload must have been entirely read, otherwise the connection is not reused.
+             */
+            void release ()
+            {
+                if (this->_client)
+                {
+                    this->_pool->restore (this->_key, std::move (this->_client));
+                }
+                this->_pool = nullptr;
+            }
+
+            /**
+             * @brief check if the lease holds a connection.
+             * @return true if the lease holds a connection, false otherwise.
+             */
+            explicit operator bool () const noexcept
+            {
+                return this->_client != nullptr;
+            }
+
+            /**
+             * @brief get the leased client.
+             * @return leased client.
+             */
+            Client* operator->() const noexcept
+            {
+                return this->_client.get ();
+            }
+
+            /**
+             * @brief get the leased client.
+             * @return leased client.
+             */
+            Client& operator* () const noexcept
+            {
+                return *this->_client;
+            }
+
+        private:
+            /**
+             * @brief create a lease.
+             * @param pool owning pool.
+             * @param key connection key.
+             * @param client leased client.
+             */
+            Lease (BasicHttpClientPool* pool, const std::string& key, ClientPtr client)
+            : _pool (pool)
+            , _key (key)
+            , _client (std::move (client))
+            {
+            }
+
+            /// owning pool.
+            BasicHttpClientPool* _pool = nullptr;
+
+            /// connection key.
+            std::string _key;
+
+            /// leased client.
+            ClientPtr _client;
+
+            /// friendship with pool.
+            friend class BasicHttpClientPool;
+        };
+
+        /**
+         * @brief create the pool.
+         * @param maxPerHost maximum number of connections (leased and idle) per host.
+         */
+        explicit BasicHttpClientPool (size_t maxPerHost = 8)
+        : BasicHttpClientPool (
+              [] (const std::string& host, uint16_t port) {
+                  return ClientPtr (new Client (host, port));
+              },
+              maxPerHost)
+        {
+        }
+
+        /**
+         * @brief create the pool.
+         * @param factory function used to create the client connections.
+         * @param maxPerHost maximum number of connections (leased and idle) per host.
+         */
+        BasicHttpClientPool (Factory factory, size_t maxPerHost = 8)
+        : _factory (std::move (factory))
+        , _maxPerHost (maxPerHost ? maxPerHost : 1)
+        {
+        }
+
+        /**
+         * @brief create instance by copy.
+         * @param other object to copy.
+         */
+        BasicHttpClientPool (const BasicHttpClientPool& other) = delete;
+
+        /**
+         * @brief assign instance by copy.
+         * @param other object to copy.
+         * @return a reference of the current object.
+         */
+        BasicHttpClientPool& operator= (const BasicHttpClientPool& other) = delete;
+
+        /**
+         * @brief create instance by move.
+         * @param other object to move.
+         */
+        BasicHttpClientPool (BasicHttpClientPool&& other) = delete;
+
+        /**
+         * @brief assign instance by move.
+         * @param other object to move.
+         * @return a reference of the current object.
+         */
+        BasicHttpClientPool& operator= (BasicHttpClientPool&& other) = delete;
+
+        /**
+         * @brief destroy the pool, leases must have been released.
+         */
+        ~BasicHttpClientPool ()
+        {
+            this->clear ();
+        }
+
+        /**
+         * @brief lease a connection to the given host, reusing an idle one if any.
+         * new connections are established by the first request sent.
+         * @param host host.
+         * @param port port.
+         * @param timeout time to wait for a connection when the host limit is reached.
+         * @return a lease holding the connection, an empty lease on timeout.
+         */
+        Lease acquire (const std::string& host, uint16_t port = Protocol::defaultPort,
+                       std::chrono::milliseconds timeout = std::chrono::seconds (30))
+        {
+            std::string key = this->key (host, port);
+            std::vector<ClientPtr> discarded;
+            ClientPtr client;
+
+            {
+                ScopedLock<Mutex> lock (this->_mutex);
+                Host& entry = this->_hosts[key];
+
+                auto available = [&] () {
+                    this->purge (entry, discarded);
+                    return !entry.idle.empty () || (entry.leased < this->_maxPerHost);
+                };
+
+                if (!this->_cond.timedWait (lock, timeout, available))
+                {
+                    lastError = make_error_code (Errc::TimedOut);
+                    return {};
+                }
+
+                ++entry.leased;
+
+                if (!entry.idle.empty ())
+                {
+                    client = std::move (entry.idle.back ());
+                    entry.idle.pop_back ();
+                }
+            }
+
+            // a connection closed by the peer while idle is replaced by a new one.
+            if (client && this->alive (*client))
+            {
+                return Lease (this, key, std::move (client));
+            }
+
+            client.reset ();
+
+            try
+            {
+                client = this->_factory (host, port);
+            }
+            catch (...)
+            {
+                // give the reserved slot back.
+                ScopedLock<Mutex> lock (this->_mutex);
+                --this->_hosts[key].leased;
+                this->_cond.signal ();
+                throw;
+            }
+
+            return Lease (this, key, std::move (client));
+        }
+
+        /**
+         * @brief establish connections to the given host ahead of time.
+         * @param host host.
+         * @param port port.
+         * @param count number of idle connections wanted, bounded by the host limit.
+         * @return 0 on success, -1 on failure.
+         */
+        int warm (const std::string& host, uint16_t port = Protocol::defaultPort, size_t count = 1)
+        {
+            std::string key = this->key (host, port);
+            std::vector<ClientPtr> discarded;
+            std::vector<ClientPtr> clients;
+
+            {
+                ScopedLock<Mutex> lock (this->_mutex);
+                Host& entry = this->_hosts[key];
+                this->purge (entry, discarded);
+
+                size_t total = entry.leased + entry.idle.size ();
+                size_t missing = (count > entry.idle.size ()) ? count - entry.idle.size () : 0;
+                missing = std::min (missing, (total >= this->_maxPerHost) ? 0 : this->_maxPerHost - total);
+
+                // reserve the slots while connecting.
+                entry.leased += missing;
+                clients.resize (missing);
+            }
+
+            int result = 0;
+
+            try
+            {
+                for (auto& client : clients)
+                {
+                    client = this->_factory (host, port);
+                    if (client->establish () == -1)
+                    {
+                        client.reset ();
+                        result = -1;
+                    }
+                }
+            }
+            catch (...)
+            {
+                // give the reserved slots back.
+                ScopedLock<Mutex> lock (this->_mutex);
+                this->_hosts[key].leased -= clients.size ();
+                this->_cond.broadcast ();
+                throw;
+            }
+
+            ScopedLock<Mutex> lock (this->_mutex);
+            Host& entry = this->_hosts[key];
+
+            for (auto& client : clients)
+            {
+                --entry.leased;
+                if (client)
+                {
+                    this->settle (*client);
+                    entry.idle.push_back (std::move (client));
+                }
+            }
+
+            this->_cond.broadcast ();
+
+            return result;
+        }
+
+        /**
+         * @brief close the idle connections that expired.
+         * @return number of connections closed.
+         */
+        size_t evict ()
+        {
+            std::vector<ClientPtr> discarded;
+            ScopedLock<Mutex> lock (this->_mutex);
+
+            for (auto& host : this->_hosts)
+            {
+                this->purge (host.second, discarded);
+            }
+
+            return discarded.size ();
+        }
+
+        /**
+         * @brief close all idle connections.
+         */
+        void clear ()
+        {
+            std::vector<ClientPtr> discarded;
+            ScopedLock<Mutex> lock (this->_mutex);
+
+            for (auto& host : this->_hosts)
+            {
+                std::move (host.second.idle.begin (), host.second.idle.end (), std::back_inserter (discarded));
+                host.second.idle.clear ();
+            }
+        }
+
+        /**
+         * @brief get number of idle connections to the given host.
+         * @param host host.
+         * @param port port.
+         * @return number of idle connections.
+         */
+        size_t idle (const std::string& host, uint16_t port = Protocol::defaultPort) const
+        {
+            ScopedLock<Mutex> lock (this->_mutex);
+            auto it = this->_hosts.find (this->key (host, port));
+            return (it != this->_hosts.end ()) ? it->second.idle.size () : 0;
+        }
+
+        /**
+         * @brief get number of leased connections to the given host.
+         * @param host host.
+         * @param port port.
+         * @return number of leased connections.
+         */
+        size_t leased (const std::string& host, uint16_t port = Protocol::defaultPort) const
+        {
+            ScopedLock<Mutex> lock (this->_mutex);
+            auto it = this->_hosts.find (this->key (host, port));
+            return (it != this->_hosts.end ()) ? it->second.leased : 0;
+        }
+
+        /**
+         * @brief get maximum number of connections per host.
+         * @return maximum number of connections per host.
+         */
+        size_t maxPerHost () const
+        {
+            ScopedLock<Mutex> lock (this->_mutex);
+            return this->_maxPerHost;
+        }
+
+        /**
+         * @brief set maximum number of connections per host.
+         * @param max maximum number of connections per host.
+         */
+        void maxPerHost (size_t max)
+        {
+            ScopedLock<Mutex> lock (this->_mutex);
+            this->_maxPerHost = max ? max : 1;
+            this->_cond.broadcast ();
+        }
+
+        /**
+         * @brief get the idle timeout of the connections that got no keep alive timeout from the server.
+         * @return idle timeout.
+         */
+        std::chrono::seconds idleTimeout () const
+        {
+            ScopedLock<Mutex> lock (this->_mutex);
+            return this->_idleTimeout;
+        }
+
+        /**
+         * @brief set the idle timeout of the connections that got no keep alive timeout from the server.
+         * @param timeout idle timeout.
+         */
+        void idleTimeout (std::chrono::seconds timeout)
+        {
+            ScopedLock<Mutex> lock (this->_mutex);
+            this->_idleTimeout = timeout;
+        }
+
+    protected:
+        /**
+         * @brief connections to a host.
+         */
+        struct Host
+        {
+            std::vector<ClientPtr> idle; /**< idle connections, most recently used last. */
+            size_t leased = 0;           /**< number of leased connections. */
+        };
+
+        /**
+         * @brief build the key identifying a host.
+         * @param host host.
+         * @param port port.
+         * @return key.
+         */
+        static std::string key (const std::string& host, uint16_t port)
+        {
+            return host + ":" + std::to_string (port);
+        }
+
+        /**
+         * @brief check if an idle connection was closed or outlived its keep alive timeout.
+         * @param client idle connection.
+         * @return true if expired.
+         */
+        static bool expired (const ClientPtr& client)
+        {
+            return client->needReconnection ();
+        }
+
+        /**
+         * @brief check that the peer didn't close an idle connection, without blocking.
+         * only the end of stream or a hard error make the connection unusable, a TLS connection
+         * first processes the records received meanwhile (TLS 1.3 session tickets for instance).
+         * @param client idle connection (non blocking).
+         * @return true if the connection can be reused, false otherwise.
+         */
+        static bool alive (Client& client)
+        {
+            char byte;
+            if (client.socket ().peek (&byte, 1) == -1)
+            {
+                return lastError == Errc::TemporaryError;
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief give the pool idle timeout to a connection without keep alive timeout (mutex must be locked).
+         * @param client idle connection.
+         */
+        void settle (Client& client) const
+        {
+            if (client._keepTimeout == std::chrono::seconds::zero ())
+            {
+                client._keepTimeout = this->_idleTimeout;
+            }
+        }
+
+        /**
+         * @brief take the idle connections that expired out of the host (mutex must be locked).
+         * they are closed by the caller once the mutex is released.
+         * @param host host connections.
+         * @param discarded connections taken out.
+         */
+        static void purge (Host& host, std::vector<ClientPtr>& discarded)
+        {
+            auto it = std::stable_partition (host.idle.begin (), host.idle.end (), [] (const ClientPtr& client) {
+                return !expired (client);
+            });
+
+            std::move (it, host.idle.end (), std::back_inserter (discarded));
+            host.idle.erase (it, host.idle.end ());
+        }
+
+        /**
+         * @brief give a leased connection back.
+         * @param key connection key.
+         * @param client leased client.
+         */
+        void restore (const std::string& key, ClientPtr client)
+        {
+            // a rejected client is closed once the mutex is released.
+            ClientPtr discarded (std::move (client));
+            ScopedLock<Mutex> lock (this->_mutex);
+            Host& entry = this->_hosts[key];
+
+            --entry.leased;
+
+            // unread payload bytes would be parsed as the next response.
+            if (discarded->good () && (discarded->pending () == 0) && discarded->drained ())
+            {
+                this->settle (*discarded);
+                if (!discarded->needReconnection ())
+                {
+                    entry.idle.push_back (std::move (discarded));
+                }
+            }
+
+            this->_cond.signal ();
+        }
+
+        /// client factory.
+        Factory _factory;
+
+        /// maximum number of connections per host.
+        size_t _maxPerHost;
+
+        /// idle timeout of the connections that got no keep alive timeout from the server.
+        std::chrono::seconds _idleTimeout = std::chrono::seconds (5);
+
+        /// connections by host.
+        std::unordered_map<std::string, Host> _hosts;
+
+        /// protection mutex.
+        mutable Mutex _mutex;
+
+        /// condition signaled when a connection is released.
+        Condition _cond;
+    };
+}
+
+#endif
@@ -0,0 +1,511 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef JOIN_SERVICES_HTTP_PARSER_HPP
+#define JOIN_SERVICES_HTTP_PARSER_HPP
+
+// libjoin.
+#include <join/http_message.hpp>
+
+// C++.
+#include <iostream>
+#include <cstring>
+#include <string>
+#include <memory>
+
+// C.
+#include <strings.h>
+
+namespace join
+{
+    /**
+     * @brief non owning view of characters.
+     */
+    class HttpView
+    {
+    public:
+        /**
+         * @brief create an empty view.
+         */
+        constexpr HttpView () noexcept = default;
+
+        /**
+         * @brief create a view.
+         * @param data first character.
+         * @param size number of characters.
+         */
+        constexpr HttpView (const char* data, size_t size) noexcept
+        : _data (data)
+        , _size (size)
+        {
+        }
+
+        /**
+         * @brief get the first character.
+         * @return first character.
+         */
+        constexpr const char* data () const noexcept
+        {
+            return _data;
+        }
+
+        /**
+         * @brief get number of characters.
+         * @return number of characters.
+         */
+        constexpr size_t size () const noexcept
+        {
+            return _size;
+        }
+
+        /**
+         * @brief check if the view is empty.
+         * @return true if empty.
+         */
+        constexpr bool empty () const noexcept
+        {
+            return _size == 0;
+        }
+
+        /**
+         * @brief copy the viewed characters to a string.
+         * @return string.
+         */
+        std::string str () const
+        {
+            return std::string (_data, _size);
+        }
+
+        /**
+         * @brief compare with the given characters.
+         * @param data characters.
+         * @param size number of characters.
+         * @return true if equal.
+         */
+        bool equals (const char* data, size_t size) const noexcept
+        {
+            return (_size == size) && (std::memcmp (_data, data, size) == 0);
+        }
+
+        /**
+         * @brief compare with the given characters ignoring case (ASCII only).
+         * @param data characters.
+         * @param size number of characters.
+         * @return true if equal.
+         */
+        bool equalsNoCase (const char* data, size_t size) const noexcept
+        {
+            return (_size == size) && (::strncasecmp (_data, data, size) == 0);
+        }
+
+        /**
+         * @brief compare with a null terminated string ignoring case (ASCII only).
+         * @param str null terminated string.
+         * @return true if equal.
+         */
+        bool equalsNoCase (const char* str) const noexcept
+        {
+            return equalsNoCase (str, std::strlen (str));
+        }
+
+        /**
+         * @brief compare with a null terminated string.
+         * @param str null terminated string.
+         * @return true if equal.
+         */
+        bool operator== (const char* str) const noexcept
+        {
+            return equals (str, std::strlen (str));
+        }
+
+        /**
+         * @brief compare with a null terminated string.
+         * @param str null terminated string.
+         * @return true if different.
+         */
+        bool operator!= (const char* str) const noexcept
+        {
+            return !(*this == str);
+        }
+
+    private:
+        /// first character.
+        const char* _data = "";
+
+        /// number of characters.
+        size_t _size = 0;
+    };
+
+    /**
+     * @brief fixed capacity bump allocator reset between requests.
+     */
+    class HttpArena
+    {
+    public:
+        /**
+         * @brief create the arena.
+         * @param capacity arena capacity in bytes.
+         */
+        explicit HttpArena (size_t capacity);
+
+        /**
+         * @brief create instance by copy.
+         * @param other object to copy.
+         */
+        HttpArena (const HttpArena& other) = delete;
+
+        /**
+         * @brief assign instance by copy.
+         * @param other object to copy.
+         * @return a reference of the current object.
+         */
+        HttpArena& operator= (const HttpArena& other) = delete;
+
+        /**
+         * @brief create instance by move.
+         * @param other object to move.
+         */
+        HttpArena (HttpArena&& other) = default;
+
+        /**
+         * @brief assign instance by move.
+         * @param other object to move.
+         * @return a reference of the current object.
+         */
+        HttpArena& operator= (HttpArena&& other) = default;
+
+        /**
+         * @brief destroy the arena.
+         */
+        ~HttpArena () = default;
+
+        /**
+         * @brief allocate characters.
+         * @param size number of characters.
+         * @return allocated characters on success, nullptr if the arena is exhausted.
+         */
+        char* allocate (size_t size) noexcept;
+
+        /**
+         * @brief append a character to the last allocation.
+         * @param c character to append.
+         * @return 0 on success, -1 if the arena is exhausted.
+         */
+        int push (char c) noexcept;
+
+        /**
+         * @brief get the current position.
+         * @return current position.
+         */
+        char* current () const noexcept;
+
+        /**
+         * @brief release all allocations.
+         */
+        void reset () noexcept;
+
+        /**
+         * @brief get number of allocated bytes.
+         * @return number of allocated bytes.
+         */
+        size_t used () const noexcept;
+
+        /**
+         * @brief get arena capacity.
+         * @return arena capacity.
+         */
+        size_t capacity () const noexcept;
+
+    private:
+        /// storage.
+        std::unique_ptr<char[]> _buf;
+
+        /// capacity.
+        size_t _capacity;
+
+        /// number of allocated bytes.
+        size_t _used = 0;
+    };
+
+    /**
+     * @brief HTTP request head parser.
+     * the request head is read straight from the stream buffer into an arena, the request line
+     * and the headers are exposed as views into that arena until the parser is reset.
+     */
+    class HttpRequestParser
+    {
+    public:
+        /**
+         * @brief name / value pair.
+         */
+        struct Field
+        {
+            HttpView name;  /**< field name. */
+            HttpView value; /**< field value. */
+        };
+
+        /// default arena capacity in bytes.
+        static constexpr size_t defaultCapacity = 65536;
+
+        /// default maximum number of headers.
+        static constexpr size_t defaultMaxHeaders = 512;
+
+        /// default maximum number of query parameters, as many as a request line can hold.
+        static constexpr size_t defaultMaxParameters = 1024;
+
+        /**
+         * @brief create the parser.
+         * @param capacity arena capacity in bytes, bounds the request head size.
+         * @param maxHeaders maximum number of headers.
+         * @param maxParameters maximum number of query parameters.
+         */
+        explicit HttpRequestParser (size_t capacity = defaultCapacity, size_t maxHeaders = defaultMaxHeaders,
+                                    size_t maxParameters = defaultMaxParameters);
+
+        /**
+         * @brief create instance by copy.
+         * @param other object to copy.
+         */
+        HttpRequestParser (const HttpRequestParser& other) = delete;
+
+        /**
+         * @brief assign instance by copy.
+         * @param other object to copy.
+         * @return a reference of the current object.
+         */
+        HttpRequestParser& operator= (const HttpRequestParser& other) = delete;
+
+        /**
+         * @brief create instance by move.
+         * @param other object to move.
+         */
+        HttpRequestParser (HttpRequestParser&& other) = default;
+
+        /**
+         * @brief assign instance by move.
+         * @param other object to move.
+         * @return a reference of the current object.
+         */
+        HttpRequestParser& operator= (HttpRequestParser&& other) = default;
+
+        /**
+         * @brief destroy the parser.
+         */
+        ~HttpRequestParser () = default;
+
+        /**
+         * @brief read and parse a request head from the given input stream.
+         * @param in input stream.
+         * @return 0 on success, -1 on failure.
+         */
+        int readHeaders (std::istream& in);
+
+        /**
+         * @brief forget the current request, views are invalidated.
+         */
+        void clear () noexcept;
+
+        /**
+         * @brief get request method.
+         * @return request method.
+         */
+        HttpMethod method () const noexcept;
+
+        /**
+         * @brief get decoded and normalized path (null terminated).
+         * @return path.
+         */
+        HttpView path () const noexcept;
+
+        /**
+         * @brief get HTTP version.
+         * @return HTTP version.
+         */
+        HttpView version () const noexcept;
+
+        /**
+         * @brief checks if there is a header with the specified name.
+         * @param name name of the header to search for.
+         * @return true of there is such a header, false otherwise.
+         */
+        bool hasHeader (const char* name) const noexcept;
+
+        /**
+         * @brief get header by name (last occurrence wins).
+         * @param name header name.
+         * @return header value, empty if not found.
+         */
+        HttpView header (const char* name) const noexcept;
+
+        /**
+         * @brief get number of headers.
+         * @return number of headers.
+         */
+        size_t headerCount () const noexcept;
+
+        /**
+         * @brief get header by index.
+         * @param index header index.
+         * @return header.
+         */
+        const Field& headerAt (size_t index) const noexcept;
+
+        /**
+         * @brief checks if there is a parameter with the specified name.
+         * @param name name of the parameter to search for.
+         * @return true of there is such a parameter, false otherwise.
+         */
+        bool hasParameter (const char* name) const noexcept;
+
+        /**
+         * @brief get decoded parameter by name (last occurrence wins).
+         * @param name parameter name.
+         * @return parameter value, empty if not found.
+         */
+        HttpView parameter (const char* name) const noexcept;
+
+        /**
+         * @brief get number of parameters.
+         * @return number of parameters.
+         */
+        size_t parameterCount () const noexcept;
+
+        /**
+         * @brief get parameter by index.
+         * @param index parameter index.
+         * @return parameter.
+         */
+        const Field& parameterAt (size_t index) const noexcept;
+
+        /**
+         * @brief get host from the Host header.
+         * @return host.
+         */
+        HttpView host () const noexcept;
+
+        /**
+         * @brief get authorization type.
+         * @return authorization type.
+         */
+        HttpView auth () const noexcept;
+
+        /**
+         * @brief get authorization credentials.
+         * @return authorization credentials.
+         */
+        HttpView credentials () const noexcept;
+
+        /**
+         * @brief get content length.
+         * @return content length.
+         */
+        size_t contentLength () const noexcept;
+
+    private:
+        /**
+         * @brief parse the request line.
+         * @param line request line (null terminated).
+         * @param len line length.
+         * @return 0 on success, -1 on failure.
+         */
+        int parseFirstLine (char* line, size_t len) noexcept;
+
+        /**
+         * @brief parse a header line.
+         * @param line header line.
+         * @param len line length.
+         * @return 0 on success, -1 on failure.
+         */
+        int parseHeader (char* line, size_t len) noexcept;
+
+        /**
+         * @brief parse the query string.
+         * @param query query string.
+         * @param len query length.
+         * @return 0 on success, -1 on failure.
+         */
+        int parseQuery (const char* query, size_t len) noexcept;
+
+        /**
+         * @brief percent decode characters into the arena.
+         * @param data characters to decode.
+         * @param len number of characters.
+         * @return decoded characters (null terminated), empty view with null data on failure.
+         */
+        HttpView decode (const char* data, size_t len) noexcept;
+
+        /**
+         * @brief remove dot segments and duplicate slashes (rfc3986 section 5.2.4).
+         * @param data path to normalize (modified).
+         * @param len path length.
+         * @return normalized path (null terminated), empty view with null data on failure.
+         */
+        HttpView normalize (char* data, size_t len) noexcept;
+
+        /**
+         * @brief find a field by name.
+         * @param fields fields.
+         * @param count number of fields.
+         * @param name name.
+         * @param nocase ignore case.
+         * @return field or nullptr.
+         */
+        static const Field* find (const Field* fields, size_t count, const char* name, bool nocase) noexcept;
+
+        /// HTTP max header line size.
+        static const std::streamsize _maxHeaderLen = 2048;
+
+        /// arena.
+        HttpArena _arena;
+
+        /// headers.
+        std::unique_ptr<Field[]> _headers;
+
+        /// maximum number of headers.
+        size_t _maxHeaders;
+
+        /// number of headers.
+        size_t _nheaders = 0;
+
+        /// parameters.
+        std::unique_ptr<Field[]> _parameters;
+
+        /// maximum number of parameters.
+        size_t _maxParameters;
+
+        /// number of parameters.
+        size_t _nparameters = 0;
+
+        /// request method.
+        HttpMethod _method = HttpMethod::Get;
+
+        /// request path.
+        HttpView _path{"/", 1};
+
+        /// HTTP version.
+        HttpView _version{"HTTP/1.1", 8};
+    };
+}
+
+#endif
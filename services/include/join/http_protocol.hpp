@@ -36,6 +36,9 @@ namespace join
     template <class Protocol>
     class BasicHttpSecureClient;
 
+    template <class Protocol>
+    class BasicHttpClientPool;
+
     template <class Protocol>
     class BasicHttpWorker;
 
@@ -56,6 +59,7 @@ namespace join
         using Stream = BasicSocketStream<Http>;
         using Acceptor = BasicStreamAcceptor<Http>;
         using Client = BasicHttpClient<Http>;
+        using ClientPool = BasicHttpClientPool<Http>;
         using Worker = BasicHttpWorker<Http>;
         using Server = BasicHttpServer<Http>;
 
@@ -157,6 +161,7 @@ namespace join
         using Stream = BasicTlsStream<Https>;
         using Acceptor = typename Transport::Acceptor;
         using Client = BasicHttpSecureClient<Https>;
+        using ClientPool = BasicHttpClientPool<Https>;
         using Worker = BasicHttpWorker<Https>;
         using Server = BasicHttpSecureServer<Https>;
 
@@ -28,23 +28,40 @@
 // libjoin.
 #include <join/http_protocol.hpp>
 #include <join/http_message.hpp>
+#include <join/http_parser.hpp>
 #include <join/chunk_stream.hpp>
+#include <join/thread_pool.hpp>
 #include <join/filesystem.hpp>
 #include <join/tls_stream.hpp>
 #include <join/acceptor.hpp>
 #include <join/version.hpp>
+#include <join/reactor.hpp>
 #include <join/zstream.hpp>
 #include <join/thread.hpp>
 #include <join/cache.hpp>
+#include <join/timer.hpp>
+#include <join/cpu.hpp>
 
 // C++.
 #include <sys/eventfd.h>
+#include <unordered_map>
+#include <chrono>
 #include <thread>
+#include <algorithm>
+#include <climits>
 #include <memory>
+#include <atomic>
 #include <vector>
 
 // C.
+#include <sys/sendfile.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
 #include <fnmatch.h>
+#include <poll.h>
+#include <strings.h>
+#include <cstring>
+#include <cctype>
 
 namespace join
 {
@@ -77,25 +94,402 @@ namespace join
         Access access;         /**< access handler. */
     };
 
+    /**
+     * @brief basic HTTP router.
+     * contents are indexed in a prefix tree over the directory segments, each node keeps
+     * the contents whose directory ends there (exact) and the contents whose directory
+     * pattern has a glob after that literal prefix (prefix + glob). a lookup walks the
+     * requested directory once and returns the first registered content that matches.
+     */
+    template <class Protocol>
+    class BasicHttpRouter
+    {
+    public:
+        using Content = BasicHttpContent<Protocol>;
+
+        /**
+         * @brief create the HTTP router instance.
+         */
+        BasicHttpRouter ()
+        : _root (new Node)
+        {
+        }
+
+        /**
+         * @brief create instance by copy.
+         * @param other object to copy.
+         */
+        BasicHttpRouter (const BasicHttpRouter& other) = delete;
+
+        /**
+         * @brief assign instance by copy.
+         * @param other object to copy.
+         * @return a reference of the current object.
+         */
+        BasicHttpRouter& operator= (const BasicHttpRouter& other) = delete;
+
+        /**
+         * @brief create instance by move.
+         * @param other object to move.
+         */
+        BasicHttpRouter (BasicHttpRouter&& other) = delete;
+
+        /**
+         * @brief assign instance by move.
+         * @param other object to move.
+         * @return a reference of the current object.
+         */
+        BasicHttpRouter& operator= (BasicHttpRouter&& other) = delete;
+
+        /**
+         * @brief destroy the HTTP router.
+         */
+        ~BasicHttpRouter () = default;
+
+        /**
+         * @brief index a content, contents inserted first take precedence.
+         * @param content content to index (methods, directory and name must not change afterwards).
+         */
+        void insert (Content* content)
+        {
+            const std::string& directory = content->directory;
+            size_t literal = directory.find_first_of ("*?[\\");
+            bool exact = (literal == std::string::npos);
+
+            Node* node = this->_root.get ();
+            node->methods |= content->methods;
+
+            size_t pos = 0, end = exact ? directory.size () : literal;
+            while (pos < end)
+            {
+                size_t next = directory.find ('/', pos);
+                next = (next == std::string::npos) ? directory.size () : next + 1;
+                if (!exact && next > end)
+                {
+                    // the glob applies from this node.
+                    break;
+                }
+                node = node->child (directory.data () + pos, next - pos);
+                node->methods |= content->methods;
+                pos = next;
+            }
+
+            Entry entry;
+            entry.order = this->_count++;
+            entry.content = content;
+            entry.literalName = (content->name.find_first_of ("*?[\\") == std::string::npos);
+            (exact ? node->exact : node->globs).push_back (entry);
+        }
+
+        /**
+         * @brief find the first content matching the given method and path.
+         * @param method method.
+         * @param path resource path.
+         * @return a pointer to the content on success, nullptr on failure.
+         */
+        Content* find (HttpMethod method, const std::string& path) const
+        {
+            return this->find (method, path.c_str (), path.size ());
+        }
+
+        /**
+         * @brief find the first content matching the given method and path.
+         * @param method method.
+         * @param path null terminated resource path.
+         * @param size resource path length.
+         * @return a pointer to the content on success, nullptr on failure.
+         */
+        Content* find (HttpMethod method, const char* path, size_t size) const
+        {
+            size_t length = size;
+            while ((length > 0) && (path[length - 1] != '/'))
+            {
+                --length;
+            }
+
+            Match match;
+            match.method = method;
+            match.data = path;
+            match.length = length;
+            match.name = path + length;
+            match.dir = nullptr;
+            match.content = nullptr;
+            match.order = SIZE_MAX;
+
+            const Node* node = this->_root.get ();
+
+            size_t pos = 0;
+            while ((node != nullptr) && (node->methods & method))
+            {
+                this->lookup (node->globs, match, false);
+
+                if (pos == length)
+                {
+                    this->lookup (node->exact, match, true);
+                    break;
+                }
+
+                size_t next = pos;
+                while ((next < length) && (path[next++] != '/'))
+                {
+                }
+                node = node->find (path + pos, next - pos);
+                pos = next;
+            }
+
+            return match.content;
+        }
+
+        /**
+         * @brief remove all indexed contents.
+         */
+        void clear ()
+        {
+            this->_root.reset (new Node);
+            this->_count = 0;
+        }
+
+    protected:
+        /**
+         * @brief indexed content.
+         */
+        struct Entry
+        {
+            size_t order;     /**< registration order. */
+            Content* content; /**< content. */
+            bool literalName; /**< name has no glob. */
+        };
+
+        /**
+         * @brief lookup state.
+         */
+        struct Match
+        {
+            HttpMethod method;  /**< requested method. */
+            const char* data;   /**< requested directory (not null terminated). */
+            size_t length;      /**< requested directory length. */
+            const char* name;   /**< requested file name. */
+            const char* dir;    /**< null terminated requested directory (lazily built). */
+            Content* content;   /**< best match so far. */
+            size_t order;       /**< registration order of the best match. */
+            char buf[2048];     /**< storage for the null terminated directory. */
+            std::string longer; /**< storage for the null terminated directory when longer than buf. */
+        };
+
+        /**
+         * @brief prefix tree node.
+         */
+        struct Node
+        {
+            /**
+             * @brief get or create the child for the given segment.
+             * @param data segment.
+             * @param len segment length.
+             * @return child node.
+             */
+            Node* child (const char* data, size_t len)
+            {
+                auto it = this->lowerBound (data, len);
+                if ((it == this->children.end ()) || (compare ((*it)->segment, data, len) != 0))
+                {
+                    std::unique_ptr<Node> node (new Node);
+                    node->segment.reserve (len);
+                    for (size_t i = 0; i < len; ++i)
+                    {
+                        node->segment.push_back (std::tolower (static_cast<unsigned char> (data[i])));
+                    }
+                    it = this->children.insert (it, std::move (node));
+                }
+                return it->get ();
+            }
+
+            /**
+             * @brief find the child for the given segment.
+             * @param data segment.
+             * @param len segment length.
+             * @return child node if found, nullptr otherwise.
+             */
+            const Node* find (const char* data, size_t len) const
+            {
+                auto it = const_cast<Node*> (this)->lowerBound (data, len);
+                if ((it == this->children.end ()) || (compare ((*it)->segment, data, len) != 0))
+                {
+                    return nullptr;
+                }
+                return it->get ();
+            }
+
+            /**
+             * @brief find the first child not ordered before the given segment.
+             * @param data segment.
+             * @param len segment length.
+             * @return child iterator.
+             */
+            typename std::vector<std::unique_ptr<Node>>::iterator lowerBound (const char* data, size_t len)
+            {
+                return std::lower_bound (this->children.begin (), this->children.end (), nullptr,
+                                         [&] (const std::unique_ptr<Node>& node, std::nullptr_t) {
+                                             return compare (node->segment, data, len) < 0;
+                                         });
+            }
+
+            /**
+             * @brief case insensitive comparison of a lower case key with a segment.
+             * @param key lower case key.
+             * @param data segment.
+             * @param len segment length.
+             * @return an integer less than, equal to, or greater than zero.
+             */
+            static int compare (const std::string& key, const char* data, size_t len)
+            {
+                size_t n = std::min (key.size (), len);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    int diff = static_cast<unsigned char> (key[i]) -
+                               std::tolower (static_cast<unsigned char> (data[i]));
+                    if (diff != 0)
+                    {
+                        return diff;
+                    }
+                }
+                return (key.size () < len) ? -1 : (key.size () > len);
+            }
+
+            /// lower case directory segment including the trailing slash.
+            std::string segment;
+
+            /// methods allowed by the contents of the subtree.
+            HttpMethod methods = HttpMethod (0);
+
+            /// contents whose directory ends at this node.
+            std::vector<Entry> exact;
+
+            /// contents whose directory glob starts at this node.
+            std::vector<Entry> globs;
+
+            /// children sorted by segment.
+            std::vector<std::unique_ptr<Node>> children;
+        };
+
+        /**
+         * @brief look for a better match among the given entries.
+         * @param entries entries sorted by registration order.
+         * @param match lookup state.
+         * @param exact directory is already matched.
+         */
+        void lookup (const std::vector<Entry>& entries, Match& match, bool exact) const
+        {
+            for (auto const& entry : entries)
+            {
+                if (entry.order >= match.order)
+                {
+                    return;
+                }
+
+                Content* content = entry.content;
+                if (!(content->methods & match.method))
+                {
+                    continue;
+                }
+
+                if (!exact && (fnmatch (content->directory.c_str (), this->directory (match), FNM_CASEFOLD) != 0))
+                {
+                    continue;
+                }
+
+                if (entry.literalName ? (::strcasecmp (content->name.c_str (), match.name) != 0)
+                                      : (fnmatch (content->name.c_str (), match.name, FNM_CASEFOLD) != 0))
+                {
+                    continue;
+                }
+
+                match.content = content;
+                match.order = entry.order;
+                return;
+            }
+        }
+
+        /**
+         * @brief get the null terminated requested directory.
+         * @param match lookup state.
+         * @return null terminated requested directory.
+         */
+        const char* directory (Match& match) const
+        {
+            if (match.dir == nullptr)
+            {
+                if (match.length < sizeof (match.buf))
+                {
+                    std::memcpy (match.buf, match.data, match.length);
+                    match.buf[match.length] = '\0';
+                    match.dir = match.buf;
+                }
+                else
+                {
+                    match.longer.assign (match.data, match.length);  // LCOV_EXCL_LINE
+                    match.dir = match.longer.c_str ();               // LCOV_EXCL_LINE
+                }
+            }
+            return match.dir;
+        }
+
+        /// prefix tree root (empty directory).
+        std::unique_ptr<Node> _root;
+
+        /// number of indexed contents.
+        size_t _count = 0;
+    };
+
     /**
      * @brief basic HTTP worker.
      */
     template <class Protocol>
-    class BasicHttpWorker : public Protocol::Stream
+    class BasicHttpWorker : public Protocol::Stream, protected EventHandler
     {
     public:
         using Content = BasicHttpContent<Protocol>;
         using Server = BasicHttpServer<Protocol>;
+        using Socket = typename Protocol::Socket;
+        using Acceptor = typename Protocol::Acceptor;
 
         /**
          * @brief create the worker instance.
          * @param server Server instance.
          */
         BasicHttpWorker (Server* server)
+        : _request (server->createParser ())
+        , _server (server)
+        {
+            this->_thread = std::make_unique<Thread> ([this] () {
+                work ();
+            });
+        }
+
+        /**
+         * @brief create a worker instance owning its acceptor.
+         * @param server Server instance.
+         * @param acceptor acceptor bound with port reuse.
+         * @param core core the worker thread is pinned to (-1 no pinning).
+         */
+        BasicHttpWorker (Server* server, Acceptor&& acceptor, int core)
+        : _request (server->createParser ())
+        , _server (server)
+        , _acceptor (std::make_unique<Acceptor> (std::move (acceptor)))
+        {
+            this->_thread = std::make_unique<Thread> (core, 0, [this] () {
+                work ();
+            });
+        }
+
+        /**
+         * @brief create an event-driven worker instance serving a single connection.
+         * the request parser and the stream buffers are taken from the server only while a request is in progress.
+         * @param server Server instance.
+         * @param reactor reactor used to wait for incoming requests.
+         */
+        BasicHttpWorker (Server* server, Reactor* reactor)
         : _server (server)
-        , _thread ([this] () {
-            work ();
-        })
+        , _reactor (reactor)
         {
         }
 
@@ -130,7 +524,10 @@ namespace join
          */
         virtual ~BasicHttpWorker ()
         {
-            this->_thread.join ();
+            if (this->_thread)
+            {
+                this->_thread->join ();
+            }
         }
 
         /**
@@ -155,7 +552,8 @@ namespace join
             }
             if (!this->_response.hasHeader ("Connection"))
             {
-                if (this->_max && compareNoCase (this->_request.header ("Connection"), "keep-alive"))
+                if (this->_max && this->_request->header ("Connection").equalsNoCase ("keep-alive") &&
+                    !this->backlogged ())
                 {
                     std::stringstream keepAlive;
                     keepAlive << "timeout=" << this->_server->keepAliveTimeout ().count ()
@@ -272,8 +670,8 @@ namespace join
                 this->write (payload.c_str (), payload.size ());
             }
 
-            // flush data.
-            this->flush ();
+            // flush data unless coalesced with pipelined responses.
+            this->flushResponse ();
         }
 
         /**
@@ -284,9 +682,9 @@ namespace join
         {
             struct stat sbuf;
 
-            // get file.
-            void* addr = this->_server->_cache.get (path, sbuf);
-            if (addr == nullptr || S_ISDIR (sbuf.st_mode))
+            // get file, kept mapped until sent.
+            Cache::FilePtr file = this->_server->_cache.acquire (path, sbuf);
+            if (file == nullptr || S_ISDIR (sbuf.st_mode))
             {
                 this->sendError ("404", "Not Found");
                 return;
@@ -295,7 +693,7 @@ namespace join
             // check modif time.
             std::stringstream modifTime;
             modifTime << std::put_time (std::gmtime (&sbuf.st_ctime), "%a, %d %b %Y %H:%M:%S GMT");
-            if (compareNoCase (this->_request.header ("If-Modified-Since"), modifTime.str ()))
+            if (this->_request->header ("If-Modified-Since").equalsNoCase (modifTime.str ().c_str ()))
             {
                 this->sendRedirect ("304", "Not Modified");
                 return;
@@ -313,14 +711,17 @@ namespace join
             this->sendHeaders ();
 
             // check method.
-            if (this->_request.method () == HttpMethod::Get)
+            if (this->_request->method () == HttpMethod::Get)
             {
                 // send file.
-                this->write (static_cast<char*> (addr), sbuf.st_size);
+                if (this->sendFileZeroCopy (*file) == -1)
+                {
+                    this->write (static_cast<char*> (file->addr), file->size);
+                }
             }
 
-            // flush data.
-            this->flush ();
+            // flush data unless coalesced with pipelined responses.
+            this->flushResponse ();
         }
 
         /**
@@ -330,7 +731,7 @@ namespace join
          */
         bool hasHeader (const std::string& name) const
         {
-            return this->_request.hasHeader (name);
+            return this->_request->hasHeader (name.c_str ());
         }
 
         /**
@@ -340,7 +741,7 @@ namespace join
          */
         std::string header (const std::string& name) const
         {
-            return this->_request.header (name);
+            return this->_request->header (name.c_str ()).str ();
         }
 
         /**
@@ -349,7 +750,16 @@ namespace join
          */
         size_t contentLength () const
         {
-            return this->_request.contentLength ();
+            return this->_request->contentLength ();
+        }
+
+        /**
+         * @brief get the parsed HTTP request, valid until the next request is read.
+         * @return parsed HTTP request.
+         */
+        const HttpRequestParser& request () const noexcept
+        {
+            return *this->_request;
         }
 
         /**
@@ -364,45 +774,296 @@ namespace join
 
     protected:
         /**
-         * @brief worker thread routine.
+         * @brief send a file from the page cache to a plain socket with sendfile.
+         * headers are flushed first, small files, encrypted or encoded streams use the stream.
+         * @param file cached file.
+         * @return 0 if the file was handled, -1 if it must be written to the stream.
+         */
+        int sendFileZeroCopy (const Cache::File& file)
+        {
+            if (!std::is_same<Socket, BasicStreamSocket<Protocol>>::value || (file.size < _zeroCopyThreshold) ||
+                (this->rdbuf () != &this->_sockbuf))
+            {
+                return -1;
+            }
+
+            this->flush ();
+
+            Socket& socket = this->_sockbuf.socket ();
+            off_t offset = 0;
+
+            while (socket.connected () && (offset < file.size))
+            {
+                ssize_t nwrite = ::sendfile (socket.handle (), file.fd, &offset, file.size - offset);
+                if (nwrite > 0)
+                {
+                    continue;
+                }
+
+                if ((nwrite == -1) && (errno == EAGAIN) && socket.waitReadyWrite (this->_sockbuf.timeout ()))
+                {
+                    continue;
+                }
+
+                // LCOV_EXCL_START
+                lastError = (nwrite == -1) ? std::error_code (errno, std::generic_category ())
+                                           : make_error_code (Errc::OperationFailed);
+                socket.close ();
+                this->setstate (std::ios_base::failbit);
+                // LCOV_EXCL_STOP
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief flush the response, unless another request is already buffered in which case
+         * the response is left in the output buffer and sent along with the next ones.
+         */
+        void flushResponse ()
+        {
+            if (this->_wrapped || !this->requestBuffered ())
+            {
+                this->flush ();
+            }
+        }
+
+        /**
+         * @brief check if connections are waiting on the worker own acceptor (sharded mode).
+         * @return true if the kernel queued connections only this worker can accept.
+         */
+        bool backlogged () const noexcept
+        {
+            if (this->_acceptor == nullptr)
+            {
+                return false;
+            }
+
+            struct pollfd pfd = {this->_acceptor->handle (), POLLIN, 0};
+            return ::poll (&pfd, 1, 0) > 0;
+        }
+
+        /**
+         * @brief worker thread routine.
+         */
+        void work ()
+        {
+            // a worker owning its acceptor doesn't need to serialize accepts.
+            bool sharded = (this->_acceptor != nullptr);
+            const Acceptor& acceptor = sharded ? *this->_acceptor : this->_server->_acceptor;
+
+            fd_set setfd;
+            FD_ZERO (&setfd);
+            int fdmax = -1;
+
+            FD_SET (this->_server->_event, &setfd);
+            fdmax = std::max (fdmax, this->_server->_event);
+            FD_SET (acceptor.handle (), &setfd);
+            fdmax = std::max (fdmax, acceptor.handle ());
+
+            for (;;)
+            {
+                if (sharded)
+                {
+                    if (this->waitConnection (acceptor, setfd, fdmax) == -1)
+                    {
+                        return;
+                    }
+                }
+                else
+                {
+                    ScopedLock<Mutex> lock (this->_server->_mutex);
+
+                    if (this->waitConnection (acceptor, setfd, fdmax) == -1)
+                    {
+                        return;
+                    }
+                }
+
+                this->processRequest ();
+            }
+        }
+
+        /**
+         * @brief wait for an incoming connection and accept it.
+         * @param acceptor acceptor to wait on.
+         * @param setfd file descriptors to wait on.
+         * @param fdmax highest file descriptor to wait on.
+         * @return 0 on success, -1 if the server is stopping.
+         */
+        int waitConnection (const Acceptor& acceptor, const fd_set& setfd, int fdmax)
+        {
+            fd_set fdset = setfd;
+            int nset = ::select (fdmax + 1, &fdset, nullptr, nullptr, nullptr);
+            if (nset > 0)
+            {
+                if (FD_ISSET (this->_server->_event, &fdset))
+                {
+                    uint64_t val = 0;
+                    [[maybe_unused]] ssize_t bytes = ::read (this->_server->_event, &val, sizeof (uint64_t));
+                    return -1;
+                }
+
+                if (FD_ISSET (acceptor.handle (), &fdset))
+                {
+                    this->_sockbuf.socket () = this->_server->accept (acceptor);
+                    this->_sockbuf.timeout (this->_server->keepAliveTimeout ().count () * 1000);
+                    // the worker is reused, forget the state of the previous connection.
+                    this->clear ();
+                }
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief attach an accepted connection and wait for its requests (event-driven mode).
+         * @param socket accepted socket.
+         * @return 0 on success, -1 on failure.
+         */
+        int attach (Socket&& socket)
+        {
+            this->_sockbuf.socket () = std::move (socket);
+            this->_sockbuf.timeout (this->_server->keepAliveTimeout ().count () * 1000);
+            this->_max = this->_server->keepAliveMax ();
+            this->_lastActivity = std::chrono::steady_clock::now ();
+
+            return this->_reactor->addHandler (this->_sockbuf.socket ().handle (), this);
+        }
+
+        /**
+         * @brief method called when data are ready to be read on the connection (event-driven mode).
+         * @param fd file descriptor.
+         */
+        virtual void onReadable (int fd) override
+        {
+            if (!this->_sockbuf.hasBuffer ())
+            {
+                this->_sockbuf.attachBuffer (this->_server->acquireBuffer ());
+            }
+
+            std::streamsize nread = this->_sockbuf.prefetch ();
+            if (nread == -1)
+            {
+                if (join::lastError != Errc::TemporaryError)
+                {
+                    this->onClose (fd);
+                }
+                return;
+            }
+
+            this->_lastActivity = std::chrono::steady_clock::now ();
+
+            // wait for the whole request header block unless the buffer is already full.
+            if ((nread == 0) || this->requestReady ())
+            {
+                this->_reactor->delHandler (fd);
+                this->_busy.store (true, std::memory_order_release);
+                this->_server->dispatch (this);
+            }
+        }
+
+        /**
+         * @brief method called when the connection is closed by the peer (event-driven mode).
+         * @param fd file descriptor.
+         */
+        virtual void onClose (int fd) override
+        {
+            this->_reactor->delHandler (fd);
+            this->_server->release (this);
+        }
+
+        /**
+         * @brief method called when an error occurred on the connection (event-driven mode).
+         * @param fd file descriptor.
+         */
+        virtual void onError (int fd) override
+        {
+            this->onClose (fd);
+        }
+
+        /**
+         * @brief serve the buffered requests then wait for the next ones (event-driven mode).
+         */
+        void serve ()
+        {
+            if (this->_request == nullptr)
+            {
+                this->_request = this->_server->acquireParser ();
+            }
+
+            for (;;)
+            {
+                int res = this->readRequest ();
+                if (res == 0)
+                {
+                    this->writeResponse ();
+                }
+                this->cleanUp ();
+
+                if ((res == -1) || (this->_max == 0) || ((this->_max > 0) && (--this->_max == 0)) ||
+                    !this->_sockbuf.socket ().connected ())
+                {
+                    this->endRequest ();
+                    this->_server->release (this);
+                    return;
+                }
+
+                // serve pipelined requests without going back to the reactor.
+                if (!this->requestBuffered () && ((this->_sockbuf.prefetch () < 1) || !this->requestReady ()))
+                {
+                    break;
+                }
+            }
+
+            // send responses left in the output buffer.
+            this->flush ();
+
+            // give the parser and the stream buffers back while the connection is idle.
+            this->_server->recycle (this);
+
+            this->_lastActivity = std::chrono::steady_clock::now ();
+            this->_server->park (this);
+        }
+
+        /**
+         * @brief check if a complete request header block is buffered, resuming the previous scan.
+         * @return true if a complete request header block is buffered, false otherwise.
          */
-        void work ()
+        bool requestReady () noexcept
         {
-            fd_set setfd;
-            FD_ZERO (&setfd);
-            int fdmax = -1;
-
-            FD_SET (this->_server->_event, &setfd);
-            fdmax = std::max (fdmax, this->_server->_event);
-            FD_SET (this->_server->_acceptor.handle (), &setfd);
-            fdmax = std::max (fdmax, this->_server->_acceptor.handle ());
+            const char* data = this->_sockbuf.pending ();
+            std::streamsize avail = this->_sockbuf.in_avail ();
 
-            for (;;)
+            while (this->_scanned < avail)
             {
+                char c = data[this->_scanned++];
+                if (c == '\n')
                 {
-                    ScopedLock<Mutex> lock (this->_server->_mutex);
-
-                    fd_set fdset = setfd;
-                    int nset = ::select (fdmax + 1, &fdset, nullptr, nullptr, nullptr);
-                    if (nset > 0)
+                    if (this->_lineStart)
                     {
-                        if (FD_ISSET (this->_server->_event, &fdset))
-                        {
-                            uint64_t val = 0;
-                            [[maybe_unused]] ssize_t bytes = ::read (this->_server->_event, &val, sizeof (uint64_t));
-                            return;
-                        }
-
-                        if (FD_ISSET (this->_server->_acceptor.handle (), &fdset))
-                        {
-                            this->_sockbuf.socket () = this->_server->accept ();
-                            this->_sockbuf.timeout (this->_server->keepAliveTimeout ().count () * 1000);
-                        }
+                        return true;
                     }
+                    this->_lineStart = true;
+                }
+                else if (c != '\r')
+                {
+                    this->_lineStart = false;
                 }
-
-                this->processRequest ();
             }
+
+            return false;
+        }
+
+        /**
+         * @brief check if a complete request header block is buffered, scanning from the read position.
+         * @return true if a complete request header block is buffered, false otherwise.
+         */
+        bool requestBuffered () noexcept
+        {
+            this->_scanned = 0;
+            this->_lineStart = false;
+            return this->requestReady ();
         }
 
         /**
@@ -423,7 +1084,7 @@ namespace join
                 this->writeResponse ();
                 this->cleanUp ();
             }
-            while ((this->_max < 0) || (--this->_max != 0));
+            while ((this->_max != 0) && ((this->_max < 0) || (--this->_max != 0)));
 
             this->endRequest ();
         }
@@ -440,8 +1101,14 @@ namespace join
             // prepare a standard response.
             this->_response.response ("200", "OK");
 
+            // send coalesced responses before waiting for more requests.
+            if (!this->requestBuffered ())
+            {
+                this->flush ();
+            }
+
             // read request headers.
-            if (this->_request.readHeaders (*this) == -1)
+            if (this->_request->readHeaders (*this) == -1)
             {
                 if (join::lastError == HttpErrc::BadRequest)
                 {
@@ -451,6 +1118,10 @@ namespace join
                 {
                     this->sendError ("405", "Method Not Allowed");
                 }
+                else if (join::lastError == HttpErrc::UriTooLong)
+                {
+                    this->sendError ("414", "URI Too Long");
+                }
                 else if (join::lastError == HttpErrc::HeaderTooLarge)
                 {
                     this->sendError ("494", "Request Header Too Large");
@@ -459,20 +1130,20 @@ namespace join
             }
 
             // check host.
-            if (this->_request.host ().empty ())
+            if (this->_request->host ().empty ())
             {
                 this->sendError ("400", "Bad Request");
                 return -1;
             }
 
             // set encoding.
-            if (this->_request.hasHeader ("Transfer-Encoding"))
+            if (this->_request->hasHeader ("Transfer-Encoding"))
             {
-                this->setEncoding (join::rsplit (this->_request.header ("Transfer-Encoding"), ","));
+                this->setEncoding (join::rsplit (this->_request->header ("Transfer-Encoding").str (), ","));
             }
-            if (this->_request.hasHeader ("Content-Encoding"))
+            if (this->_request->hasHeader ("Content-Encoding"))
             {
-                this->setEncoding (join::rsplit (this->_request.header ("Content-Encoding"), ","));
+                this->setEncoding (join::rsplit (this->_request->header ("Content-Encoding").str (), ","));
             }
 
             return 0;
@@ -483,7 +1154,9 @@ namespace join
          */
         void writeResponse ()
         {
-            Content* content = this->_server->findContent (this->_request.method (), this->_request.path ());
+            Content* content =
+                this->_server->findContent (this->_request->method (), this->_request->path ().data (),
+                                            this->_request->path ().size ());
             if (content == nullptr)
             {
                 this->sendError ("404", "Not Found");
@@ -492,14 +1165,14 @@ namespace join
 
             if (content->access != nullptr)
             {
-                if (!this->_request.hasHeader ("Authorization"))
+                if (!this->_request->hasHeader ("Authorization"))
                 {
                     this->sendError ("401", "Unauthorized");
                     return;
                 }
 
                 std::error_code err;
-                if (!content->access (this->_request.auth (), this->_request.credentials (), err))
+                if (!content->access (this->_request->auth ().str (), this->_request->credentials ().str (), err))
                 {
                     if (err == HttpErrc::Unauthorized)
                     {
@@ -518,16 +1191,18 @@ namespace join
             {
                 join::replaceAll (alias, "$root", this->_server->baseLocation ());
                 join::replaceAll (alias, "$scheme", this->_server->scheme ());
-                join::replaceAll (alias, "$host", this->_request.host ());
+                join::replaceAll (alias, "$host", this->_request->host ().str ());
                 join::replaceAll (alias, "$port", std::to_string (this->localEndpoint ().port ()));
-                join::replaceAll (alias, "$path", this->_request.path ());
-                join::replaceAll (alias, "$query", this->_request.query ());
-                join::replaceAll (alias, "$urn", this->_request.urn ());
+                join::replaceAll (alias, "$path", this->_request->path ().str ());
+                join::replaceAll (alias, "$query", this->query ());
+                join::replaceAll (alias, "$urn", this->_request->path ().str () + this->query ());
             }
 
             if (content->type == HttpContentType::Root)
             {
-                this->sendFile (this->_server->baseLocation () + this->_request.path ());
+                this->_location.assign (this->_server->baseLocation ());
+                this->_location.append (this->_request->path ().data (), this->_request->path ().size ());
+                this->sendFile (this->_location);
             }
             else if (content->type == HttpContentType::Alias)
             {
@@ -544,7 +1219,7 @@ namespace join
             }
             else if (content->type == HttpContentType::Redirect)
             {
-                if (this->_request.version () == "HTTP/1.1")
+                if (this->_request->version () == "HTTP/1.1")
                 {
                     this->sendRedirect ("307", "Temporary Redirect", alias);
                 }
@@ -555,12 +1230,35 @@ namespace join
             }
         }
 
+        /**
+         * @brief rebuild the request query from the decoded parameters.
+         * @return request query.
+         */
+        std::string query () const
+        {
+            HttpRequest::ParameterMap params;
+            std::string query;
+
+            for (size_t i = 0; i < this->_request->parameterCount (); ++i)
+            {
+                const HttpRequestParser::Field& param = this->_request->parameterAt (i);
+                params[param.name.str ()] = param.value.str ();
+            }
+
+            for (auto const& param : params)
+            {
+                query += (query.empty () ? "?" : "&") + param.first + "=" + param.second;
+            }
+
+            return query;
+        }
+
         /**
          * @brief clean all.
          */
         void cleanUp ()
         {
-            this->_request.clear ();
+            this->_request->clear ();
             this->_response.clear ();
         }
 
@@ -621,8 +1319,11 @@ namespace join
         /// max requests.
         int _max = 0;
 
-        /// HTTP request.
-        HttpRequest _request;
+        /// HTTP request (event-driven mode: only while a request is in progress).
+        std::unique_ptr<HttpRequestParser> _request;
+
+        /// resolved file location.
+        std::string _location;
 
         /// HTTP response.
         HttpResponse _response;
@@ -636,19 +1337,44 @@ namespace join
         /// HTTP server.
         Server* _server;
 
-        /// thread.
-        Thread _thread;
+        /// acceptor owned by the worker (sharded mode).
+        std::unique_ptr<Acceptor> _acceptor;
+
+        /// thread (threaded and sharded modes).
+        std::unique_ptr<Thread> _thread;
+
+        /// minimum file size sent with sendfile, smaller files are coalesced with the headers.
+        static constexpr off_t _zeroCopyThreshold = 16384;
+
+        /// reactor used to wait for incoming requests (event-driven mode).
+        Reactor* _reactor = nullptr;
+
+        /// number of buffered bytes already scanned.
+        std::streamsize _scanned = 0;
+
+        /// scanner is at the beginning of a line.
+        bool _lineStart = false;
+
+        /// connection is being served by the worker pool.
+        std::atomic<bool> _busy{false};
+
+        /// last connection activity.
+        std::chrono::steady_clock::time_point _lastActivity;
+
+        /// friendship with server.
+        friend Server;
     };
 
     /**
      * @brief basic HTTP server.
      */
     template <class Protocol>
-    class BasicHttpServer
+    class BasicHttpServer : protected EventHandler
     {
     public:
         using Worker = BasicHttpWorker<Protocol>;
         using Content = BasicHttpContent<Protocol>;
+        using Router = BasicHttpRouter<Protocol>;
         using Handler = typename Content::Handler;
         using Access = typename Content::Access;
         using Endpoint = typename Protocol::Endpoint;
@@ -666,6 +1392,13 @@ namespace join
         , _keepTimeout (10)
         {
             [[maybe_unused]] int res = chdir (this->_baseLocation.c_str ());
+
+            // each cached file keeps its descriptor open, leave most of them to the connections.
+            struct rlimit limit;
+            if ((getrlimit (RLIMIT_NOFILE, &limit) == 0) && (limit.rlim_cur != RLIM_INFINITY))
+            {
+                this->_cache.capacity (std::max (size_t (limit.rlim_cur / 4), size_t (1)));
+            }
         }
 
         /**
@@ -699,7 +1432,9 @@ namespace join
          */
         virtual ~BasicHttpServer ()
         {
+            this->close ();
             this->_acceptor.close ();
+            this->_router.clear ();
             this->_contents.clear ();
             ::close (this->_event);
         }
@@ -724,14 +1459,119 @@ namespace join
             return 0;
         }
 
+        /**
+         * @brief create a sharded server.
+         * each worker owns an acceptor bound with port reuse and is pinned to a core,
+         * the kernel spreads the incoming connections over the acceptors without serializing accepts.
+         * a worker serves one connection at a time and the connections queued on its acceptor can't be
+         * taken by another worker: a keep alive connection is closed after the current response as soon
+         * as another connection is waiting, but an idle one still holds the worker until it sends its
+         * next request or the keep alive timeout expires, so keep that timeout short in this mode.
+         * @param endpoint endpoint to assign to the server.
+         * @return 0 on success, -1 on failure.
+         */
+        int createSharded (const Endpoint& endpoint) noexcept
+        {
+            if (this->_acceptor.opened () || !this->_workers.empty ())
+            {
+                lastError = make_error_code (Errc::InUse);
+                return -1;
+            }
+
+            std::vector<Acceptor> acceptors (this->_nworkers);
+            for (auto& acceptor : acceptors)
+            {
+                if (acceptor.create (endpoint, true) == -1)
+                {
+                    return -1;
+                }
+            }
+
+            const auto& cores = CpuTopology::instance ()->cores ();
+            for (size_t nworkers = 0; nworkers < acceptors.size (); ++nworkers)
+            {
+                int core = cores.empty () ? -1 : cores[nworkers % cores.size ()].primaryThread ();
+                this->_workers.emplace_back (new Worker (this, std::move (acceptors[nworkers]), core));
+            }
+
+            return 0;
+        }
+
+        /**
+         * @brief create an event-driven server.
+         * connections are multiplexed on the reactor until a complete request is received,
+         * requests are then served by a pool of worker threads.
+         * @param endpoint endpoint to assign to the server.
+         * @param reactor running reactor used to multiplex the connections.
+         * @return 0 on success, -1 on failure.
+         */
+        int create (const Endpoint& endpoint, Reactor& reactor) noexcept
+        {
+            if (this->_acceptor.create (endpoint) == -1)
+            {
+                return -1;
+            }
+
+            this->_reactor = &reactor;
+            this->_closing = false;
+            this->_buffers.reserve (_maxSpares);
+            this->_parsers.reserve (_maxSpares);
+            this->_pool = std::make_unique<ThreadPool> (std::max (int (this->_nworkers), 1));
+            this->_sweeper = std::make_unique<Monotonic::Timer> (reactor);
+            this->_sweeper->setInterval (std::chrono::seconds (1), [this] () {
+                this->sweep ();
+            });
+
+            if (reactor.addHandler (this->_acceptor.handle (), this) == -1)
+            {
+                // LCOV_EXCL_START
+                this->close ();
+                return -1;
+                // LCOV_EXCL_STOP
+            }
+
+            return 0;
+        }
+
         /**
          * @brief close server.
          */
         void close () noexcept
         {
-            uint64_t val = this->_nworkers;
-            [[maybe_unused]] ssize_t bytes = ::write (this->_event, &val, sizeof (uint64_t));
-            this->_workers.clear ();
+            if (this->_reactor != nullptr)
+            {
+                this->_reactor->delHandler (this->_acceptor.handle ());
+                this->_sweeper.reset ();
+
+                {
+                    ScopedLock<Mutex> lock (this->_connMutex);
+                    this->_closing = true;
+                }
+
+                // wait for the requests in progress, served connections are released.
+                this->_pool.reset ();
+
+                std::unordered_map<Worker*, std::unique_ptr<Worker>> connections;
+                {
+                    ScopedLock<Mutex> lock (this->_connMutex);
+                    connections.swap (this->_connections);
+                }
+
+                for (auto const& connection : connections)
+                {
+                    this->_reactor->delHandler (connection.first->_sockbuf.socket ().handle ());
+                }
+
+                this->_reactor = nullptr;
+            }
+
+            if (!this->_workers.empty ())
+            {
+                uint64_t val = this->_workers.size ();
+                [[maybe_unused]] ssize_t bytes = ::write (this->_event, &val, sizeof (uint64_t));
+                this->_workers.clear ();
+            }
+
             this->_acceptor.close ();
         }
 
@@ -741,7 +1581,17 @@ namespace join
          */
         virtual Socket accept () const
         {
-            return Socket (this->_acceptor.accept ());
+            return this->accept (this->_acceptor);
+        }
+
+        /**
+         * @brief accept new connection on the given acceptor.
+         * @param acceptor acceptor to accept the connection from.
+         * @return the accepted client socket object.
+         */
+        virtual Socket accept (const Acceptor& acceptor) const
+        {
+            return Socket (acceptor.accept ());
         }
 
         /**
@@ -798,6 +1648,60 @@ namespace join
             return this->_keepMax;
         }
 
+        /**
+         * @brief set the request head limits, applied to the parsers created afterwards.
+         * a request line or header line is limited to 2048 bytes regardless of these limits.
+         * @param capacity request head size in bytes, request line decoded path and parameters included (default 64 KiB).
+         * @param maxHeaders maximum number of request headers (default 512).
+         * @param maxParameters maximum number of query parameters (default 1024).
+         */
+        void requestLimits (size_t capacity, size_t maxHeaders = HttpRequestParser::defaultMaxHeaders,
+                            size_t maxParameters = HttpRequestParser::defaultMaxParameters)
+        {
+            ScopedLock<Mutex> lock (this->_spareMutex);
+            this->_headCapacity = capacity;
+            this->_maxHeaders = maxHeaders;
+            this->_maxParameters = maxParameters;
+            this->_parsers.clear ();
+        }
+
+        /**
+         * @brief get the request head size limit.
+         * @return request head size in bytes.
+         */
+        size_t requestHeadCapacity () const
+        {
+            return this->_headCapacity;
+        }
+
+        /**
+         * @brief get the maximum number of request headers.
+         * @return maximum number of request headers.
+         */
+        size_t requestMaxHeaders () const
+        {
+            return this->_maxHeaders;
+        }
+
+        /**
+         * @brief get the maximum number of query parameters.
+         * @return maximum number of query parameters.
+         */
+        size_t requestMaxParameters () const
+        {
+            return this->_maxParameters;
+        }
+
+        /**
+         * @brief get the file cache used to serve static files (budget, capacity, revalidation, counters).
+         * its capacity defaults to a quarter of the file descriptors limit.
+         * @return file cache.
+         */
+        Cache& cache () noexcept
+        {
+            return this->_cache;
+        }
+
         /**
          * @brief get scheme.
          * @return htpp or https.
@@ -826,6 +1730,7 @@ namespace join
                 newEntry->handler = nullptr;
                 newEntry->access = access;
                 this->_contents.emplace_back (newEntry);
+                this->_router.insert (newEntry);
             }
 
             return newEntry;
@@ -853,6 +1758,7 @@ namespace join
                 newEntry->handler = nullptr;
                 newEntry->access = access;
                 this->_contents.emplace_back (newEntry);
+                this->_router.insert (newEntry);
             }
 
             return newEntry;
@@ -880,6 +1786,7 @@ namespace join
                 newEntry->handler = handler;
                 newEntry->access = access;
                 this->_contents.emplace_back (newEntry);
+                this->_router.insert (newEntry);
             }
 
             return newEntry;
@@ -907,6 +1814,7 @@ namespace join
                 newEntry->handler = nullptr;
                 newEntry->access = access;
                 this->_contents.emplace_back (newEntry);
+                this->_router.insert (newEntry);
             }
 
             return newEntry;
@@ -914,31 +1822,195 @@ namespace join
 
     protected:
         /**
-         * @brief find content.
-         * @param method method.
-         * @param path resource path.
-         * @return a pointer to the content on success, nullptr on failure.
+         * @brief method called when a connection is pending on the acceptor (event-driven mode).
+         * @param fd file descriptor.
          */
-        Content* findContent (HttpMethod method, const std::string& path) const
+        virtual void onReadable ([[maybe_unused]] int fd) override
+        {
+            Socket socket = this->accept ();
+            if (!socket.connected ())
+            {
+                return;
+            }
+
+            Worker* worker = new Worker (this, this->_reactor);
+            {
+                ScopedLock<Mutex> lock (this->_connMutex);
+                this->_connections.emplace (worker, std::unique_ptr<Worker> (worker));
+            }
+
+            if (worker->attach (std::move (socket)) == -1)
+            {
+                this->release (worker);  // LCOV_EXCL_LINE
+            }
+        }
+
+        /**
+         * @brief hand a connection with a pending request over to the worker pool (event-driven mode).
+         * @param worker connection to serve.
+         */
+        void dispatch (Worker* worker)
+        {
+            ScopedLock<Mutex> lock (this->_connMutex);
+
+            if (this->_closing)
+            {
+                this->_connections.erase (worker);
+                return;
+            }
+
+            this->_pool->push ([worker] () {
+                worker->serve ();
+            });
+        }
+
+        /**
+         * @brief give a served connection back to the reactor (event-driven mode).
+         * @param worker served connection.
+         */
+        void park (Worker* worker)
+        {
+            ScopedLock<Mutex> lock (this->_connMutex);
+
+            if (this->_closing)
+            {
+                this->_connections.erase (worker);
+                return;
+            }
+
+            worker->_busy.store (false, std::memory_order_release);
+
+            if (this->_reactor->addHandler (worker->_sockbuf.socket ().handle (), worker, true, false, false) == -1)
+            {
+                this->_connections.erase (worker);  // LCOV_EXCL_LINE
+            }
+        }
+
+        /**
+         * @brief release a connection (event-driven mode).
+         * @param worker connection to release.
+         */
+        void release (Worker* worker)
         {
-            std::string directory = join::base (path);
-            std::string name = join::filename (path);
+            this->recycle (worker);
+
+            ScopedLock<Mutex> lock (this->_connMutex);
+            this->_connections.erase (worker);
+        }
 
-            for (auto const& content : this->_contents)
+        /**
+         * @brief get a stream buffer for a connection about to read (event-driven mode).
+         * @return stream buffer.
+         */
+        std::unique_ptr<char[]> acquireBuffer ()
+        {
             {
-                if (content->methods & method)
+                ScopedLock<Mutex> lock (this->_spareMutex);
+                if (!this->_buffers.empty ())
                 {
-                    if (fnmatch (content->directory.c_str (), directory.c_str (), FNM_CASEFOLD) == 0)
-                    {
-                        if (fnmatch (content->name.c_str (), name.c_str (), FNM_CASEFOLD) == 0)
-                        {
-                            return content.get ();
-                        }
-                    }
+                    std::unique_ptr<char[]> buf = std::move (this->_buffers.back ());
+                    this->_buffers.pop_back ();
+                    return buf;
+                }
+            }
+
+            return std::make_unique<char[]> (Worker::SocketStreambuf::bufferSize);
+        }
+
+        /**
+         * @brief get a request parser for a connection about to be served (event-driven mode).
+         * @return request parser.
+         */
+        std::unique_ptr<HttpRequestParser> acquireParser ()
+        {
+            {
+                ScopedLock<Mutex> lock (this->_spareMutex);
+                if (!this->_parsers.empty ())
+                {
+                    std::unique_ptr<HttpRequestParser> parser = std::move (this->_parsers.back ());
+                    this->_parsers.pop_back ();
+                    return parser;
+                }
+            }
+
+            return this->createParser ();
+        }
+
+        /**
+         * @brief create a request parser with the configured request head limits.
+         * @return request parser.
+         */
+        std::unique_ptr<HttpRequestParser> createParser ()
+        {
+            return std::make_unique<HttpRequestParser> (this->_headCapacity, this->_maxHeaders, this->_maxParameters);
+        }
+
+        /**
+         * @brief take the request parser and the stream buffers back from an idle connection (event-driven mode).
+         * stream buffers still holding data are left to the connection.
+         * @param worker idle connection.
+         */
+        void recycle (Worker* worker)
+        {
+            std::unique_ptr<char[]> buf = worker->_sockbuf.detachBuffer ();
+            std::unique_ptr<HttpRequestParser> parser = std::move (worker->_request);
+
+            ScopedLock<Mutex> lock (this->_spareMutex);
+
+            if (buf && (this->_buffers.size () < _maxSpares))
+            {
+                this->_buffers.push_back (std::move (buf));
+            }
+
+            if (parser && (this->_parsers.size () < _maxSpares))
+            {
+                this->_parsers.push_back (std::move (parser));
+            }
+        }
+
+        /**
+         * @brief close the connections idle for longer than the keep alive timeout (event-driven mode).
+         */
+        void sweep ()
+        {
+            auto now = std::chrono::steady_clock::now ();
+
+            ScopedLock<Mutex> lock (this->_connMutex);
+
+            for (auto const& connection : this->_connections)
+            {
+                Worker* worker = connection.first;
+                if (!worker->_busy.load (std::memory_order_acquire) &&
+                    ((now - worker->_lastActivity) >= this->_keepTimeout))
+                {
+                    // a parked connection may not be registered yet, the hang up is reported once it is
+                    // and the connection is released by onClose from the reactor thread.
+                    ::shutdown (worker->_sockbuf.socket ().handle (), SHUT_RDWR);
                 }
             }
+        }
+
+        /**
+         * @brief find content.
+         * @param method method.
+         * @param path resource path.
+         * @return a pointer to the content on success, nullptr on failure.
+         */
+        Content* findContent (HttpMethod method, const std::string& path) const
+        {
+            return this->_router.find (method, path);
+        }
 
-            return nullptr;
+        /**
+         * @brief find content.
+         * @param method method.
+         * @param path null terminated resource path.
+         * @param size resource path length.
+         * @return a pointer to the content on success, nullptr on failure.
+         */
+        Content* findContent (HttpMethod method, const char* path, size_t size) const
+        {
+            return this->_router.find (method, path, size);
         }
 
         /// acceptor.
@@ -959,6 +2031,9 @@ namespace join
         /// contents.
         std::vector<std::unique_ptr<Content>> _contents;
 
+        /// contents index.
+        Router _router;
+
         /// base location.
         std::string _baseLocation;
 
@@ -968,9 +2043,48 @@ namespace join
         /// keep alive max.
         int _keepMax = 1000;
 
+        /// request head size limit.
+        size_t _headCapacity = HttpRequestParser::defaultCapacity;
+
+        /// maximum number of request headers.
+        size_t _maxHeaders = HttpRequestParser::defaultMaxHeaders;
+
+        /// maximum number of query parameters.
+        size_t _maxParameters = HttpRequestParser::defaultMaxParameters;
+
         /// file cache.
         Cache _cache;
 
+        /// reactor used to multiplex the connections (event-driven mode).
+        Reactor* _reactor = nullptr;
+
+        /// pool serving the pending requests (event-driven mode).
+        std::unique_ptr<ThreadPool> _pool;
+
+        /// idle connections sweeper (event-driven mode).
+        std::unique_ptr<Monotonic::Timer> _sweeper;
+
+        /// connections (event-driven mode).
+        std::unordered_map<Worker*, std::unique_ptr<Worker>> _connections;
+
+        /// connections protection mutex.
+        Mutex _connMutex;
+
+        /// spare stream buffers (event-driven mode).
+        std::vector<std::unique_ptr<char[]>> _buffers;
+
+        /// spare request parsers (event-driven mode).
+        std::vector<std::unique_ptr<HttpRequestParser>> _parsers;
+
+        /// maximum number of spare stream buffers and request parsers kept.
+        static constexpr size_t _maxSpares = 1024;
+
+        /// spare stream buffers and request parsers protection mutex.
+        Mutex _spareMutex;
+
+        /// server is closing (event-driven mode).
+        bool _closing = false;
+
         /// friendship with worker.
         friend Worker;
     };
@@ -984,6 +2098,8 @@ namespace join
     public:
         using Worker = BasicHttpWorker<Protocol>;
         using Socket = typename Protocol::Socket;
+        using Acceptor = typename Protocol::Acceptor;
+        using BasicHttpServer<Protocol>::accept;
 
         /**
          * @brief create the HTTPS server instance using the given context.
@@ -1032,12 +2148,13 @@ namespace join
         }
 
         /**
-         * @brief accept new connection and fill in the client object with connection parameters.
+         * @brief accept new connection on the given acceptor and fill in the client object with connection parameters.
+         * @param acceptor acceptor to accept the connection from.
          * @return the accepted client socket object.
          */
-        Socket accept () const override
+        Socket accept (const Acceptor& acceptor) const override
         {
-            Socket sock (this->_acceptor.accept (), this->_ctx);
+            Socket sock (acceptor.accept (), this->_ctx);
             if (sock.deferHandshake () == -1)
             {
                 sock.close ();
@@ -24,8 +24,11 @@
 
 // libjoin.
 #include <join/http_client.hpp>
+#include <join/http_server.hpp>
+#include <join/statistics.hpp>
 #include <join/filesystem.hpp>
 #include <join/thread.hpp>
+#include <join/timer.hpp>
 #include <join/mutex.hpp>
 #include <join/cache.hpp>
 #include <join/utils.hpp>
@@ -33,15 +36,19 @@
 // C++.
 #include <vector>
 #include <regex>
+#include <deque>
 
 // C.
+#include <sys/eventfd.h>
 #include <unistd.h>
+#include <csignal>
 
 struct BenchmarkContext
 {
     std::atomic<int> counter{0};    ///< work queue counter
     std::atomic<int> ncomplete{0};  ///< successful requests
     std::atomic<int> nfail{0};      ///< failed requests
+    std::atomic<int> nconnect{0};   ///< established connections
     join::Cache fileCache;          ///< file cache
     join::Mutex coutMutex;          ///< output guard
 };
@@ -66,11 +73,15 @@ void usage ()
               << "\n"
               << "Options\n"
               << "  -c level          concurrency level (default: 1)\n"
+              << "  -C connections    connections per thread in open loop mode (default: 1)\n"
               << "  -h                show available options\n"
               << "  -H                send HEAD request\n"
               << "  -K                enable keep alive\n"
               << "  -n requests       number of requests to perform (default: 1)\n"
+              << "  -p depth          pipelining depth in open loop mode (default: 1)\n"
               << "  -P file           file to POST (mime type is deduced from file extension)\n"
+              << "  -r rate           send requests at a constant rate in requests per second (open loop)\n"
+              << "  -S mode           run an embedded server on the URL port (threaded, sharded or event)\n"
               << "  -t                request timeout in seconds\n"
               << "  -U file           file to PUT (mime type is deduced from file extension)\n"
               << "  -v                verbose\n"
@@ -83,18 +94,19 @@ void usage ()
 // =========================================================================
 template <class Client>
 void benchmark (Client client, join::HttpRequest request, const std::string& file, int timeout, int max, bool verbose,
-                BenchmarkContext& ctx)
+                BenchmarkContext& ctx, join::Rdtsc::Stats& latency)
 {
     std::string payload;
-    void* addr = nullptr;
+    join::Cache::FilePtr upload;
+    join::Rdtsc::Stats stats;
     struct stat sbuf;
 
     client.timeout (timeout * 1000);
 
     if (!file.empty ())
     {
-        addr = ctx.fileCache.get (file, sbuf);
-        if (addr != nullptr)
+        upload = ctx.fileCache.acquire (file, sbuf);
+        if (upload != nullptr)
         {
             request.header ("Content-Length", std::to_string (sbuf.st_size));
         }
@@ -103,6 +115,8 @@ void benchmark (Client client, join::HttpRequest request, const std::string& fil
     while (ctx.counter.fetch_add (1, std::memory_order_relaxed) < max)
     {
         join::HttpResponse response;
+        const auto port = client.socket ().localEndpoint ().port ();
+        const auto beg = stats.start ();
 
         // send request headers.
         if (client.send (request) == -1)
@@ -113,6 +127,12 @@ void benchmark (Client client, join::HttpRequest request, const std::string& fil
             continue;
         }
 
+        // a new local port means the client had to (re)connect.
+        if (client.socket ().localEndpoint ().port () != port)
+        {
+            ++ctx.nconnect;
+        }
+
         if (verbose)
         {
             join::ScopedLock<join::Mutex> lock (ctx.coutMutex);
@@ -121,9 +141,9 @@ void benchmark (Client client, join::HttpRequest request, const std::string& fil
         }
 
         // send payload.
-        if (addr != nullptr)
+        if (upload != nullptr)
         {
-            client.write (static_cast<const char*> (addr), sbuf.st_size);
+            client.write (static_cast<const char*> (upload->addr), upload->size);
             client.flush ();
         }
 
@@ -159,8 +179,577 @@ void benchmark (Client client, join::HttpRequest request, const std::string& fil
             client.clear ();
         }
 
+        stats.stop (beg);
         ++ctx.ncomplete;
     }
+
+    latency.merge (stats);
+}
+
+template <class Client>
+class LoadGenerator;
+
+/**
+ * @brief open loop connection sending scheduled requests, up to the pipelining depth.
+ */
+template <class Client>
+class LoadConnection : public join::EventHandler
+{
+public:
+    using TimePoint = join::Rdtsc::TimePoint;
+
+    /**
+     * @brief create the connection.
+     * @param client HTTP client.
+     * @param generator owning load generator.
+     */
+    LoadConnection (Client&& client, LoadGenerator<Client>& generator)
+    : _client (std::move (client))
+    , _generator (generator)
+    , _request (generator.request ())
+    {
+        _client.timeout (generator.timeout () * 1000);
+    }
+
+    /**
+     * @brief check if another request can be sent on the connection.
+     * @return true if another request can be sent.
+     */
+    bool ready () const
+    {
+        return int (_inflight.size ()) < _generator.depth ();
+    }
+
+    /**
+     * @brief send a request.
+     * @param intended time at which the request was scheduled.
+     * @return 0 on success, -1 on failure.
+     */
+    int send (TimePoint intended)
+    {
+        if (_client.send (_request) == -1)
+        {
+            ++_generator.context ().nfail;
+            this->reset ();
+            return -1;
+        }
+
+        if (_generator.file () != nullptr)
+        {
+            _client.write (static_cast<const char*> (_generator.file ()->addr), _generator.file ()->size);
+            _client.flush ();
+        }
+
+        // (re)connection: watch the new socket.
+        if (_client.socket ().handle () != _fd)
+        {
+            this->detach ();
+            _fd = _client.socket ().handle ();
+            _generator.reactor ().addHandler (_fd, this);
+            ++_generator.context ().nconnect;
+        }
+
+        _inflight.push_back (intended);
+
+        return 0;
+    }
+
+    /**
+     * @brief stop watching the connection.
+     */
+    void detach ()
+    {
+        if (_fd != -1)
+        {
+            _generator.reactor ().delHandler (_fd);
+            _fd = -1;
+        }
+    }
+
+protected:
+    /**
+     * @brief method called when responses are ready to be read.
+     * @param fd file descriptor.
+     */
+    void onReadable ([[maybe_unused]] int fd) override
+    {
+        while (!_inflight.empty ())
+        {
+            if (this->receive () == -1)
+            {
+                this->reset ();
+                break;
+            }
+
+            if (_client.rdbuf ()->in_avail () <= 0)
+            {
+                break;
+            }
+        }
+
+        _generator.pump ();
+    }
+
+    /**
+     * @brief method called when the connection is closed by the server.
+     * @param fd file descriptor.
+     */
+    void onClose ([[maybe_unused]] int fd) override
+    {
+        while (!_inflight.empty () && (this->receive () == 0))
+        {
+        }
+
+        this->reset ();
+        _generator.pump ();
+    }
+
+    /**
+     * @brief method called when an error occurred on the connection.
+     * @param fd file descriptor.
+     */
+    void onError (int fd) override
+    {
+        this->onClose (fd);
+    }
+
+    /**
+     * @brief read a response and record its latency.
+     * @return 0 on success, -1 on failure.
+     */
+    int receive ()
+    {
+        join::HttpResponse response;
+
+        if (_client.receive (response) == -1)
+        {
+            return -1;
+        }
+
+        const auto len = response.contentLength ();
+        if (len > 0)
+        {
+            _payload.resize (len);
+            _client.read (&_payload[0], _payload.size ());
+        }
+        else if (response.header ("Transfer-Encoding").find ("chunked") != std::string::npos)
+        {
+            _payload.resize (4096);
+            while (_client.read (&_payload[0], _payload.size ()))
+            {
+            }
+            _client.clear ();
+        }
+
+        _generator.record (_inflight.front ());
+        _inflight.pop_front ();
+
+        // the server won't answer the remaining requests.
+        if (_client.keepAliveMax () == 0)
+        {
+            this->reset ();
+        }
+
+        return 0;
+    }
+
+    /**
+     * @brief close the connection, requests still in flight fail.
+     */
+    void reset ()
+    {
+        _generator.context ().nfail += _inflight.size ();
+        _inflight.clear ();
+        this->detach ();
+        _client.close ();
+        _client.clear ();
+    }
+
+    /// HTTP client.
+    Client _client;
+
+    /// owning load generator.
+    LoadGenerator<Client>& _generator;
+
+    /// request sent.
+    join::HttpRequest _request;
+
+    /// scheduled time of the requests in flight.
+    std::deque<TimePoint> _inflight;
+
+    /// watched socket.
+    int _fd = -1;
+
+    /// response payload.
+    std::string _payload;
+};
+
+/**
+ * @brief open loop load generator scheduling requests at a constant rate from its own reactor thread.
+ * latencies are measured from the time a request was scheduled, not sent, so that a slow server
+ * doesn't slow down the load and hide its own latency (coordinated omission).
+ * the connections are served by another reactor thread, their blocking I/O doesn't delay the schedule.
+ */
+template <class Client>
+class LoadGenerator : public join::EventHandler
+{
+public:
+    using TimePoint = join::Rdtsc::TimePoint;
+
+    /**
+     * @brief create the load generator.
+     * @param ctx benchmark context.
+     * @param request request to send.
+     * @param file payload to send, nullptr if none.
+     * @param timeout request timeout in seconds.
+     * @param depth pipelining depth.
+     * @param interval time between two requests.
+     * @param quota number of requests to send.
+     */
+    LoadGenerator (BenchmarkContext& ctx, const join::HttpRequest& request, join::Cache::FilePtr file, int timeout,
+                   int depth, std::chrono::nanoseconds interval, int quota)
+    : _ctx (ctx)
+    , _request (request)
+    , _file (std::move (file))
+    , _timeout (timeout)
+    , _depth (std::max (depth, 1))
+    , _interval (interval)
+    , _quota (quota)
+    , _wakeup (eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC))
+    , _thread ([this] () { _reactor.run (); })
+    , _clockThread ([this] () { _clock.run (); })
+    {
+    }
+
+    /**
+     * @brief release the load generator.
+     */
+    ~LoadGenerator ()
+    {
+        if (_wakeup != -1)
+        {
+            ::close (_wakeup);
+        }
+    }
+
+    /**
+     * @brief open the connections and start sending requests.
+     * @param connections number of connections.
+     * @param factory client factory.
+     */
+    void start (int connections, const std::function<Client ()>& factory)
+    {
+        for (int i = 0; i < std::max (connections, 1); ++i)
+        {
+            _connections.emplace_back (new LoadConnection<Client> (factory (), *this));
+        }
+
+        _reactor.addHandler (_wakeup, this);
+        _timer.reset (new join::Monotonic::Timer (_clock));
+        _start = join::Rdtsc::now ();
+        _timer->setInterval (_interval, [this] () { this->tick (); });
+    }
+
+    /**
+     * @brief stop sending requests and release the connections.
+     */
+    void stop ()
+    {
+        _stopping.store (true, std::memory_order_release);
+        _timer.reset ();
+        _clock.stop ();
+        _clockThread.join ();
+
+        for (auto& connection : _connections)
+        {
+            connection->detach ();
+        }
+
+        _reactor.delHandler (_wakeup);
+        _reactor.stop ();
+        _thread.join ();
+        _connections.clear ();
+    }
+
+    /**
+     * @brief schedule the next request (clock thread).
+     */
+    void tick ()
+    {
+        if (_sent == _quota)
+        {
+            return;
+        }
+
+        ++_sent;
+
+        {
+            join::ScopedLock<join::Mutex> lock (_mutex);
+            _scheduled.push_back (_start + _interval * _sent);
+        }
+
+        uint64_t value = 1;
+        [[maybe_unused]] ssize_t bytes = ::write (_wakeup, &value, sizeof (value));
+    }
+
+    /**
+     * @brief send the scheduled requests on the connections ready to send (connections thread).
+     */
+    void pump ()
+    {
+        {
+            join::ScopedLock<join::Mutex> lock (_mutex);
+            _backlog.insert (_backlog.end (), _scheduled.begin (), _scheduled.end ());
+            _scheduled.clear ();
+        }
+
+        size_t tries = 0;
+
+        while (!_backlog.empty () && (tries < _connections.size ()) &&
+               !_stopping.load (std::memory_order_acquire))
+        {
+            auto& connection = _connections[_next];
+            _next = (_next + 1) % _connections.size ();
+
+            if (!connection->ready ())
+            {
+                ++tries;
+                continue;
+            }
+
+            tries = 0;
+            TimePoint intended = _backlog.front ();
+            _backlog.pop_front ();
+            connection->send (intended);
+        }
+    }
+
+    /**
+     * @brief method called when requests were scheduled.
+     * @param fd file descriptor.
+     */
+    void onReadable (int fd) override
+    {
+        uint64_t value;
+        [[maybe_unused]] ssize_t bytes = ::read (fd, &value, sizeof (value));
+
+        this->pump ();
+    }
+
+    /**
+     * @brief record the latency of a completed request.
+     * @param intended time at which the request was scheduled.
+     */
+    void record (TimePoint intended)
+    {
+        _stats.stop (intended);
+        ++_ctx.ncomplete;
+    }
+
+    /**
+     * @brief get benchmark context.
+     * @return benchmark context.
+     */
+    BenchmarkContext& context ()
+    {
+        return _ctx;
+    }
+
+    /**
+     * @brief get request to send.
+     * @return request to send.
+     */
+    const join::HttpRequest& request () const
+    {
+        return _request;
+    }
+
+    /**
+     * @brief get payload to send.
+     * @return payload to send, nullptr if none.
+     */
+    const join::Cache::File* file () const
+    {
+        return _file.get ();
+    }
+
+    /**
+     * @brief get request timeout.
+     * @return request timeout in seconds.
+     */
+    int timeout () const
+    {
+        return _timeout;
+    }
+
+    /**
+     * @brief get pipelining depth.
+     * @return pipelining depth.
+     */
+    int depth () const
+    {
+        return _depth;
+    }
+
+    /**
+     * @brief get reactor.
+     * @return reactor.
+     */
+    join::Reactor& reactor ()
+    {
+        return _reactor;
+    }
+
+    /**
+     * @brief get latency statistics.
+     * @return latency statistics.
+     */
+    const join::Rdtsc::Stats& stats () const
+    {
+        return _stats;
+    }
+
+private:
+    /// benchmark context.
+    BenchmarkContext& _ctx;
+
+    /// request to send.
+    join::HttpRequest _request;
+
+    /// payload to send.
+    join::Cache::FilePtr _file;
+
+    /// request timeout in seconds.
+    int _timeout;
+
+    /// pipelining depth.
+    int _depth;
+
+    /// time between two requests.
+    std::chrono::nanoseconds _interval;
+
+    /// number of requests to send.
+    int _quota;
+
+    /// number of requests scheduled.
+    int _sent = 0;
+
+    /// schedule origin.
+    TimePoint _start;
+
+    /// requests scheduled by the clock thread.
+    std::deque<TimePoint> _scheduled;
+
+    /// protect the scheduled requests.
+    join::Mutex _mutex;
+
+    /// scheduled requests waiting for a connection.
+    std::deque<TimePoint> _backlog;
+
+    /// connections.
+    std::vector<std::unique_ptr<LoadConnection<Client>>> _connections;
+
+    /// next connection to try.
+    size_t _next = 0;
+
+    /// latency statistics.
+    join::Rdtsc::Stats _stats;
+
+    /// stop requested.
+    std::atomic<bool> _stopping{false};
+
+    /// notify the connections thread of scheduled requests.
+    int _wakeup = -1;
+
+    /// connections event loop.
+    join::Reactor _reactor;
+
+    /// connections event loop thread.
+    join::Thread _thread;
+
+    /// clock event loop.
+    join::Reactor _clock;
+
+    /// clock event loop thread.
+    join::Thread _clockThread;
+
+    /// request rate timer.
+    std::unique_ptr<join::Monotonic::Timer> _timer;
+};
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : openLoop
+// =========================================================================
+template <class Client>
+void openLoop (const std::function<Client ()>& factory, const join::HttpRequest& request, const std::string& file,
+               int timeout, int max, int tasks, double rate, int connections, int depth, BenchmarkContext& ctx,
+               join::Rdtsc::Stats& latency)
+{
+    join::Cache::FilePtr payload;
+    join::HttpRequest req (request);
+
+    if (!file.empty ())
+    {
+        struct stat sbuf;
+        payload = ctx.fileCache.acquire (file, sbuf);
+        if (payload != nullptr)
+        {
+            req.header ("Content-Length", std::to_string (sbuf.st_size));
+        }
+    }
+
+    const auto interval = std::chrono::nanoseconds (static_cast<int64_t> (1e9 * tasks / rate));
+    std::deque<LoadGenerator<Client>> generators;
+
+    for (int i = 0; i < tasks; ++i)
+    {
+        const int quota = (max / tasks) + ((i < (max % tasks)) ? 1 : 0);
+        generators.emplace_back (ctx, req, payload, timeout, depth, interval, quota);
+    }
+
+    for (auto& generator : generators)
+    {
+        generator.start (connections, factory);
+    }
+
+    // wait for the responses, giving up once the schedule is over by more than the request timeout.
+    const auto deadline = std::chrono::steady_clock::now () + interval * (max / tasks + 1) + std::chrono::seconds (timeout);
+    while (((ctx.ncomplete + ctx.nfail) < max) && (std::chrono::steady_clock::now () < deadline))
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    }
+
+    for (auto& generator : generators)
+    {
+        generator.stop ();
+        latency.merge (generator.stats ());
+    }
+}
+
+static const std::string payload = "<html><body><h1>It works!</h1></body></html>";
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : serveHead
+// =========================================================================
+void serveHead (join::Http::Worker* worker)
+{
+    worker->header ("Content-Type", "text/html");
+    worker->header ("Content-Length", std::to_string (payload.size ()));
+    worker->sendHeaders ();
+    worker->flush ();
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : serveGet
+// =========================================================================
+void serveGet (join::Http::Worker* worker)
+{
+    serveHead (worker);
+    worker->write (payload.c_str (), payload.size ());
+    worker->flush ();
 }
 
 // =========================================================================
@@ -170,18 +759,25 @@ void benchmark (Client client, join::HttpRequest request, const std::string& fil
 int main (int argc, char* argv[])
 {
     join::HttpRequest request;
-    int tasks = 1, max = 1, timeout = 5;
+    int tasks = 1, max = 1, timeout = 5, connections = 1, depth = 1;
+    double rate = 0;
     bool verbose = false;
-    std::string file;
+    std::string file, mode;
+
+    // a connection reset while writing must fail the request, not kill the benchmark.
+    ::signal (SIGPIPE, SIG_IGN);
 
     int opt;
-    while ((opt = getopt (argc, argv, "c:hHKn:P:t:U:vV")) != -1)
+    while ((opt = getopt (argc, argv, "c:C:hHKn:p:P:r:S:t:U:vV")) != -1)
     {
         switch (opt)
         {
             case 'c':
                 tasks = std::stoi (optarg);
                 break;
+            case 'C':
+                connections = std::stoi (optarg);
+                break;
             case 'h':
                 usage ();
                 return EXIT_SUCCESS;
@@ -194,11 +790,20 @@ int main (int argc, char* argv[])
             case 'n':
                 max = std::stoi (optarg);
                 break;
+            case 'p':
+                depth = std::stoi (optarg);
+                break;
             case 'P':
                 file = optarg;
                 request.method (join::HttpMethod::Post);
                 request.header ("Content-Type", join::mime (file));
                 break;
+            case 'r':
+                rate = std::stod (optarg);
+                break;
+            case 'S':
+                mode = optarg;
+                break;
             case 't':
                 timeout = std::stoi (optarg);
                 break;
@@ -252,6 +857,13 @@ int main (int argc, char* argv[])
         match[3].length () ? uint16_t (std::stoi (match[3])) : join::Dns::Resolver::resolveService (scheme);
     const std::string path = match[4];
 
+    if (!mode.empty () && ((scheme == "https") || (mode != "threaded" && mode != "sharded" && mode != "event")))
+    {
+        std::cerr << "invalid server mode\n\n";
+        usage ();
+        return EXIT_FAILURE;
+    }
+
     request.path (path);
     request.header ("Accept-Language", "fr-FR,fr;q=0.8,en-US;q=0.6,en;q=0.4");
     request.header ("Accept", "text/html,application/xhtml+xml,application/xml;q=0.9,image/webp,*/*;q=0.8");
@@ -260,20 +872,60 @@ int main (int argc, char* argv[])
 
     std::cout << "\nbenchmarking \"" << host << "\" on port " << port << " ...\n\n";
 
+    join::Http::Server server (std::max (tasks, 1));
+    server.addExecute (join::HttpMethod::Head, "*", "*", serveHead);
+    server.addExecute (join::HttpMethod::Get, "*", "*", serveGet);
+
+    int res = 0;
+    if (mode == "threaded")
+        res = server.create ({join::IpAddress::ipv6Wildcard, port});
+    else if (mode == "sharded")
+        res = server.createSharded ({join::IpAddress::ipv6Wildcard, port});
+    else if (mode == "event")
+        res = server.create ({join::IpAddress::ipv6Wildcard, port}, join::ReactorThread::reactor ());
+
+    if (res == -1)
+    {
+        std::cerr << "failed to start server: " << join::lastError.message () << "\n";
+        return EXIT_FAILURE;
+    }
+
+    tasks = std::max (tasks, 1);
+    max = std::max (max, 1);
+
     BenchmarkContext ctx;
+    join::Rdtsc::Stats latency;
+
+    auto open = [&] () {
+        if (scheme == "https")
+            ::openLoop<join::Https::Client> (
+                [&] () {
+                    return join::Https::Client (join::TlsContext (join::TlsContext::TlsClient), host, port, false);
+                },
+                request, file, timeout, max, tasks, rate, connections, depth, ctx, latency);
+        else
+            ::openLoop<join::Http::Client> (
+                [&] () {
+                    return join::Http::Client (host, port, false);
+                },
+                request, file, timeout, max, tasks, rate, connections, depth, ctx, latency);
+    };
 
     auto run = [&] () {
         if (scheme == "https")
             ::benchmark (join::Https::Client (join::TlsContext (join::TlsContext::TlsClient), host, port, false),
-                         request, file, timeout, max, verbose, ctx);
+                         request, file, timeout, max, verbose, ctx, latency);
         else
-            ::benchmark (join::Http::Client (host, port, false), request, file, timeout, max, verbose, ctx);
+            ::benchmark (join::Http::Client (host, port, false), request, file, timeout, max, verbose, ctx, latency);
     };
 
     std::vector<join::Thread> threads;
     threads.reserve (tasks);
 
     const auto elapsed = join::benchmark ([&] () {
+        if (rate > 0)
+            return open ();
+
         for (int i = 0; i < tasks; ++i)
             threads.emplace_back (run);
 
@@ -288,6 +940,7 @@ int main (int argc, char* argv[])
               << "Server Port:            " << port << "\n"
               << "\n"
               << "Scheme:                 " << scheme << "\n"
+              << "Server Mode:            " << (mode.empty () ? "external" : mode) << "\n"
               << "Document Path:          " << request.path () << "\n"
               << "\n"
               << "Concurrency Level:      " << tasks << "\n"
@@ -295,7 +948,32 @@ int main (int argc, char* argv[])
               << "Completed requests:     " << ctx.ncomplete << "\n"
               << "Failed requests:        " << ctx.nfail << "\n"
               << "Requests per second:    " << max / secs << " [#/sec]\n"
+              << "Connections per second: " << ctx.nconnect / secs << " [#/sec]\n"
               << "\n";
 
+    if (rate > 0)
+    {
+        std::cout << "Target rate:            " << rate << " [#/sec]\n"
+                  << "Achieved rate:          " << ctx.ncomplete / secs << " [#/sec]\n"
+                  << "Connections per thread: " << connections << "\n"
+                  << "Pipelining depth:       " << depth << "\n"
+                  << "\n";
+    }
+
+    // with keep alive, a sharded server shows its head of line blocking in the tail latency.
+    auto ms = [] (std::chrono::nanoseconds ns) {
+        return ns.count () / 1e6;
+    };
+
+    std::cout << "Latency (measured from " << ((rate > 0) ? "scheduled" : "actual") << " send time)\n"
+              << "  50%:                  " << ms (latency.percentile (50.0)) << " ms\n"
+              << "  90%:                  " << ms (latency.percentile (90.0)) << " ms\n"
+              << "  99%:                  " << ms (latency.percentile (99.0)) << " ms\n"
+              << "  99.9%:                " << ms (latency.percentile (99.9)) << " ms\n"
+              << "  max:                  " << ms (latency.max ()) << " ms\n"
+              << "\n";
+
+    server.close ();
+
     return EXIT_SUCCESS;
 }
@@ -24,8 +24,13 @@
 
 // libjoin.
 #include <join/cache.hpp>
+#include <join/error.hpp>
+
+// C++.
+#include <vector>
 
 // C.
+#include <sys/inotify.h>
 #include <sys/mman.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -35,12 +40,35 @@
 
 using join::Cache;
 
+// =========================================================================
+//   CLASS     : Cache::File
+//   METHOD    : ~File
+// =========================================================================
+Cache::File::~File ()
+{
+    munmap (addr, size);
+    close (fd);
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : Cache
+// =========================================================================
+Cache::Cache (size_t budget, std::chrono::milliseconds revalidate, size_t shards)
+: _shards (new Shard[shards ? shards : 1])
+, _nshards (shards ? shards : 1)
+, _budget (budget)
+, _revalidate (revalidate.count ())
+{
+}
+
 // =========================================================================
 //   CLASS     : Cache
 //   METHOD    : ~Cache
 // =========================================================================
 Cache::~Cache ()
 {
+    unwatch ();
     clear ();
 }
 
@@ -50,47 +78,128 @@ Cache::~Cache ()
 // =========================================================================
 void* Cache::get (const std::string& fileName, struct stat& sbuf)
 {
-    if ((stat (fileName.c_str (), &sbuf) < 0) || S_ISDIR (sbuf.st_mode))
+    FilePtr file = acquire (fileName, sbuf);
+    if (file == nullptr)
     {
         return nullptr;
     }
 
-    ScopedLock<Mutex> lock (_mutex);
+    return file->addr;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : acquire
+// =========================================================================
+Cache::FilePtr Cache::acquire (const std::string& fileName, struct stat& sbuf)
+{
+    Shard& sh = shard (fileName);
+    auto now = std::chrono::steady_clock::now ();
+    auto interval = std::chrono::milliseconds (_revalidate.load (std::memory_order_relaxed));
+    bool watching = (_inotify.load (std::memory_order_acquire) != -1);
 
-    auto it = _entries.find (fileName);
-    if (it != _entries.end ())
+    if (watching || (interval.count () > 0))
     {
-        if (it->second->modifTime.tv_sec == sbuf.st_ctim.tv_sec &&
-            it->second->modifTime.tv_nsec == sbuf.st_ctim.tv_nsec)
+        ScopedLock<Mutex> lock (sh.mutex);
+
+        auto it = sh.entries.find (fileName);
+        if ((it != sh.entries.end ()) &&
+            ((watching && it->second.watched) || ((now - it->second.check) < interval)))
         {
-            return it->second->addr;
+            sh.lru.splice (sh.lru.begin (), sh.lru, it->second.lru);
+            sbuf = it->second.sbuf;
+            ++_hits;
+            return it->second.file;
         }
-
-        munmap (it->second->addr, it->second->size);
-        _entries.erase (it);
     }
 
-    void* ptr = nullptr;
+    // an entry is trusted without stat only if no event was received since the watch was set.
+    uint64_t epoch = _epoch.load (std::memory_order_acquire);
+    bool watched = watching && watch (fileName);
 
-    int fd = open (fileName.c_str (), O_RDONLY);
-    if (fd >= 0)
+    if ((stat (fileName.c_str (), &sbuf) < 0) || S_ISDIR (sbuf.st_mode))
     {
-        std::unique_ptr<CacheEntry> entry = std::make_unique<CacheEntry> ();
-        if (entry != nullptr)
+        remove (fileName);
+        unwatch (fileName);
+        return nullptr;
+    }
+
+    {
+        ScopedLock<Mutex> lock (sh.mutex);
+
+        auto it = sh.entries.find (fileName);
+        if (it != sh.entries.end ())
         {
-            entry->size = sbuf.st_size;
-            entry->modifTime = sbuf.st_ctim;
-            entry->addr = mmap (0, entry->size, PROT_READ, MAP_PRIVATE, fd, 0);
-            if (entry->addr != MAP_FAILED)
+            if (it->second.sbuf.st_ctim.tv_sec == sbuf.st_ctim.tv_sec &&
+                it->second.sbuf.st_ctim.tv_nsec == sbuf.st_ctim.tv_nsec && it->second.sbuf.st_size == sbuf.st_size)
             {
-                ptr = _entries.emplace (fileName, std::move (entry)).first->second->addr;
+                sh.lru.splice (sh.lru.begin (), sh.lru, it->second.lru);
+                it->second.sbuf = sbuf;
+                it->second.check = now;
+                it->second.watched = watched && (_epoch.load (std::memory_order_acquire) == epoch);
+                ++_hits;
+                return it->second.file;
             }
+
+            // the file is reloaded, keep its watch.
+            erase (sh, it, !watched);
         }
+    }
+
+    // map the file outside of the shard lock.
+    int fd = open (fileName.c_str (), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        unwatch (fileName);
+        return nullptr;
+    }
 
+    void* addr = mmap (0, sbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED)
+    {
         close (fd);
+        unwatch (fileName);
+        return nullptr;
+    }
+
+    std::shared_ptr<File> file = std::make_shared<File> ();
+    file->addr = addr;
+    file->size = sbuf.st_size;
+    file->fd = fd;
+
+    ++_misses;
+
+    {
+        ScopedLock<Mutex> lock (sh.mutex);
+
+        auto it = sh.entries.find (fileName);
+        if (it != sh.entries.end ())
+        {
+            erase (sh, it, !watched);
+        }
+
+        sh.lru.push_front (fileName);
+
+        CacheEntry& entry = sh.entries[fileName];
+        entry.file = file;
+        entry.sbuf = sbuf;
+        entry.check = now;
+        entry.lru = sh.lru.begin ();
+        entry.watched = watched && (_epoch.load (std::memory_order_acquire) == epoch);
+
+        _bytes += file->size;
+        ++_count;
+        evict (sh, &fileName);
     }
 
-    return ptr;
+    // the shard alone could not honor the limits.
+    for (size_t i = 0; (i < _nshards) && exceeded (); ++i)
+    {
+        ScopedLock<Mutex> lock (_shards[i].mutex);
+        evict (_shards[i], &fileName);
+    }
+
+    return file;
 }
 
 // =========================================================================
@@ -99,13 +208,14 @@ void* Cache::get (const std::string& fileName, struct stat& sbuf)
 // =========================================================================
 void Cache::remove (const std::string& fileName)
 {
-    ScopedLock<Mutex> lock (_mutex);
+    Shard& sh = shard (fileName);
+
+    ScopedLock<Mutex> lock (sh.mutex);
 
-    auto it = _entries.find (fileName);
-    if (it != _entries.end ())
+    auto it = sh.entries.find (fileName);
+    if (it != sh.entries.end ())
     {
-        munmap (it->second->addr, it->second->size);
-        _entries.erase (it);
+        erase (sh, it);
     }
 }
 
@@ -115,14 +225,15 @@ void Cache::remove (const std::string& fileName)
 // =========================================================================
 void Cache::clear ()
 {
-    ScopedLock<Mutex> lock (_mutex);
-
-    for (auto const& entry : _entries)
+    for (size_t i = 0; i < _nshards; ++i)
     {
-        munmap (entry.second->addr, entry.second->size);
-    }
+        ScopedLock<Mutex> lock (_shards[i].mutex);
 
-    _entries.clear ();
+        while (!_shards[i].entries.empty ())
+        {
+            erase (_shards[i], _shards[i].entries.begin ());
+        }
+    }
 }
 
 // =========================================================================
@@ -131,7 +242,432 @@ void Cache::clear ()
 // =========================================================================
 size_t Cache::size ()
 {
-    ScopedLock<Mutex> lock (_mutex);
+    size_t count = 0;
 
-    return _entries.size ();
+    for (size_t i = 0; i < _nshards; ++i)
+    {
+        ScopedLock<Mutex> lock (_shards[i].mutex);
+        count += _shards[i].entries.size ();
+    }
+
+    return count;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : budget
+// =========================================================================
+void Cache::budget (size_t bytes) noexcept
+{
+    _budget = bytes;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : budget
+// =========================================================================
+size_t Cache::budget () const noexcept
+{
+    return _budget;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : capacity
+// =========================================================================
+void Cache::capacity (size_t entries) noexcept
+{
+    _capacity = entries;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : capacity
+// =========================================================================
+size_t Cache::capacity () const noexcept
+{
+    return _capacity;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : revalidate
+// =========================================================================
+void Cache::revalidate (std::chrono::milliseconds interval) noexcept
+{
+    _revalidate = interval.count ();
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : revalidate
+// =========================================================================
+std::chrono::milliseconds Cache::revalidate () const noexcept
+{
+    return std::chrono::milliseconds (_revalidate.load ());
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : watch
+// =========================================================================
+int Cache::watch (Reactor& reactor)
+{
+    if (_inotify.load () != -1)
+    {
+        lastError = make_error_code (Errc::InUse);
+        return -1;
+    }
+
+    int fd = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+    if (fd == -1)
+    {
+        lastError = std::error_code (errno, std::generic_category ());  // LCOV_EXCL_LINE
+        return -1;                                                      // LCOV_EXCL_LINE
+    }
+
+    if (reactor.addHandler (fd, this) == -1)
+    {
+        close (fd);  // LCOV_EXCL_LINE
+        return -1;   // LCOV_EXCL_LINE
+    }
+
+    _reactor = &reactor;
+    _inotify.store (fd, std::memory_order_release);
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : unwatch
+// =========================================================================
+void Cache::unwatch ()
+{
+    int fd = _inotify.exchange (-1);
+    if (fd == -1)
+    {
+        return;
+    }
+
+    _reactor->delHandler (fd);
+    _reactor = nullptr;
+    close (fd);
+
+    {
+        ScopedLock<Mutex> lock (_watchMutex);
+        _watches.clear ();
+        _directories.clear ();
+    }
+
+    for (size_t i = 0; i < _nshards; ++i)
+    {
+        ScopedLock<Mutex> lock (_shards[i].mutex);
+
+        for (auto& entry : _shards[i].entries)
+        {
+            entry.second.watched = false;
+        }
+    }
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : watching
+// =========================================================================
+bool Cache::watching () const noexcept
+{
+    return _inotify.load () != -1;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : bytes
+// =========================================================================
+size_t Cache::bytes () const noexcept
+{
+    return _bytes;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : hits
+// =========================================================================
+uint64_t Cache::hits () const noexcept
+{
+    return _hits;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : misses
+// =========================================================================
+uint64_t Cache::misses () const noexcept
+{
+    return _misses;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : evictions
+// =========================================================================
+uint64_t Cache::evictions () const noexcept
+{
+    return _evictions;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : onReadable
+// =========================================================================
+void Cache::onReadable (int fd)
+{
+    alignas (struct inotify_event) char buf[4096];
+
+    for (;;)
+    {
+        ssize_t len = read (fd, buf, sizeof (buf));
+        if (len <= 0)
+        {
+            break;
+        }
+
+        for (char* ptr = buf; ptr < buf + len;)
+        {
+            struct inotify_event* event = reinterpret_cast<struct inotify_event*> (ptr);
+            ptr += sizeof (struct inotify_event) + event->len;
+
+            ++_epoch;
+
+            if (event->mask & IN_Q_OVERFLOW)
+            {
+                clear ();  // LCOV_EXCL_LINE
+            }
+            else if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT | IN_IGNORED))
+            {
+                invalidate (event->wd, {});
+            }
+            else if (event->len)
+            {
+                invalidate (event->wd, event->name);
+            }
+        }
+    }
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : watch
+// =========================================================================
+bool Cache::watch (const std::string& fileName)
+{
+    size_t pos = fileName.rfind ('/');
+    std::string directory = (pos == std::string::npos) ? "." : fileName.substr (0, pos ? pos : 1);
+    std::string name = (pos == std::string::npos) ? fileName : fileName.substr (pos + 1);
+
+    ScopedLock<Mutex> lock (_watchMutex);
+
+    int fd = _inotify.load (std::memory_order_acquire);
+    if (fd == -1)
+    {
+        return false;  // LCOV_EXCL_LINE
+    }
+
+    int wd = -1;
+
+    auto dir = _directories.find (directory);
+    if (dir == _directories.end ())
+    {
+        wd = inotify_add_watch (fd, directory.c_str (),
+                                IN_ONLYDIR | IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM |
+                                    IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF);
+        if (wd == -1)
+        {
+            return false;
+        }
+
+        _directories[directory] = wd;
+        _watches[wd].directory = directory;
+    }
+    else
+    {
+        wd = dir->second;
+    }
+
+    auto& files = _watches[wd].files;
+    auto range = files.equal_range (name);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == fileName)
+        {
+            return true;
+        }
+    }
+    files.emplace (name, fileName);
+
+    return true;
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : unwatch
+// =========================================================================
+void Cache::unwatch (const std::string& fileName)
+{
+    if (_inotify.load (std::memory_order_acquire) == -1)
+    {
+        return;
+    }
+
+    size_t pos = fileName.rfind ('/');
+    std::string directory = (pos == std::string::npos) ? "." : fileName.substr (0, pos ? pos : 1);
+    std::string name = (pos == std::string::npos) ? fileName : fileName.substr (pos + 1);
+
+    ScopedLock<Mutex> lock (_watchMutex);
+
+    auto dir = _directories.find (directory);
+    if (dir == _directories.end ())
+    {
+        return;
+    }
+
+    auto watch = _watches.find (dir->second);
+    if (watch == _watches.end ())
+    {
+        return;  // LCOV_EXCL_LINE
+    }
+
+    auto& files = watch->second.files;
+    auto range = files.equal_range (name);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (it->second == fileName)
+        {
+            files.erase (it);
+            // an entry being inserted for this file must not be trusted without stat.
+            ++_epoch;
+            break;
+        }
+    }
+
+    if (files.empty ())
+    {
+        inotify_rm_watch (_inotify.load (), dir->second);
+        _watches.erase (watch);
+        _directories.erase (dir);
+    }
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : invalidate
+// =========================================================================
+void Cache::invalidate (int wd, const std::string& name)
+{
+    std::vector<std::string> keys;
+
+    {
+        ScopedLock<Mutex> lock (_watchMutex);
+
+        auto watch = _watches.find (wd);
+        if (watch == _watches.end ())
+        {
+            return;
+        }
+
+        auto& files = watch->second.files;
+
+        if (name.empty ())
+        {
+            // the directory itself is gone.
+            for (auto const& file : files)
+            {
+                keys.push_back (file.second);
+            }
+
+            for (auto it = _directories.begin (); it != _directories.end ();)
+            {
+                it = (it->second == wd) ? _directories.erase (it) : std::next (it);
+            }
+
+            inotify_rm_watch (_inotify.load (), wd);
+            _watches.erase (watch);
+        }
+        else
+        {
+            auto range = files.equal_range (name);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                keys.push_back (it->second);
+            }
+            files.erase (range.first, range.second);
+
+            if (files.empty ())
+            {
+                _directories.erase (watch->second.directory);
+                inotify_rm_watch (_inotify.load (), wd);
+                _watches.erase (watch);
+            }
+        }
+    }
+
+    for (auto const& key : keys)
+    {
+        remove (key);
+    }
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : shard
+// =========================================================================
+Cache::Shard& Cache::shard (const std::string& fileName) noexcept
+{
+    return _shards[std::hash<std::string> () (fileName) % _nshards];
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : exceeded
+// =========================================================================
+bool Cache::exceeded () const noexcept
+{
+    size_t budget = _budget.load (), capacity = _capacity.load ();
+    return ((budget != 0) && (_bytes.load () > budget)) || ((capacity != 0) && (_count.load () > capacity));
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : erase
+// =========================================================================
+void Cache::erase (Shard& shard, std::unordered_map<std::string, CacheEntry>::iterator it, bool forget)
+{
+    if (forget)
+    {
+        unwatch (it->first);
+    }
+
+    _bytes -= it->second.file->size;
+    --_count;
+    shard.lru.erase (it->second.lru);
+    shard.entries.erase (it);
+}
+
+// =========================================================================
+//   CLASS     : Cache
+//   METHOD    : evict
+// =========================================================================
+void Cache::evict (Shard& shard, const std::string* keep)
+{
+    while (exceeded () && !shard.lru.empty ())
+    {
+        // the most recently used entry is the one to keep.
+        if ((keep != nullptr) && (shard.lru.back () == *keep))
+        {
+            break;
+        }
+
+        erase (shard, shard.entries.find (shard.lru.back ()));
+        ++_evictions;
+    }
 }
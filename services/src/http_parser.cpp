@@ -0,0 +1,822 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// libjoin.
+#include <join/http_parser.hpp>
+
+// C++.
+#include <algorithm>
+#include <streambuf>
+
+// C.
+#include <cstdint>
+
+using join::Errc;
+using join::HttpErrc;
+using join::HttpMethod;
+using join::HttpView;
+using join::HttpArena;
+using join::HttpRequestParser;
+
+namespace
+{
+    /**
+     * @brief access to the get area of a stream buffer.
+     */
+    struct GetArea : public std::streambuf
+    {
+        /**
+         * @brief get the first unread character.
+         * @param buf stream buffer.
+         * @return first unread character.
+         */
+        static const char* begin (const std::streambuf* buf) noexcept
+        {
+            return (buf->*(&GetArea::gptr)) ();
+        }
+
+        /**
+         * @brief get the end of the get area.
+         * @param buf stream buffer.
+         * @return end of the get area.
+         */
+        static const char* end (const std::streambuf* buf) noexcept
+        {
+            return (buf->*(&GetArea::egptr)) ();
+        }
+    };
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : HttpArena
+// =========================================================================
+HttpArena::HttpArena (size_t capacity)
+: _buf (new char[capacity])
+, _capacity (capacity)
+{
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : allocate
+// =========================================================================
+char* HttpArena::allocate (size_t size) noexcept
+{
+    if (size > (_capacity - _used))
+    {
+        return nullptr;
+    }
+
+    char* ptr = _buf.get () + _used;
+    _used += size;
+
+    return ptr;
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : push
+// =========================================================================
+int HttpArena::push (char c) noexcept
+{
+    if (_used == _capacity)
+    {
+        return -1;
+    }
+
+    _buf[_used++] = c;
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : current
+// =========================================================================
+char* HttpArena::current () const noexcept
+{
+    return _buf.get () + _used;
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : reset
+// =========================================================================
+void HttpArena::reset () noexcept
+{
+    _used = 0;
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : used
+// =========================================================================
+size_t HttpArena::used () const noexcept
+{
+    return _used;
+}
+
+// =========================================================================
+//   CLASS     : HttpArena
+//   METHOD    : capacity
+// =========================================================================
+size_t HttpArena::capacity () const noexcept
+{
+    return _capacity;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : HttpRequestParser
+// =========================================================================
+HttpRequestParser::HttpRequestParser (size_t capacity, size_t maxHeaders, size_t maxParameters)
+: _arena (capacity)
+, _headers (new Field[maxHeaders])
+, _maxHeaders (maxHeaders)
+, _parameters (new Field[maxParameters])
+, _maxParameters (maxParameters)
+{
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : readHeaders
+// =========================================================================
+int HttpRequestParser::readHeaders (std::istream& in)
+{
+    bool firstLine = true;
+
+    clear ();
+
+    std::istream::sentry sentry (in, true);
+    if (!sentry)
+    {
+        return -1;
+    }
+
+    std::streambuf* buf = in.rdbuf ();
+
+    for (;;)
+    {
+        char* line = _arena.current ();
+        std::streamsize total = 0;
+        bool eol = false;
+
+        // copy the line in blocks straight from the get area, up to the line feed.
+        while (!eol)
+        {
+            if (total == _maxHeaderLen)
+            {
+                join::lastError = make_error_code (Errc::MessageTooLong);
+                return -1;
+            }
+
+            if (buf->sgetc () == std::char_traits<char>::eof ())
+            {
+                in.setstate (std::ios_base::eofbit | std::ios_base::failbit);
+                return -1;
+            }
+
+            const char* data = GetArea::begin (buf);
+            std::streamsize avail = std::min (std::streamsize (GetArea::end (buf) - data), _maxHeaderLen - total);
+
+            if (avail > 0)
+            {
+                const char* lf = static_cast<const char*> (std::memchr (data, '\n', avail));
+                if (lf != nullptr)
+                {
+                    avail = lf - data + 1;
+                    eol = true;
+                }
+            }
+            else
+            {
+                // unbuffered stream.
+                avail = 1;
+                eol = (buf->sgetc () == '\n');
+            }
+
+            char* dst = _arena.allocate (avail);
+            if (dst == nullptr)
+            {
+                join::lastError = make_error_code (HttpErrc::HeaderTooLarge);
+                return -1;
+            }
+
+            buf->sgetn (dst, avail);
+            total += avail;
+        }
+
+        // drop the carriage returns, the line feed becomes the terminating null character.
+        size_t len = 0;
+        for (std::streamsize i = 0; i < (total - 1); ++i)
+        {
+            if (line[i] != '\r')
+            {
+                line[len++] = line[i];
+            }
+        }
+        line[len] = '\0';
+
+        if (firstLine)
+        {
+            if (parseFirstLine (line, len) == -1)
+            {
+                return -1;
+            }
+            firstLine = false;
+            continue;
+        }
+
+        if (len == 0)
+        {
+            break;
+        }
+
+        if (parseHeader (line, len) == -1)
+        {
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : clear
+// =========================================================================
+void HttpRequestParser::clear () noexcept
+{
+    _arena.reset ();
+    _nheaders = 0;
+    _nparameters = 0;
+    _method = HttpMethod::Get;
+    _path = HttpView ("/", 1);
+    _version = HttpView ("HTTP/1.1", 8);
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : method
+// =========================================================================
+HttpMethod HttpRequestParser::method () const noexcept
+{
+    return _method;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : path
+// =========================================================================
+HttpView HttpRequestParser::path () const noexcept
+{
+    return _path;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : version
+// =========================================================================
+HttpView HttpRequestParser::version () const noexcept
+{
+    return _version;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : hasHeader
+// =========================================================================
+bool HttpRequestParser::hasHeader (const char* name) const noexcept
+{
+    return find (_headers.get (), _nheaders, name, true) != nullptr;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : header
+// =========================================================================
+HttpView HttpRequestParser::header (const char* name) const noexcept
+{
+    const Field* field = find (_headers.get (), _nheaders, name, true);
+    return (field != nullptr) ? field->value : HttpView ();
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : headerCount
+// =========================================================================
+size_t HttpRequestParser::headerCount () const noexcept
+{
+    return _nheaders;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : headerAt
+// =========================================================================
+const HttpRequestParser::Field& HttpRequestParser::headerAt (size_t index) const noexcept
+{
+    return _headers[index];
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : hasParameter
+// =========================================================================
+bool HttpRequestParser::hasParameter (const char* name) const noexcept
+{
+    return find (_parameters.get (), _nparameters, name, false) != nullptr;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : parameter
+// =========================================================================
+HttpView HttpRequestParser::parameter (const char* name) const noexcept
+{
+    const Field* field = find (_parameters.get (), _nparameters, name, false);
+    return (field != nullptr) ? field->value : HttpView ();
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : parameterCount
+// =========================================================================
+size_t HttpRequestParser::parameterCount () const noexcept
+{
+    return _nparameters;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : parameterAt
+// =========================================================================
+const HttpRequestParser::Field& HttpRequestParser::parameterAt (size_t index) const noexcept
+{
+    return _parameters[index];
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : host
+// =========================================================================
+HttpView HttpRequestParser::host () const noexcept
+{
+    HttpView host = header ("Host");
+    if (host.empty ())
+    {
+        return {};
+    }
+
+    const char* data = host.data ();
+
+    if (data[0] == '[')
+    {
+        const char* end = static_cast<const char*> (std::memchr (data, ']', host.size ()));
+        if (end == nullptr)
+        {
+            return {};
+        }
+        return HttpView (data, end - data + 1);
+    }
+
+    const char* end = static_cast<const char*> (std::memchr (data, ':', host.size ()));
+    return HttpView (data, (end != nullptr) ? size_t (end - data) : host.size ());
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : auth
+// =========================================================================
+HttpView HttpRequestParser::auth () const noexcept
+{
+    HttpView authorization = header ("Authorization");
+    if (authorization.empty ())
+    {
+        return {};
+    }
+
+    const char* data = authorization.data ();
+    const char* end = static_cast<const char*> (std::memchr (data, ' ', authorization.size ()));
+    return HttpView (data, (end != nullptr) ? size_t (end - data) : authorization.size ());
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : credentials
+// =========================================================================
+HttpView HttpRequestParser::credentials () const noexcept
+{
+    HttpView authorization = header ("Authorization");
+    if (authorization.empty ())
+    {
+        return {};
+    }
+
+    const char* data = authorization.data ();
+    const char* beg = static_cast<const char*> (std::memchr (data, ' ', authorization.size ()));
+    if (beg == nullptr)
+    {
+        return {};
+    }
+    ++beg;
+    return HttpView (beg, authorization.size () - (beg - data));
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : contentLength
+// =========================================================================
+size_t HttpRequestParser::contentLength () const noexcept
+{
+    HttpView value = header ("Content-Length");
+    size_t length = 0;
+
+    if (value.empty ())
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < value.size (); ++i)
+    {
+        char ch = value.data ()[i];
+        if ((ch < '0') || (ch > '9') || (length > ((SIZE_MAX - (ch - '0')) / 10)))
+        {
+            return 0;
+        }
+        length = (length * 10) + (ch - '0');
+    }
+
+    return length;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : parseFirstLine
+// =========================================================================
+int HttpRequestParser::parseFirstLine (char* line, size_t len) noexcept
+{
+    char* pos1 = static_cast<char*> (std::memchr (line, ' ', len));
+    if (pos1 == nullptr)
+    {
+        join::lastError = make_error_code (HttpErrc::BadRequest);
+        return -1;
+    }
+
+    char* pos2 = static_cast<char*> (std::memchr (pos1 + 1, ' ', len - (pos1 + 1 - line)));
+    if (pos2 == nullptr)
+    {
+        join::lastError = make_error_code (HttpErrc::BadRequest);
+        return -1;
+    }
+
+    HttpView method (line, pos1 - line);
+
+    if (method == "HEAD")
+    {
+        _method = HttpMethod::Head;
+    }
+    else if (method == "GET")
+    {
+        _method = HttpMethod::Get;
+    }
+    else if (method == "PUT")
+    {
+        _method = HttpMethod::Put;
+    }
+    else if (method == "POST")
+    {
+        _method = HttpMethod::Post;
+    }
+    else if (method == "DELETE")
+    {
+        _method = HttpMethod::Delete;
+    }
+    else
+    {
+        join::lastError = make_error_code (HttpErrc::Unsupported);
+        return -1;
+    }
+
+    char* target = pos1 + 1;
+    size_t targetLen = pos2 - target;
+
+    char* query = static_cast<char*> (std::memchr (target, '?', targetLen));
+    if (query != nullptr)
+    {
+        if (parseQuery (query + 1, targetLen - (query + 1 - target)) == -1)
+        {
+            return -1;
+        }
+        targetLen = query - target;
+    }
+
+    HttpView decoded = decode (target, targetLen);
+    if (decoded.data () == nullptr)
+    {
+        return -1;
+    }
+
+    _path = normalize (const_cast<char*> (decoded.data ()), decoded.size ());
+    if (_path.data () == nullptr)
+    {
+        return -1;
+    }
+
+    _version = HttpView (pos2 + 1, len - (pos2 + 1 - line));
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : parseHeader
+// =========================================================================
+int HttpRequestParser::parseHeader (char* line, size_t len) noexcept
+{
+    char* pos = static_cast<char*> (std::memchr (line, ':', len));
+    while ((pos != nullptr) && (pos[1] != ' '))
+    {
+        pos = static_cast<char*> (std::memchr (pos + 1, ':', len - (pos + 1 - line)));
+    }
+
+    if (pos == nullptr)
+    {
+        join::lastError = make_error_code (HttpErrc::BadRequest);
+        return -1;
+    }
+
+    if (_nheaders == _maxHeaders)
+    {
+        join::lastError = make_error_code (HttpErrc::HeaderTooLarge);
+        return -1;
+    }
+
+    *pos = '\0';
+
+    Field& field = _headers[_nheaders++];
+    field.name = HttpView (line, pos - line);
+    field.value = HttpView (pos + 2, len - (pos + 2 - line));
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : parseQuery
+// =========================================================================
+int HttpRequestParser::parseQuery (const char* query, size_t len) noexcept
+{
+    size_t pos = 0;
+
+    for (;;)
+    {
+        const char* equal = static_cast<const char*> (std::memchr (query + pos, '=', len - pos));
+        if (equal == nullptr)
+        {
+            break;
+        }
+
+        size_t equalPos = equal - query;
+
+        const char* sep = static_cast<const char*> (std::memchr (equal + 1, '&', len - equalPos - 1));
+        size_t sepPos = (sep != nullptr) ? size_t (sep - query) : len;
+
+        if (_nparameters == _maxParameters)
+        {
+            join::lastError = make_error_code (HttpErrc::UriTooLong);
+            return -1;
+        }
+
+        Field& field = _parameters[_nparameters++];
+
+        field.name = decode (query + pos, equalPos - pos);
+        if (field.name.data () == nullptr)
+        {
+            return -1;
+        }
+
+        field.value = decode (query + equalPos + 1, sepPos - equalPos - 1);
+        if (field.value.data () == nullptr)
+        {
+            return -1;
+        }
+
+        if (sepPos == len)
+        {
+            break;
+        }
+
+        pos = sepPos + 1;
+    }
+
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : hexValue
+// =========================================================================
+static inline unsigned int hexValue (char ch) noexcept
+{
+    if ((ch >= '0') && (ch <= '9'))
+    {
+        return ch - '0';
+    }
+    if ((ch >= 'a') && (ch <= 'f'))
+    {
+        return ch - 'a' + 10;
+    }
+    if ((ch >= 'A') && (ch <= 'F'))
+    {
+        return ch - 'A' + 10;
+    }
+    return 0;
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : decode
+// =========================================================================
+HttpView HttpRequestParser::decode (const char* data, size_t len) noexcept
+{
+    char* out = _arena.allocate (len + 1);
+    if (out == nullptr)
+    {
+        join::lastError = make_error_code (HttpErrc::HeaderTooLarge);
+        return HttpView (nullptr, 0);
+    }
+
+    size_t size = 0, pos = 0;
+
+    while (pos < len)
+    {
+        if (data[pos] == '%')
+        {
+            unsigned int dec1 = (++pos < len) ? hexValue (data[pos]) : 0;
+            unsigned int dec2 = (++pos < len) ? hexValue (data[pos]) : 0;
+            out[size++] = static_cast<char> ((dec1 << 4) + dec2);
+            ++pos;
+        }
+        else
+        {
+            out[size++] = data[pos++];
+        }
+    }
+
+    out[size] = '\0';
+
+    return HttpView (out, size);
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : startsWith
+// =========================================================================
+static inline bool startsWith (const char* data, size_t len, const char* prefix, size_t size) noexcept
+{
+    return (len >= size) && (std::memcmp (data, prefix, size) == 0);
+}
+
+// =========================================================================
+//   CLASS     :
+//   METHOD    : removeLastSegment
+// =========================================================================
+static inline void removeLastSegment (const char* data, size_t& len) noexcept
+{
+    while (len > 0)
+    {
+        if (data[--len] == '/')
+        {
+            break;
+        }
+    }
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : normalize
+// =========================================================================
+HttpView HttpRequestParser::normalize (char* data, size_t len) noexcept
+{
+    // collapse duplicate slashes in place.
+    size_t size = 0;
+    for (size_t i = 0; i < len; ++i)
+    {
+        if ((data[i] != '/') || (size == 0) || (data[size - 1] != '/'))
+        {
+            data[size++] = data[i];
+        }
+    }
+
+    char* out = _arena.allocate (size + 1);
+    if (out == nullptr)
+    {
+        join::lastError = make_error_code (HttpErrc::HeaderTooLarge);
+        return HttpView (nullptr, 0);
+    }
+
+    size_t outLen = 0;
+
+    // rfc3986 (see https://tools.ietf.org/html/rfc3986#section-5.2.4).
+    while (size > 0)
+    {
+        if (startsWith (data, size, "../", 3))
+        {
+            data += 3;
+            size -= 3;
+        }
+        else if (startsWith (data, size, "./", 2))
+        {
+            data += 2;
+            size -= 2;
+        }
+        else if (startsWith (data, size, "/./", 3))
+        {
+            data += 2;
+            size -= 2;
+        }
+        else if ((size == 2) && startsWith (data, size, "/.", 2))
+        {
+            data[1] = '/';
+            data += 1;
+            size -= 1;
+        }
+        else if (startsWith (data, size, "/../", 4))
+        {
+            data += 3;
+            size -= 3;
+            removeLastSegment (out, outLen);
+        }
+        else if ((size == 3) && startsWith (data, size, "/..", 3))
+        {
+            data[2] = '/';
+            data += 2;
+            size -= 2;
+            removeLastSegment (out, outLen);
+        }
+        else if (std::find_if (data, data + size, [] (char ch) { return ch != '.'; }) == data + size)
+        {
+            size = 0;
+        }
+        else
+        {
+            const char* slash = static_cast<const char*> (
+                std::memchr (data + (data[0] == '/'), '/', size - (data[0] == '/')));
+            size_t pos = (slash != nullptr) ? size_t (slash - data) : size;
+            std::memcpy (out + outLen, data, pos);
+            outLen += pos;
+            data += pos;
+            size -= pos;
+        }
+    }
+
+    out[outLen] = '\0';
+
+    return HttpView (out, outLen);
+}
+
+// =========================================================================
+//   CLASS     : HttpRequestParser
+//   METHOD    : find
+// =========================================================================
+const HttpRequestParser::Field* HttpRequestParser::find (const Field* fields, size_t count, const char* name,
+                                                         bool nocase) noexcept
+{
+    size_t len = std::strlen (name);
+
+    for (size_t i = count; i > 0; --i)
+    {
+        const Field& field = fields[i - 1];
+        if (nocase ? field.name.equalsNoCase (name, len) : field.name.equals (name, len))
+        {
+            return &field;
+        }
+    }
+
+    return nullptr;
+}
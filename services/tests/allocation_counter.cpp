@@ -0,0 +1,68 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// C++.
+#include <cstdlib>
+#include <atomic>
+#include <new>
+
+// the replacement operators live in their own translation unit so that the
+// optimizer never sees a malloc/free pair it could flag as mismatched.
+
+/// number of heap allocations.
+std::atomic<size_t> allocations{0};
+
+/**
+ * @brief count heap allocations.
+ * @param size size to allocate.
+ * @return allocated memory.
+ */
+void* operator new (std::size_t size)
+{
+    ++allocations;
+    void* ptr = std::malloc (size ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc ();
+    }
+    return ptr;
+}
+
+/**
+ * @brief release memory.
+ * @param ptr memory to release.
+ */
+void operator delete (void* ptr) noexcept
+{
+    std::free (ptr);
+}
+
+/**
+ * @brief release memory.
+ * @param ptr memory to release.
+ */
+void operator delete (void* ptr, std::size_t) noexcept
+{
+    std::free (ptr);
+}
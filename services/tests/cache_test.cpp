@@ -31,12 +31,16 @@
 // C++.
 #include <iostream>
 #include <fstream>
+#include <thread>
 
 // C.
 #include <unistd.h>
+#include <dirent.h>
 #include <fcntl.h>
 
+using join::ReactorThread;
 using join::Cache;
+using join::Errc;
 
 /**
  * @brief Class used to test cache.
@@ -53,8 +57,8 @@ public:
         ASSERT_TRUE (writeFile (other, otherContent));
 
         struct stat sbuf;
-        ASSERT_NE (nullptr, cache.get (path, sbuf));
-        ASSERT_NE (nullptr, cache.get (other, sbuf));
+        ASSERT_NE (nullptr, cache.acquire (path, sbuf));
+        ASSERT_NE (nullptr, cache.acquire (other, sbuf));
     }
 
     /**
@@ -91,6 +95,35 @@ public:
         return true;
     }
 
+    /**
+     * @brief count the inotify watches of the process.
+     * @return number of inotify watches.
+     */
+    static size_t watches ()
+    {
+        size_t count = 0;
+
+        DIR* dir = ::opendir ("/proc/self/fdinfo");
+        if (dir == nullptr)
+        {
+            return count;
+        }
+
+        while (struct dirent* entry = ::readdir (dir))
+        {
+            std::ifstream info (std::string ("/proc/self/fdinfo/") + entry->d_name);
+            std::string line;
+            while (std::getline (info, line))
+            {
+                count += (line.compare (0, 11, "inotify wd:") == 0);
+            }
+        }
+
+        ::closedir (dir);
+
+        return count;
+    }
+
 protected:
     // server instance.
     static Cache cache;
@@ -135,8 +168,10 @@ const std::string CacheTest::other = base + stem + ".other";
 const std::string CacheTest::otherContent = "other test string";
 
 /**
- * @brief Test get method.
+ * @brief Test get method (deprecated).
  */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
 TEST_F (CacheTest, get)
 {
     struct stat sbuf;
@@ -161,6 +196,228 @@ TEST_F (CacheTest, get)
     ASSERT_NE (data, nullptr);
     ASSERT_EQ (std::string (data, sbuf.st_size), otherContent);
 }
+#pragma GCC diagnostic pop
+
+/**
+ * @brief Test acquire method.
+ */
+TEST_F (CacheTest, acquire)
+{
+    struct stat sbuf;
+
+    ASSERT_EQ (cache.acquire (bad, sbuf), nullptr);
+    ASSERT_EQ (cache.acquire (base, sbuf), nullptr);
+
+    Cache::FilePtr file = cache.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    ASSERT_EQ (file->size, sbuf.st_size);
+    ASSERT_NE (file->fd, -1);
+
+    // the file stays mapped after its entry is removed.
+    cache.remove (path);
+    ASSERT_EQ (std::string (static_cast<const char*> (file->addr), file->size), content);
+}
+
+/**
+ * @brief Test budget and eviction.
+ */
+TEST_F (CacheTest, budget)
+{
+    struct stat sbuf;
+    Cache bounded (content.size () + otherContent.size (), std::chrono::milliseconds::zero (), 1);
+    EXPECT_EQ (bounded.budget (), content.size () + otherContent.size ());
+
+    ASSERT_NE (bounded.acquire (path, sbuf), nullptr);
+    ASSERT_NE (bounded.acquire (other, sbuf), nullptr);
+    EXPECT_EQ (bounded.size (), 2);
+    EXPECT_EQ (bounded.bytes (), content.size () + otherContent.size ());
+    EXPECT_EQ (bounded.evictions (), 0);
+
+    // path is now the most recently used.
+    ASSERT_NE (bounded.acquire (path, sbuf), nullptr);
+
+    bounded.budget (content.size ());
+    ASSERT_TRUE (writeFile (other, content));
+    ASSERT_NE (bounded.acquire (other, sbuf), nullptr);
+    EXPECT_EQ (bounded.size (), 1);
+    EXPECT_EQ (bounded.bytes (), content.size ());
+    EXPECT_EQ (bounded.evictions (), 1);
+
+    bounded.budget (0);
+    ASSERT_NE (bounded.acquire (path, sbuf), nullptr);
+    EXPECT_EQ (bounded.size (), 2);
+
+    bounded.clear ();
+    EXPECT_EQ (bounded.bytes (), 0);
+}
+
+/**
+ * @brief Test capacity and eviction.
+ */
+TEST_F (CacheTest, capacity)
+{
+    struct stat sbuf;
+    Cache bounded (0, std::chrono::milliseconds::zero (), 1);
+    EXPECT_EQ (bounded.capacity (), 0);
+
+    bounded.capacity (1);
+    EXPECT_EQ (bounded.capacity (), 1);
+
+    Cache::FilePtr file = bounded.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    ASSERT_NE (bounded.acquire (other, sbuf), nullptr);
+    EXPECT_EQ (bounded.size (), 1);
+    EXPECT_EQ (bounded.evictions (), 1);
+
+    // the evicted file stays mapped while referenced.
+    ASSERT_EQ (std::string (static_cast<const char*> (file->addr), file->size), content);
+
+    bounded.capacity (0);
+    ASSERT_NE (bounded.acquire (path, sbuf), nullptr);
+    EXPECT_EQ (bounded.size (), 2);
+}
+
+/**
+ * @brief Test revalidation interval and counters.
+ */
+TEST_F (CacheTest, revalidate)
+{
+    struct stat sbuf;
+    Cache lazy (0, std::chrono::seconds (60));
+    EXPECT_EQ (lazy.revalidate (), std::chrono::seconds (60));
+
+    Cache::FilePtr file = lazy.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    EXPECT_EQ (lazy.misses (), 1);
+    EXPECT_EQ (lazy.hits (), 0);
+
+    // not checked on disk until the interval elapses.
+    ASSERT_TRUE (writeFile (path, otherContent));
+    file = lazy.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    ASSERT_EQ (sbuf.st_size, content.size ());
+    EXPECT_EQ (lazy.hits (), 1);
+
+    lazy.revalidate (std::chrono::milliseconds::zero ());
+    file = lazy.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    ASSERT_EQ (std::string (static_cast<const char*> (file->addr), file->size), otherContent);
+    EXPECT_EQ (lazy.misses (), 2);
+
+    file = lazy.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    EXPECT_EQ (lazy.hits (), 2);
+}
+
+/**
+ * @brief Test inotify invalidation.
+ */
+TEST_F (CacheTest, watch)
+{
+    struct stat sbuf;
+    Cache watched;
+
+    ASSERT_FALSE (watched.watching ());
+    ASSERT_EQ (watched.watch (ReactorThread::reactor ()), 0) << join::lastError.message ();
+    ASSERT_EQ (watched.watch (ReactorThread::reactor ()), -1);
+    ASSERT_EQ (join::lastError, Errc::InUse);
+    ASSERT_TRUE (watched.watching ());
+
+    ASSERT_NE (watched.acquire (path, sbuf), nullptr);
+    ASSERT_NE (watched.acquire (other, sbuf), nullptr);
+    EXPECT_EQ (watched.misses (), 2);
+
+    // served without checking the file on disk.
+    ASSERT_NE (watched.acquire (path, sbuf), nullptr);
+    EXPECT_EQ (watched.hits (), 1);
+    EXPECT_EQ (sbuf.st_size, content.size ());
+
+    // modified file is dropped.
+    ASSERT_TRUE (writeFile (path, otherContent));
+    for (int i = 0; (i < 100) && (watched.size () != 1); ++i)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (10));
+    }
+    EXPECT_EQ (watched.size (), 1);
+
+    // let the remaining events of the write drain.
+    std::this_thread::sleep_for (std::chrono::milliseconds (100));
+
+    Cache::FilePtr file = watched.acquire (path, sbuf);
+    ASSERT_NE (file, nullptr);
+    ASSERT_EQ (std::string (static_cast<const char*> (file->addr), file->size), otherContent);
+    EXPECT_EQ (watched.misses (), 3);
+
+    // deleted file is dropped.
+    ::unlink (other.c_str ());
+    for (int i = 0; (i < 100) && (watched.size () != 1); ++i)
+    {
+        std::this_thread::sleep_for (std::chrono::milliseconds (10));
+    }
+    EXPECT_EQ (watched.size (), 1);
+    ASSERT_EQ (watched.acquire (other, sbuf), nullptr);
+
+    watched.unwatch ();
+    ASSERT_FALSE (watched.watching ());
+    ASSERT_NE (watched.acquire (path, sbuf), nullptr);
+}
+
+/**
+ * @brief Test that evicted and removed files are no longer watched.
+ */
+TEST_F (CacheTest, unwatchErased)
+{
+    struct stat sbuf;
+    Cache watched;
+    size_t before = watches ();
+
+    ASSERT_EQ (watched.watch (ReactorThread::reactor ()), 0) << join::lastError.message ();
+    watched.capacity (1);
+
+    ASSERT_NE (watched.acquire (path, sbuf), nullptr);
+    EXPECT_EQ (watches (), before + 1);
+
+    // the evicted file leaves the directory watched for the other one only.
+    ASSERT_NE (watched.acquire (other, sbuf), nullptr);
+    EXPECT_EQ (watched.size (), 1);
+    EXPECT_EQ (watched.evictions (), 1);
+    EXPECT_EQ (watches (), before + 1);
+
+    // the directory is no longer watched with its last file.
+    watched.remove (other);
+    EXPECT_EQ (watched.size (), 0);
+    EXPECT_EQ (watches (), before);
+
+    ASSERT_NE (watched.acquire (path, sbuf), nullptr);
+    EXPECT_EQ (watches (), before + 1);
+    watched.clear ();
+    EXPECT_EQ (watches (), before);
+
+    // a file that can't be cached isn't watched.
+    ASSERT_EQ (watched.acquire (bad, sbuf), nullptr);
+    EXPECT_EQ (watches (), before);
+}
+
+/**
+ * @brief Test destroying a watching cache after its reactor was stopped.
+ */
+TEST_F (CacheTest, stoppedReactor)
+{
+    join::Reactor reactor;
+    std::thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    {
+        struct stat sbuf;
+        Cache watched;
+        ASSERT_EQ (watched.watch (reactor), 0) << join::lastError.message ();
+        ASSERT_NE (watched.acquire (path, sbuf), nullptr);
+
+        reactor.stop ();
+        th.join ();
+    }
+}
 
 /**
  * @brief Test remove method.
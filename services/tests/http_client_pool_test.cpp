@@ -0,0 +1,438 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/http_client_pool.hpp>
+#include <join/http_server.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <fstream>
+#include <thread>
+
+using namespace std::chrono;
+
+using join::ReactorThread;
+using join::IpAddress;
+using join::HttpMethod;
+using join::HttpRequest;
+using join::HttpResponse;
+using join::Errc;
+using join::Http;
+
+/**
+ * @brief Class used to test the HTTP client pool.
+ */
+class HttpClientPoolTest : public Http::Server, public ::testing::Test
+{
+public:
+    /**
+     * @brief create the test instance.
+     */
+    HttpClientPoolTest ()
+    : Http::Server (_workers)
+    , _pool (_maxPerHost)
+    {
+    }
+
+    /**
+     * @brief Set up test case.
+     */
+    static void SetUpTestCase ()
+    {
+        mkdir (_basePath.c_str (), 0777);
+        std::ofstream outFile (_sampleFile.c_str ());
+        if (outFile.is_open ())
+        {
+            outFile << _sample;
+            outFile.close ();
+        }
+    }
+
+    /**
+     * @brief Tear down test case.
+     */
+    static void TearDownTestCase ()
+    {
+        unlink (_sampleFile.c_str ());
+        rmdir (_basePath.c_str ());
+    }
+
+protected:
+    /**
+     * @brief Sets up the test fixture.
+     */
+    void SetUp ()
+    {
+        this->baseLocation (_basePath);
+        this->keepAlive (seconds (_timeout), _max);
+        this->addAlias ("/", "", _sampleFile);
+        ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}, ReactorThread::reactor ()), 0)
+            << join::lastError.message ();
+    }
+
+    /**
+     * @brief Tears down the test fixture.
+     */
+    void TearDown ()
+    {
+        _pool.clear ();
+        this->close ();
+    }
+
+    /**
+     * @brief get the sample using the given client.
+     * @param client client.
+     */
+    static void get (Http::Client& client)
+    {
+        HttpRequest request;
+        request.method (HttpMethod::Get);
+        ASSERT_EQ (client.send (request), 0) << join::lastError.message ();
+
+        HttpResponse response;
+        ASSERT_EQ (client.receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+
+        std::string payload;
+        payload.resize (response.contentLength ());
+        client.read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, _sample);
+    }
+
+    /// client pool.
+    Http::ClientPool _pool;
+
+    /// base path.
+    static const std::string _basePath;
+
+    /// sample.
+    static const std::string _sample;
+
+    /// sample path.
+    static const std::string _sampleFile;
+
+    /// server hostname.
+    static const std::string _host;
+
+    /// server port.
+    static const uint16_t _port;
+
+    /// server keep alive timeout.
+    static const int _timeout;
+
+    /// server keep alive max requests.
+    static const int _max;
+
+    /// number of workers.
+    static const size_t _workers;
+
+    /// maximum number of connections per host.
+    static const size_t _maxPerHost;
+};
+
+const std::string HttpClientPoolTest::_basePath = "/tmp/www_pool";
+const std::string HttpClientPoolTest::_sample = "<html><body><h1>It works!</h1></body></html>";
+const std::string HttpClientPoolTest::_sampleFile = _basePath + "/sample.html";
+const std::string HttpClientPoolTest::_host = "127.0.0.1";
+const uint16_t HttpClientPoolTest::_port = 5030;
+const int HttpClientPoolTest::_timeout = 5;
+const int HttpClientPoolTest::_max = 20;
+const size_t HttpClientPoolTest::_workers = 2;
+const size_t HttpClientPoolTest::_maxPerHost = 2;
+
+/**
+ * @brief Test connection reuse.
+ */
+TEST_F (HttpClientPoolTest, acquire)
+{
+    Http::Client* client = nullptr;
+
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+        ASSERT_EQ (_pool.leased (_host, _port), 1);
+        ASSERT_NO_FATAL_FAILURE (get (*lease));
+        client = &*lease;
+    }
+
+    ASSERT_EQ (_pool.leased (_host, _port), 0);
+    ASSERT_EQ (_pool.idle (_host, _port), 1);
+
+    auto lease = _pool.acquire (_host, _port);
+    ASSERT_TRUE (lease) << join::lastError.message ();
+    ASSERT_EQ (&*lease, client);
+    ASSERT_EQ (_pool.idle (_host, _port), 0);
+    ASSERT_NO_FATAL_FAILURE (get (*lease));
+
+    // a connection closed by the server is not given back.
+    HttpRequest request;
+    request.method (HttpMethod::Head);
+    request.header ("Connection", "close");
+    ASSERT_EQ (lease->send (request), 0) << join::lastError.message ();
+    HttpResponse response;
+    ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+    lease.release ();
+
+    ASSERT_FALSE (lease);
+    ASSERT_EQ (_pool.leased (_host, _port), 0);
+    ASSERT_EQ (_pool.idle (_host, _port), 0);
+}
+
+/**
+ * @brief Test per host limit.
+ */
+TEST_F (HttpClientPoolTest, limit)
+{
+    auto lease1 = _pool.acquire (_host, _port);
+    ASSERT_TRUE (lease1) << join::lastError.message ();
+    auto lease2 = _pool.acquire (_host, _port);
+    ASSERT_TRUE (lease2) << join::lastError.message ();
+
+    auto lease3 = _pool.acquire (_host, _port, milliseconds (50));
+    ASSERT_FALSE (lease3);
+    ASSERT_EQ (join::lastError, Errc::TimedOut);
+
+    // another host has its own limit.
+    auto other = _pool.acquire ("localhost", _port, milliseconds::zero ());
+    ASSERT_TRUE (other) << join::lastError.message ();
+
+    std::thread th ([&] () {
+        std::this_thread::sleep_for (milliseconds (50));
+        lease1.release ();
+    });
+    lease3 = _pool.acquire (_host, _port, seconds (5));
+    th.join ();
+    ASSERT_TRUE (lease3) << join::lastError.message ();
+    ASSERT_EQ (_pool.leased (_host, _port), 2);
+}
+
+/**
+ * @brief Test that a connection with an unread payload is not reused.
+ */
+TEST_F (HttpClientPoolTest, drain)
+{
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+
+        HttpRequest request;
+        request.method (HttpMethod::Get);
+        ASSERT_EQ (lease->send (request), 0) << join::lastError.message ();
+        HttpResponse response;
+        ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+        ASSERT_GT (response.contentLength (), 0u);
+    }
+
+    ASSERT_EQ (_pool.leased (_host, _port), 0);
+    ASSERT_EQ (_pool.idle (_host, _port), 0);
+
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+        ASSERT_NO_FATAL_FAILURE (get (*lease));
+
+        // the response to a HEAD request has no payload.
+        HttpRequest request;
+        request.method (HttpMethod::Head);
+        ASSERT_EQ (lease->send (request), 0) << join::lastError.message ();
+        HttpResponse response;
+        ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+    }
+
+    ASSERT_EQ (_pool.idle (_host, _port), 1);
+
+    auto lease = _pool.acquire (_host, _port);
+    ASSERT_TRUE (lease) << join::lastError.message ();
+    ASSERT_NO_FATAL_FAILURE (get (*lease));
+}
+
+/**
+ * @brief Test that an idle connection closed by the server is not handed out.
+ */
+TEST_F (HttpClientPoolTest, peerClosed)
+{
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+        ASSERT_NO_FATAL_FAILURE (get (*lease));
+    }
+
+    ASSERT_EQ (_pool.idle (_host, _port), 1);
+
+    // restart the server, closing its connections before the keep alive timeout.
+    this->close ();
+    ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}, ReactorThread::reactor ()), 0)
+        << join::lastError.message ();
+    std::this_thread::sleep_for (milliseconds (100));
+
+    auto lease = _pool.acquire (_host, _port);
+    ASSERT_TRUE (lease) << join::lastError.message ();
+    ASSERT_FALSE (lease->connected ());
+    ASSERT_EQ (_pool.idle (_host, _port), 0);
+    ASSERT_EQ (_pool.leased (_host, _port), 1);
+    ASSERT_NO_FATAL_FAILURE (get (*lease));
+}
+
+/**
+ * @brief Test that the payload end of pipelined responses follows the method of each request.
+ */
+TEST_F (HttpClientPoolTest, pipelinedHead)
+{
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+
+        HttpRequest get;
+        get.method (HttpMethod::Get);
+        HttpRequest head;
+        head.method (HttpMethod::Head);
+
+        ASSERT_EQ (lease->queue (get), 0) << join::lastError.message ();
+        ASSERT_EQ (lease->queue (head), 0) << join::lastError.message ();
+        ASSERT_EQ (lease->pending (), 2);
+
+        HttpResponse response;
+        ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (lease->pending (), 1);
+        ASSERT_GT (response.contentLength (), 0u);
+        ASSERT_FALSE (lease->drained ());
+
+        std::string payload;
+        payload.resize (response.contentLength ());
+        lease->read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, _sample);
+
+        ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (lease->pending (), 0);
+        ASSERT_GT (response.contentLength (), 0u);
+        ASSERT_TRUE (lease->drained ());
+    }
+
+    ASSERT_EQ (_pool.idle (_host, _port), 1);
+
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+
+        HttpRequest head;
+        head.method (HttpMethod::Head);
+        HttpRequest get;
+        get.method (HttpMethod::Get);
+
+        ASSERT_EQ (lease->queue (head), 0) << join::lastError.message ();
+        ASSERT_EQ (lease->queue (get), 0) << join::lastError.message ();
+
+        HttpResponse response;
+        ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+        ASSERT_FALSE (lease->drained ());
+
+        std::string payload;
+        payload.resize (response.contentLength ());
+        lease->read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, _sample);
+        ASSERT_TRUE (lease->drained ());
+    }
+
+    ASSERT_EQ (_pool.idle (_host, _port), 1);
+
+    auto lease = _pool.acquire (_host, _port);
+    ASSERT_TRUE (lease) << join::lastError.message ();
+    ASSERT_NO_FATAL_FAILURE (get (*lease));
+}
+
+/**
+ * @brief Test connection warm up and idle eviction.
+ */
+TEST_F (HttpClientPoolTest, warm)
+{
+    ASSERT_EQ (_pool.idleTimeout (), seconds (5));
+    _pool.idleTimeout (seconds (30));
+    ASSERT_EQ (_pool.warm (_host, _port, 4), 0) << join::lastError.message ();
+    ASSERT_EQ (_pool.idle (_host, _port), _maxPerHost);
+    ASSERT_EQ (_pool.leased (_host, _port), 0);
+
+    // warmed connections get the pool idle timeout.
+    std::this_thread::sleep_for (milliseconds (1500));
+    ASSERT_EQ (_pool.evict (), 0);
+    ASSERT_EQ (_pool.idle (_host, _port), _maxPerHost);
+
+    {
+        auto lease = _pool.acquire (_host, _port);
+        ASSERT_TRUE (lease) << join::lastError.message ();
+        ASSERT_TRUE (lease->connected ());
+        uint16_t local = lease->localEndpoint ().port ();
+        ASSERT_NO_FATAL_FAILURE (get (*lease));
+        ASSERT_EQ (lease->localEndpoint ().port (), local);
+        ASSERT_EQ (lease->keepAliveTimeout (), seconds (_timeout));
+    }
+
+    std::this_thread::sleep_for (milliseconds (1500));
+    ASSERT_EQ (_pool.evict (), 0);
+    ASSERT_EQ (_pool.idle (_host, _port), _maxPerHost);
+
+    _pool.clear ();
+    _pool.idleTimeout (seconds (1));
+    ASSERT_EQ (_pool.warm (_host, _port), 0) << join::lastError.message ();
+    std::this_thread::sleep_for (milliseconds (2100));
+    ASSERT_EQ (_pool.evict (), 1);
+    ASSERT_EQ (_pool.idle (_host, _port), 0);
+
+    // lowering the host limit below the number of connections doesn't warm any.
+    auto lease1 = _pool.acquire (_host, _port);
+    auto lease2 = _pool.acquire (_host, _port);
+    _pool.maxPerHost (1);
+    ASSERT_EQ (_pool.warm (_host, _port, 2), 0) << join::lastError.message ();
+    ASSERT_EQ (_pool.idle (_host, _port), 0);
+    ASSERT_EQ (_pool.leased (_host, _port), 2);
+}
+
+/**
+ * @brief Test that a failing factory gives the slot back.
+ */
+TEST_F (HttpClientPoolTest, factory)
+{
+    Http::ClientPool pool (
+        [] (const std::string&, uint16_t) -> Http::ClientPool::ClientPtr {
+            throw std::runtime_error ("failed");
+        },
+        1);
+
+    ASSERT_THROW (pool.acquire (_host, _port), std::runtime_error);
+    ASSERT_EQ (pool.leased (_host, _port), 0);
+    ASSERT_THROW (pool.warm (_host, _port), std::runtime_error);
+    ASSERT_EQ (pool.leased (_host, _port), 0);
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
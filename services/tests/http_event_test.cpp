@@ -0,0 +1,447 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/http_client.hpp>
+#include <join/http_server.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <thread>
+
+using namespace std::chrono;
+
+using join::ReactorThread;
+using join::ScopedLock;
+using join::Mutex;
+using join::IpAddress;
+using join::HttpMethod;
+using join::HttpRequest;
+using join::HttpResponse;
+using join::Http;
+using join::Tcp;
+
+/**
+ * @brief Class used to inspect the resources held by a connection.
+ */
+struct ConnectionProbe : public Http::Worker
+{
+    /**
+     * @brief check if a connection holds a request parser or stream buffers.
+     * @param worker connection.
+     * @return true if the connection holds a request parser or stream buffers.
+     */
+    static bool holdsResources (Http::Worker* worker)
+    {
+        return ((worker->*(&ConnectionProbe::_request)) != nullptr) ||
+               (worker->*(&ConnectionProbe::_sockbuf)).hasBuffer ();
+    }
+};
+
+/**
+ * @brief Class used to test the event-driven HTTP server.
+ */
+class HttpEventTest : public Http::Server, public ::testing::Test
+{
+public:
+    /**
+     * @brief create the test instance.
+     */
+    HttpEventTest ()
+    : Http::Server (_workers)
+    {
+    }
+
+    /**
+     * @brief Set up test case.
+     */
+    static void SetUpTestCase ()
+    {
+        mkdir (_basePath.c_str (), 0777);
+        std::ofstream outFile (_sampleFile.c_str ());
+        if (outFile.is_open ())
+        {
+            outFile << _sample;
+            outFile.close ();
+        }
+    }
+
+    /**
+     * @brief Tear down test case.
+     */
+    static void TearDownTestCase ()
+    {
+        unlink (_sampleFile.c_str ());
+        rmdir (_basePath.c_str ());
+    }
+
+protected:
+    /**
+     * @brief Sets up the test fixture.
+     */
+    void SetUp ()
+    {
+        this->baseLocation (_basePath);
+        this->keepAlive (seconds (_timeout), _max);
+        this->addAlias ("/", "", _sampleFile);
+        this->addExecute (HttpMethod::Post, "/exec/", "post", postHandler);
+        ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}, ReactorThread::reactor ()), 0)
+            << join::lastError.message ();
+    }
+
+    /**
+     * @brief Tears down the test fixture.
+     */
+    void TearDown ()
+    {
+        this->close ();
+    }
+
+    /**
+     * @brief wait until the parked connections gave their request parser and stream buffers back.
+     * @return true if no connection holds a request parser or stream buffers.
+     */
+    bool resourcesReleased ()
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            {
+                ScopedLock<Mutex> lock (this->_connMutex);
+                if (std::none_of (this->_connections.begin (), this->_connections.end (), [] (const auto& connection) {
+                        return ConnectionProbe::holdsResources (connection.first);
+                    }))
+                {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for (milliseconds (10));
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief handle dynamic post content.
+     * @param worker worker context.
+     */
+    static void postHandler (Http::Worker* worker)
+    {
+        std::string data;
+        data.resize (4);
+        worker->read (&data[0], data.size ());
+        if (data == "test")
+        {
+            worker->sendHeaders ();
+        }
+        else
+        {
+            worker->sendError ("400", "Bad Request");
+        }
+        worker->flush ();
+    }
+
+    /// base path.
+    static const std::string _basePath;
+
+    /// sample.
+    static const std::string _sample;
+
+    /// sample path.
+    static const std::string _sampleFile;
+
+    /// server hostname.
+    static const std::string _host;
+
+    /// server port.
+    static const uint16_t _port;
+
+    /// server keep alive timeout.
+    static const int _timeout;
+
+    /// server keep alive max requests.
+    static const int _max;
+
+    /// number of workers.
+    static const size_t _workers;
+};
+
+const std::string HttpEventTest::_basePath = "/tmp/www_event";
+const std::string HttpEventTest::_sample = "<html><body><h1>It works!</h1></body></html>";
+const std::string HttpEventTest::_sampleFile = _basePath + "/sample.html";
+const std::string HttpEventTest::_host = "127.0.0.1";
+const uint16_t HttpEventTest::_port = 5010;
+const int HttpEventTest::_timeout = 1;
+const int HttpEventTest::_max = 20;
+const size_t HttpEventTest::_workers = 2;
+
+/**
+ * @brief Test get
+ */
+TEST_F (HttpEventTest, get)
+{
+    // cached files keep their descriptor open.
+    ASSERT_GT (this->cache ().capacity (), 0u);
+
+    Http::Client client (_host, _port);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        HttpRequest request;
+        request.method (HttpMethod::Get);
+        ASSERT_EQ (client.send (request), 0) << join::lastError.message ();
+
+        HttpResponse response;
+        ASSERT_EQ (client.receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+        ASSERT_EQ (response.reason (), "OK");
+
+        ASSERT_EQ (response.contentLength (), _sample.size ());
+        std::string payload;
+        payload.resize (_sample.size ());
+        client.read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, _sample);
+    }
+
+    client.close ();
+    ASSERT_TRUE (client.good ()) << join::lastError.message ();
+}
+
+/**
+ * @brief Test post
+ */
+TEST_F (HttpEventTest, post)
+{
+    Http::Client client (_host, _port);
+
+    HttpRequest request;
+    request.method (HttpMethod::Post);
+    request.path ("/exec/post");
+    request.header ("Content-Length", "4");
+    ASSERT_EQ (client.send (request), 0) << join::lastError.message ();
+    ASSERT_TRUE (client.write ("test", 4)) << join::lastError.message ();
+    client.flush ();
+
+    HttpResponse response;
+    ASSERT_EQ (client.receive (response), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+    ASSERT_EQ (response.reason (), "OK");
+
+    client.close ();
+    ASSERT_TRUE (client.good ()) << join::lastError.message ();
+}
+
+/**
+ * @brief Test request split across several reads
+ */
+TEST_F (HttpEventTest, partial)
+{
+    Tcp::Stream stream;
+    stream.connect ({"127.0.0.1", _port});
+    ASSERT_TRUE (stream.connected ()) << join::lastError.message ();
+
+    stream << "GET / HTTP/1.1\r\nHo" << std::flush;
+    std::this_thread::sleep_for (milliseconds (50));
+    stream << "st: localhost\r\n\r" << std::flush;
+    std::this_thread::sleep_for (milliseconds (50));
+    stream << "\n" << std::flush;
+
+    HttpResponse response;
+    ASSERT_EQ (response.readHeaders (stream), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+    ASSERT_EQ (response.contentLength (), _sample.size ());
+
+    stream.close ();
+}
+
+/**
+ * @brief Test pipelined requests
+ */
+TEST_F (HttpEventTest, pipeline)
+{
+    Tcp::Stream stream;
+    stream.connect ({"127.0.0.1", _port});
+    ASSERT_TRUE (stream.connected ()) << join::lastError.message ();
+
+    stream << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n"
+           << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n"
+           << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n"
+           << std::flush;
+
+    for (int i = 0; i < 3; ++i)
+    {
+        HttpResponse response;
+        ASSERT_EQ (response.readHeaders (stream), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+    }
+
+    stream.close ();
+}
+
+/**
+ * @brief Test more idle connections than workers
+ */
+TEST_F (HttpEventTest, idle)
+{
+    std::vector<std::unique_ptr<Tcp::Stream>> streams;
+
+    for (size_t i = 0; i < 64 * _workers; ++i)
+    {
+        streams.emplace_back (new Tcp::Stream);
+        streams.back ()->connect ({"127.0.0.1", _port});
+        ASSERT_TRUE (streams.back ()->connected ()) << join::lastError.message ();
+    }
+
+    for (auto& stream : streams)
+    {
+        *stream << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+
+        HttpResponse response;
+        ASSERT_EQ (response.readHeaders (*stream), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+    }
+
+    // idle connections hold neither a request parser nor stream buffers.
+    ASSERT_TRUE (resourcesReleased ());
+    ASSERT_FALSE (this->_parsers.empty ());
+    ASSERT_FALSE (this->_buffers.empty ());
+
+    for (auto& stream : streams)
+    {
+        *stream << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n" << std::flush;
+
+        HttpResponse response;
+        ASSERT_EQ (response.readHeaders (*stream), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+
+        stream->close ();
+    }
+}
+
+/**
+ * @brief Test keep alive timeout
+ */
+TEST_F (HttpEventTest, keepAliveTimeout)
+{
+    Tcp::Stream stream;
+    stream.connect ({"127.0.0.1", _port});
+    ASSERT_TRUE (stream.connected ()) << join::lastError.message ();
+
+    std::this_thread::sleep_for (seconds (_timeout + 2));
+
+    stream << "HEAD / HTTP/1.1\r\nHost: localhost\r\n\r\n" << std::flush;
+
+    HttpResponse response;
+    ASSERT_EQ (response.readHeaders (stream), -1);
+
+    stream.close ();
+}
+
+/**
+ * @brief Test closing a server whose reactor was stopped.
+ */
+TEST_F (HttpEventTest, stoppedReactor)
+{
+    join::Reactor reactor;
+    std::thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    {
+        Http::Server server (_workers);
+        server.addAlias ("/", "", _sampleFile);
+        ASSERT_EQ (server.create ({IpAddress::ipv6Wildcard, uint16_t (_port + 1)}, reactor), 0)
+            << join::lastError.message ();
+
+        Tcp::Stream stream;
+        stream.connect ({"127.0.0.1", uint16_t (_port + 1)});
+        ASSERT_TRUE (stream.connected ()) << join::lastError.message ();
+
+        stream << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+        HttpResponse response;
+        ASSERT_EQ (response.readHeaders (stream), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+
+        reactor.stop ();
+        th.join ();
+
+        // the parked connection and the acceptor are removed without waiting for the reactor.
+        server.close ();
+        stream.close ();
+    }
+}
+
+/**
+ * @brief Test closing more parked connections than the reactor command queue holds once the reactor stopped.
+ */
+TEST_F (HttpEventTest, stoppedReactorParked)
+{
+    join::Reactor reactor;
+    std::thread th ([&reactor] () {
+        reactor.run ();
+    });
+
+    {
+        Http::Server server (_workers);
+        server.addAlias ("/", "", _sampleFile);
+        ASSERT_EQ (server.create ({IpAddress::ipv6Wildcard, uint16_t (_port + 2)}, reactor), 0)
+            << join::lastError.message ();
+
+        std::vector<std::unique_ptr<Tcp::Stream>> streams;
+        for (int i = 0; i < 1100; ++i)
+        {
+            streams.emplace_back (new Tcp::Stream);
+            streams.back ()->connect ({"127.0.0.1", uint16_t (_port + 2)});
+            ASSERT_TRUE (streams.back ()->connected ()) << join::lastError.message ();
+
+            *streams.back () << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+            HttpResponse response;
+            ASSERT_EQ (response.readHeaders (*streams.back ()), 0) << join::lastError.message ();
+            ASSERT_EQ (response.status (), "200");
+        }
+
+        reactor.stop ();
+        th.join ();
+
+        server.close ();
+        for (auto& stream : streams)
+        {
+            stream->close ();
+        }
+    }
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,362 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/http_parser.hpp>
+#include <join/http_server.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <sstream>
+#include <atomic>
+#include <thread>
+
+using namespace std::chrono;
+
+using join::HttpRequestParser;
+using join::ReactorThread;
+using join::IpAddress;
+using join::Http;
+using join::Tcp;
+using join::HttpRequest;
+using join::HttpMethod;
+using join::HttpErrc;
+using join::Errc;
+
+/// number of heap allocations, counted by allocation_counter.cpp.
+extern std::atomic<size_t> allocations;
+
+/**
+ * @brief Class used to test the HTTP request parser.
+ */
+class HttpParserTest : public ::testing::Test
+{
+protected:
+    /**
+     * @brief parse a request with both parsers and check they agree.
+     * @param target request target.
+     */
+    void compare (const std::string& target)
+    {
+        std::string raw = "GET " + target + " HTTP/1.1\r\nHost: localhost:5000\r\n\r\n";
+
+        std::istringstream in1 (raw);
+        HttpRequest request;
+        ASSERT_EQ (request.readHeaders (in1), 0) << target;
+
+        std::istringstream in2 (raw);
+        ASSERT_EQ (_parser.readHeaders (in2), 0) << target;
+
+        EXPECT_EQ (_parser.path ().str (), request.path ()) << target;
+        EXPECT_EQ (_parser.host ().str (), request.host ()) << target;
+
+        HttpRequest::ParameterMap params;
+        for (size_t i = 0; i < _parser.parameterCount (); ++i)
+        {
+            params[_parser.parameterAt (i).name.str ()] = _parser.parameterAt (i).value.str ();
+        }
+        EXPECT_EQ (params, request.parameters ()) << target;
+    }
+
+    /// parser.
+    HttpRequestParser _parser;
+};
+
+/**
+ * @brief Test request parsing.
+ */
+TEST_F (HttpParserTest, readHeaders)
+{
+    std::istringstream in ("POST /api/v1/users?id=42&name=john%20doe HTTP/1.0\r\n"
+                           "Host: [::1]:5000\r\n"
+                           "content-length: 128\r\n"
+                           "Authorization: Basic am9objpzZWNyZXQ=\r\n"
+                           "X-Dup: first\r\n"
+                           "X-Dup: second\r\n"
+                           "\r\n");
+    ASSERT_EQ (_parser.readHeaders (in), 0) << join::lastError.message ();
+    EXPECT_EQ (_parser.method (), HttpMethod::Post);
+    EXPECT_EQ (_parser.path (), "/api/v1/users");
+    EXPECT_EQ (_parser.path ().data ()[_parser.path ().size ()], '\0');
+    EXPECT_EQ (_parser.version (), "HTTP/1.0");
+    EXPECT_EQ (_parser.host (), "[::1]");
+    EXPECT_EQ (_parser.auth (), "Basic");
+    EXPECT_EQ (_parser.credentials (), "am9objpzZWNyZXQ=");
+    EXPECT_EQ (_parser.contentLength (), 128);
+    EXPECT_EQ (_parser.headerCount (), 5);
+    EXPECT_TRUE (_parser.hasHeader ("Content-Length"));
+    EXPECT_FALSE (_parser.hasHeader ("Content-Type"));
+    EXPECT_EQ (_parser.header ("x-dup"), "second");
+    EXPECT_TRUE (_parser.header ("Content-Type").empty ());
+    EXPECT_EQ (_parser.parameterCount (), 2);
+    EXPECT_EQ (_parser.parameter ("id"), "42");
+    EXPECT_EQ (_parser.parameter ("name"), "john doe");
+    EXPECT_FALSE (_parser.hasParameter ("Name"));
+
+    _parser.clear ();
+    EXPECT_EQ (_parser.method (), HttpMethod::Get);
+    EXPECT_EQ (_parser.path (), "/");
+    EXPECT_EQ (_parser.version (), "HTTP/1.1");
+    EXPECT_EQ (_parser.headerCount (), 0);
+    EXPECT_EQ (_parser.parameterCount (), 0);
+    EXPECT_TRUE (_parser.host ().empty ());
+    EXPECT_TRUE (_parser.auth ().empty ());
+    EXPECT_TRUE (_parser.credentials ().empty ());
+    EXPECT_EQ (_parser.contentLength (), 0);
+}
+
+/**
+ * @brief Test that the parser agrees with HttpRequest.
+ */
+TEST_F (HttpParserTest, equivalence)
+{
+    compare ("/");
+    compare ("/index.html");
+    compare ("//a///b//c");
+    compare ("/a/b/c/./../../g");
+    compare ("/mid/content=5/../6");
+    compare ("/../a/./b/..");
+    compare ("/a/b/.");
+    compare ("/a/b/..");
+    compare ("/...");
+    compare ("/%7Euser/%2E%2E/file%20name.txt");
+    compare ("/path?a=1&b=2&a=3");
+    compare ("/path?a%3D=%26&&c=&=d&noequal");
+    compare ("/path?x=%4");
+}
+
+/**
+ * @brief Test malformed requests.
+ */
+TEST_F (HttpParserTest, errors)
+{
+    std::istringstream noSpace ("GET\r\nHost: localhost\r\n\r\n");
+    ASSERT_EQ (_parser.readHeaders (noSpace), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::BadRequest);
+
+    std::istringstream noVersion ("GET /\r\nHost: localhost\r\n\r\n");
+    ASSERT_EQ (_parser.readHeaders (noVersion), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::BadRequest);
+
+    std::istringstream badMethod ("PATCH / HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    ASSERT_EQ (_parser.readHeaders (badMethod), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::Unsupported);
+
+    std::istringstream badHeader ("GET / HTTP/1.1\r\nHost:localhost\r\n\r\n");
+    ASSERT_EQ (_parser.readHeaders (badHeader), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::BadRequest);
+
+    std::istringstream longLine ("GET /" + std::string (4096, 'a') + " HTTP/1.1\r\n\r\n");
+    ASSERT_EQ (_parser.readHeaders (longLine), -1);
+    EXPECT_EQ (join::lastError, Errc::MessageTooLong);
+
+    std::string headers;
+    for (int i = 0; i < 100; ++i)
+    {
+        headers += "X-Header-" + std::to_string (i) + ": " + std::string (100, 'v') + "\r\n";
+    }
+    std::istringstream large ("GET / HTTP/1.1\r\n" + headers + "\r\n");
+    ASSERT_EQ (_parser.readHeaders (large), 0) << join::lastError.message ();
+    EXPECT_EQ (_parser.headerCount (), 100);
+
+    HttpRequestParser limited (4096, 64, 8);
+
+    std::istringstream tooLarge ("GET / HTTP/1.1\r\n" + headers + "\r\n");
+    ASSERT_EQ (limited.readHeaders (tooLarge), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::HeaderTooLarge);
+
+    headers.clear ();
+    for (int i = 0; i < 65; ++i)
+    {
+        headers += "X-" + std::to_string (i) + ": v\r\n";
+    }
+    std::istringstream tooMany ("GET / HTTP/1.1\r\n" + headers + "\r\n");
+    ASSERT_EQ (limited.readHeaders (tooMany), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::HeaderTooLarge);
+
+    std::istringstream tooManyParams ("GET /?a=1&b=2&c=3&d=4&e=5&f=6&g=7&h=8&i=9 HTTP/1.1\r\n\r\n");
+    ASSERT_EQ (limited.readHeaders (tooManyParams), -1);
+    EXPECT_EQ (join::lastError, HttpErrc::UriTooLong);
+
+    std::istringstream truncated ("GET / HTTP/1.1\r\nHost: local");
+    ASSERT_EQ (_parser.readHeaders (truncated), -1);
+    EXPECT_TRUE (truncated.fail ());
+
+    std::istringstream badLength ("GET / HTTP/1.1\r\nContent-Length: 12a\r\n\r\n");
+    ASSERT_EQ (_parser.readHeaders (badLength), 0);
+    EXPECT_EQ (_parser.contentLength (), 0);
+}
+
+/**
+ * @brief Test that parsing a request doesn't allocate.
+ */
+TEST_F (HttpParserTest, allocations)
+{
+    std::istringstream in;
+    std::string raw ("GET /static/../css/./main.css?v=3&lang=en%2Dus HTTP/1.1\r\n"
+                     "Host: www.example.com\r\n"
+                     "User-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n"
+                     "Accept: text/css,*/*;q=0.1\r\n"
+                     "Accept-Encoding: gzip, deflate\r\n"
+                     "Connection: keep-alive\r\n"
+                     "\r\n");
+
+    for (int i = 0; i < 3; ++i)
+    {
+        in.clear ();
+        in.str (raw);
+
+        size_t before = allocations.load ();
+        ASSERT_EQ (_parser.readHeaders (in), 0) << join::lastError.message ();
+        EXPECT_EQ (_parser.path (), "/css/main.css");
+        EXPECT_EQ (_parser.parameter ("lang"), "en-us");
+        EXPECT_EQ (_parser.host (), "www.example.com");
+        EXPECT_TRUE (_parser.header ("connection").equalsNoCase ("Keep-Alive"));
+        EXPECT_EQ (_parser.contentLength (), 0);
+        EXPECT_EQ (allocations.load (), before);
+    }
+}
+
+/**
+ * @brief Class used to count the allocations of requests served by the event-driven HTTP server.
+ */
+class HttpParserServerTest : public Http::Server, public ::testing::Test
+{
+public:
+    /**
+     * @brief create the test instance.
+     */
+    HttpParserServerTest ()
+    : Http::Server (_workers)
+    {
+    }
+
+protected:
+    /**
+     * @brief Sets up the test fixture.
+     */
+    void SetUp ()
+    {
+        this->keepAlive (seconds (30), 1000);
+        this->addExecute (HttpMethod::Get, "/exec/", "raw", rawHandler);
+        ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}, ReactorThread::reactor ()), 0)
+            << join::lastError.message ();
+    }
+
+    /**
+     * @brief Tears down the test fixture.
+     */
+    void TearDown ()
+    {
+        this->close ();
+    }
+
+    /**
+     * @brief answer with a prebuilt response, response building is not covered.
+     * @param worker worker context.
+     */
+    static void rawHandler (Http::Worker* worker)
+    {
+        worker->write (_response.c_str (), _response.size ());
+        worker->flush ();
+    }
+
+    /**
+     * @brief send the request and read the response.
+     * @param stream client stream.
+     */
+    static void roundTrip (Tcp::Stream& stream)
+    {
+        char response[256];
+
+        stream.write (_request.c_str (), _request.size ());
+        stream.flush ();
+        ASSERT_TRUE (stream.read (response, _response.size ())) << join::lastError.message ();
+        ASSERT_EQ (std::memcmp (response, _response.c_str (), _response.size ()), 0);
+    }
+
+    /// request.
+    static const std::string _request;
+
+    /// response.
+    static const std::string _response;
+
+    /// server port.
+    static const uint16_t _port;
+
+    /// number of workers.
+    static const size_t _workers;
+};
+
+const std::string HttpParserServerTest::_request = "GET /exec/raw?v=3&lang=en%2Dus HTTP/1.1\r\n"
+                                                   "Host: localhost\r\n"
+                                                   "User-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n"
+                                                   "Accept: */*\r\n"
+                                                   "Connection: keep-alive\r\n"
+                                                   "\r\n";
+const std::string HttpParserServerTest::_response = "HTTP/1.1 200 OK\r\n"
+                                                    "Content-Length: 2\r\n"
+                                                    "Connection: keep-alive\r\n"
+                                                    "\r\n"
+                                                    "ok";
+const uint16_t HttpParserServerTest::_port = 5040;
+const size_t HttpParserServerTest::_workers = 2;
+
+/**
+ * @brief Test that reading and routing a request served by the event-driven worker doesn't allocate.
+ */
+TEST_F (HttpParserServerTest, allocations)
+{
+    Tcp::Stream stream;
+    stream.connect ({"127.0.0.1", _port});
+    ASSERT_TRUE (stream.connected ()) << join::lastError.message ();
+
+    // the first requests fill the spare parsers and stream buffers.
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_NO_FATAL_FAILURE (roundTrip (stream));
+    }
+    std::this_thread::sleep_for (milliseconds (50));
+
+    size_t before = allocations.load ();
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_NO_FATAL_FAILURE (roundTrip (stream));
+    }
+    std::this_thread::sleep_for (milliseconds (50));
+    EXPECT_EQ (allocations.load (), before);
+
+    stream.close ();
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,267 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/http_server.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <random>
+#include <atomic>
+#include <new>
+
+// C.
+#include <fnmatch.h>
+
+using join::HttpMethod;
+using join::Http;
+
+using Router = join::BasicHttpRouter<Http>;
+using Content = join::BasicHttpContent<Http>;
+
+/// number of heap allocations.
+static std::atomic<size_t> allocations{0};
+
+/**
+ * @brief count heap allocations.
+ * @param size size to allocate.
+ * @return allocated memory.
+ */
+void* operator new (std::size_t size)
+{
+    ++allocations;
+    void* ptr = std::malloc (size ? size : 1);
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc ();
+    }
+    return ptr;
+}
+
+/**
+ * @brief release memory.
+ * @param ptr memory to release.
+ */
+void operator delete (void* ptr) noexcept
+{
+    std::free (ptr);
+}
+
+/**
+ * @brief release memory.
+ * @param ptr memory to release.
+ */
+void operator delete (void* ptr, std::size_t) noexcept
+{
+    std::free (ptr);
+}
+
+/**
+ * @brief Class used to test the HTTP router.
+ */
+class HttpRouterTest : public ::testing::Test
+{
+protected:
+    /**
+     * @brief add a content to the router.
+     * @param methods allowed methods.
+     * @param dir directory.
+     * @param name file name.
+     * @return added content.
+     */
+    Content* add (HttpMethod methods, const std::string& dir, const std::string& name)
+    {
+        Content* content = new Content;
+        content->methods = methods;
+        content->type = join::Exec;
+        content->directory = dir;
+        content->name = name;
+        _contents.emplace_back (content);
+        _router.insert (content);
+        return content;
+    }
+
+    /**
+     * @brief find content the way the server used to, walking every content.
+     * @param method method.
+     * @param path resource path.
+     * @return a pointer to the content on success, nullptr on failure.
+     */
+    Content* linearFind (HttpMethod method, const std::string& path)
+    {
+        std::string directory = join::base (path);
+        std::string name = join::filename (path);
+
+        for (auto const& content : _contents)
+        {
+            if ((content->methods & method) &&
+                (fnmatch (content->directory.c_str (), directory.c_str (), FNM_CASEFOLD) == 0) &&
+                (fnmatch (content->name.c_str (), name.c_str (), FNM_CASEFOLD) == 0))
+            {
+                return content.get ();
+            }
+        }
+
+        return nullptr;
+    }
+
+    /// contents.
+    std::vector<std::unique_ptr<Content>> _contents;
+
+    /// router.
+    Router _router;
+};
+
+/**
+ * @brief Test exact routes.
+ */
+TEST_F (HttpRouterTest, exact)
+{
+    Content* root = add (HttpMethod::Get, "/", "");
+    Content* post = add (HttpMethod::Post, "/exec/", "post");
+
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/"), root);
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/exec/post"), post);
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/EXEC/Post"), post);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/exec/post"), nullptr);
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/exec/other"), nullptr);
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/exec/sub/post"), nullptr);
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/exe/post"), nullptr);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "noslash"), nullptr);
+}
+
+/**
+ * @brief Test glob routes.
+ */
+TEST_F (HttpRouterTest, glob)
+{
+    Content* version = add (HttpMethod::Get, "/api/v[0-9]/", "*");
+    Content* api = add (HttpMethod::Get, "/api/*", "*.json");
+    Content* any = add (HttpMethod::Get, "*", "*.html");
+
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/api/v1/users"), version);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/API/V2/"), version);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/api/vx/users.json"), api);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/api/v1/x/users.json"), api);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/api/v1/x/users.html"), any);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/index.html"), any);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/index.htm"), nullptr);
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/api/v1/users"), nullptr);
+}
+
+/**
+ * @brief Test that the first registered route wins.
+ */
+TEST_F (HttpRouterTest, firstMatch)
+{
+    Content* post = add (HttpMethod::Post, "*", "*");
+    Content* any = add (HttpMethod::Head | HttpMethod::Get, "*", "*");
+    Content* exact = add (HttpMethod::Get, "/exec/", "get");
+
+    EXPECT_EQ (_router.find (HttpMethod::Post, "/exec/get"), post);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/exec/get"), any);
+    EXPECT_EQ (_router.find (HttpMethod::Head, "/exec/get"), any);
+    EXPECT_NE (_router.find (HttpMethod::Get, "/exec/get"), exact);
+    EXPECT_EQ (_router.find (HttpMethod::Delete, "/exec/get"), nullptr);
+}
+
+/**
+ * @brief Test clear.
+ */
+TEST_F (HttpRouterTest, clear)
+{
+    add (HttpMethod::Get, "/", "*");
+    EXPECT_NE (_router.find (HttpMethod::Get, "/index.html"), nullptr);
+
+    _router.clear ();
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/index.html"), nullptr);
+
+    Content* content = add (HttpMethod::Get, "/", "*");
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/index.html"), content);
+}
+
+/**
+ * @brief Test that the router returns the same content as a linear scan.
+ */
+TEST_F (HttpRouterTest, linear)
+{
+    const std::vector<std::string> dirs = {"/", "/a/", "/A/b/", "/a/b/", "/a*", "/a/?/", "*", "/b/[ab]/", "/a/b/c/", ""};
+    const std::vector<std::string> names = {"", "*", "x", "X.html", "*.html", "?", "y*"};
+    const std::vector<std::string> segments = {"a/", "b/", "c/", "A/", "ab/"};
+    const std::vector<std::string> files = {"", "x", "x.html", "y", "yz", "z.html"};
+    const std::vector<HttpMethod> methods = {HttpMethod::Head, HttpMethod::Get, HttpMethod::Post};
+
+    std::mt19937 gen (42);
+
+    for (int i = 0; i < 64; ++i)
+    {
+        add (methods[gen () % methods.size ()] | methods[gen () % methods.size ()], dirs[gen () % dirs.size ()],
+             names[gen () % names.size ()]);
+    }
+
+    for (int i = 0; i < 4096; ++i)
+    {
+        std::string path = "/";
+        for (size_t n = gen () % 4; n > 0; --n)
+        {
+            path += segments[gen () % segments.size ()];
+        }
+        path += files[gen () % files.size ()];
+
+        HttpMethod method = methods[gen () % methods.size ()];
+        EXPECT_EQ (_router.find (method, path), linearFind (method, path)) << path;
+    }
+}
+
+/**
+ * @brief Test that a lookup doesn't allocate.
+ */
+TEST_F (HttpRouterTest, allocations)
+{
+    for (int i = 0; i < 100; ++i)
+    {
+        add (HttpMethod::Get, "/api/v" + std::to_string (i) + "/", "resource" + std::to_string (i));
+    }
+    Content* glob = add (HttpMethod::Get, "/static/*", "*.css");
+
+    const std::string exact = "/api/v99/resource99";
+    const std::string wildcard = "/static/css/main.css";
+
+    size_t before = allocations.load ();
+    EXPECT_NE (_router.find (HttpMethod::Get, exact), nullptr);
+    EXPECT_EQ (_router.find (HttpMethod::Get, wildcard), glob);
+    EXPECT_EQ (_router.find (HttpMethod::Get, "/unknown/path"), nullptr);
+    EXPECT_EQ (allocations.load (), before);
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -0,0 +1,221 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2026 Mathieu Rabine
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// libjoin.
+#include <join/http_client.hpp>
+#include <join/http_server.hpp>
+
+// Libraries.
+#include <gtest/gtest.h>
+
+// C++.
+#include <fstream>
+
+using namespace std::chrono;
+
+using join::Errc;
+using join::IpAddress;
+using join::HttpResponse;
+using join::Http;
+using join::Tcp;
+
+/**
+ * @brief Class used to test the sharded HTTP server.
+ */
+class HttpShardedTest : public Http::Server, public ::testing::Test
+{
+public:
+    /**
+     * @brief create the test instance.
+     */
+    HttpShardedTest ()
+    : Http::Server (_workers)
+    {
+    }
+
+    /**
+     * @brief Set up test case.
+     */
+    static void SetUpTestCase ()
+    {
+        mkdir (_basePath.c_str (), 0777);
+        std::ofstream outFile (_sampleFile.c_str ());
+        if (outFile.is_open ())
+        {
+            outFile << _sample;
+            outFile.close ();
+        }
+    }
+
+    /**
+     * @brief Tear down test case.
+     */
+    static void TearDownTestCase ()
+    {
+        unlink (_sampleFile.c_str ());
+        rmdir (_basePath.c_str ());
+    }
+
+protected:
+    /**
+     * @brief Sets up the test fixture.
+     */
+    void SetUp ()
+    {
+        this->baseLocation (_basePath);
+        this->keepAlive (seconds (_timeout), _max);
+        this->addAlias ("/", "", _sampleFile);
+        ASSERT_EQ (this->createSharded ({IpAddress::ipv6Wildcard, _port}), 0) << join::lastError.message ();
+        ASSERT_EQ (this->createSharded ({IpAddress::ipv6Wildcard, _port}), -1);
+        ASSERT_EQ (join::lastError, Errc::InUse);
+        ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}), -1);
+    }
+
+    /**
+     * @brief Tears down the test fixture.
+     */
+    void TearDown ()
+    {
+        this->close ();
+    }
+
+    /// base path.
+    static const std::string _basePath;
+
+    /// sample.
+    static const std::string _sample;
+
+    /// sample path.
+    static const std::string _sampleFile;
+
+    /// server port.
+    static const uint16_t _port;
+
+    /// server keep alive timeout.
+    static const int _timeout;
+
+    /// server keep alive max requests.
+    static const int _max;
+
+    /// number of workers.
+    static const size_t _workers;
+};
+
+const std::string HttpShardedTest::_basePath = "/tmp/www_sharded";
+const std::string HttpShardedTest::_sample = "<html><body><h1>It works!</h1></body></html>";
+const std::string HttpShardedTest::_sampleFile = _basePath + "/sample.html";
+const uint16_t HttpShardedTest::_port = 5020;
+const int HttpShardedTest::_timeout = 5;
+const int HttpShardedTest::_max = 20;
+const size_t HttpShardedTest::_workers = 4;
+
+/**
+ * @brief Test get
+ */
+TEST_F (HttpShardedTest, get)
+{
+    for (size_t i = 0; i < 4 * _workers; ++i)
+    {
+        Tcp::Stream stream;
+        stream.connect ({"127.0.0.1", _port});
+        ASSERT_TRUE (stream.connected ()) << join::lastError.message ();
+
+        stream << "GET / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+
+        HttpResponse response;
+        ASSERT_EQ (response.readHeaders (stream), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+        ASSERT_EQ (response.contentLength (), _sample.size ());
+
+        std::string payload;
+        payload.resize (_sample.size ());
+        stream.read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, _sample);
+
+        stream << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n" << std::flush;
+
+        response.clear ();
+        ASSERT_EQ (response.readHeaders (stream), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+
+        stream.close ();
+    }
+}
+
+/**
+ * @brief Test that a keep alive connection gives way to the connections queued on its shard
+ */
+TEST_F (HttpShardedTest, backlog)
+{
+    Http::Server server (1);
+    server.baseLocation (_basePath);
+    server.keepAlive (seconds (_timeout), _max);
+    server.addAlias ("/", "", _sampleFile);
+    ASSERT_EQ (server.createSharded ({IpAddress::ipv6Wildcard, uint16_t (_port + 1)}), 0)
+        << join::lastError.message ();
+
+    Tcp::Stream first;
+    first.connect ({"127.0.0.1", uint16_t (_port + 1)});
+    ASSERT_TRUE (first.connected ()) << join::lastError.message ();
+
+    first << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+
+    HttpResponse response;
+    ASSERT_EQ (response.readHeaders (first), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+    ASSERT_EQ (response.header ("Connection"), "Keep-Alive");
+
+    // queued on the only shard, busy with the first connection.
+    Tcp::Stream second;
+    second.connect ({"127.0.0.1", uint16_t (_port + 1)});
+    ASSERT_TRUE (second.connected ()) << join::lastError.message ();
+
+    first << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+
+    response.clear ();
+    ASSERT_EQ (response.readHeaders (first), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+    ASSERT_EQ (response.header ("Connection"), "close");
+    first.close ();
+
+    auto beg = steady_clock::now ();
+    second << "HEAD / HTTP/1.1\r\nHost: localhost\r\nConnection: keep-alive\r\n\r\n" << std::flush;
+
+    response.clear ();
+    ASSERT_EQ (response.readHeaders (second), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+    ASSERT_LT (steady_clock::now () - beg, seconds (_timeout));
+
+    second.close ();
+    server.close ();
+}
+
+/**
+ * @brief main function.
+ */
+int main (int argc, char** argv)
+{
+    testing::InitGoogleTest (&argc, argv);
+    return RUN_ALL_TESTS ();
+}
@@ -92,6 +92,7 @@ protected:
         this->addExecute (HttpMethod::Get, "/exec/", "null", nullptr);
         this->addExecute (HttpMethod::Get, "/exec/", "get", getHandler);
         this->addExecute (HttpMethod::Post, "/exec/", "post", postHandler);
+        this->addExecute (HttpMethod::Get, "/exec/", "large", largeHandler);
         ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}), 0) << join::lastError.message ();
         ASSERT_EQ (this->create ({IpAddress::ipv6Wildcard, _port}), -1);
         ASSERT_EQ (join::lastError, Errc::InUse);
@@ -171,6 +172,24 @@ protected:
         worker->flush ();
     }
 
+    /**
+     * @brief handle a large request head.
+     * @param worker worker thread context.
+     */
+    static void largeHandler (Http::Worker* worker)
+    {
+        if ((worker->request ().parameterCount () == 40) && (worker->request ().headerCount () >= 80) &&
+            (worker->header ("X-Header-79") == std::string (16, 'h')))
+        {
+            worker->sendHeaders ();
+        }
+        else
+        {
+            worker->sendError ("400", "Bad Request");
+        }
+        worker->flush ();
+    }
+
     /// base path.
     static const std::string _basePath;
 
@@ -447,6 +466,33 @@ TEST_F (HttpTest, headerTooLarge)
     ASSERT_EQ (response.reason (), "Request Header Too Large");
 }
 
+/**
+ * @brief Test large request head
+ */
+TEST_F (HttpTest, largeHead)
+{
+    Http::Client client (_host, _port);
+
+    HttpRequest request;
+    request.method (HttpMethod::Get);
+    request.path ("/exec/large");
+    for (int i = 0; i < 40; ++i)
+    {
+        request.parameter ("p" + std::to_string (i), std::string (44, 'v'));
+    }
+    for (int i = 0; i < 80; ++i)
+    {
+        request.header ("X-Header-" + std::to_string (i), std::string (16, 'h'));
+    }
+    ASSERT_GT (request.urn ().size (), 1900);
+    ASSERT_EQ (client.send (request), 0) << join::lastError.message ();
+
+    HttpResponse response;
+    ASSERT_EQ (client.receive (response), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+    ASSERT_EQ (response.reason (), "OK");
+}
+
 /**
  * @brief Test not found
  */
@@ -691,6 +737,83 @@ TEST_F (HttpTest, get)
     ASSERT_TRUE (client.good ()) << join::lastError.message ();
 }
 
+/**
+ * @brief Test pipelined requests
+ */
+TEST_F (HttpTest, pipeline)
+{
+    Http::Client client (_host, _port);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        HttpRequest request;
+        request.method (HttpMethod::Get);
+        ASSERT_EQ (client.queue (request), 0) << join::lastError.message ();
+        ASSERT_EQ (client.pending (), i + 1);
+    }
+
+    for (int i = 0; i < 5; ++i)
+    {
+        HttpResponse response;
+        ASSERT_EQ (client.receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+        ASSERT_EQ (response.reason (), "OK");
+        ASSERT_EQ (client.pending (), 4 - i);
+
+        ASSERT_EQ (response.contentLength (), _sample.size ());
+        std::string payload;
+        payload.resize (_sample.size ());
+        client.read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, _sample);
+    }
+
+    client.close ();
+    ASSERT_TRUE (client.good ()) << join::lastError.message ();
+}
+
+/**
+ * @brief Test get of a file large enough to be sent with sendfile
+ */
+TEST_F (HttpTest, getLarge)
+{
+    std::string large;
+    for (size_t i = 0; large.size () < 1024 * 1024; ++i)
+    {
+        large += std::to_string (i) + "\n";
+    }
+
+    std::ofstream outFile ((_basePath + "/large.txt").c_str ());
+    ASSERT_TRUE (outFile.is_open ());
+    outFile << large;
+    outFile.close ();
+
+    Http::Client client (_host, _port);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        HttpRequest request;
+        request.method (HttpMethod::Get);
+        request.path ("/large.txt");
+        ASSERT_EQ (client.send (request), 0) << join::lastError.message ();
+
+        HttpResponse response;
+        ASSERT_EQ (client.receive (response), 0) << join::lastError.message ();
+        ASSERT_EQ (response.status (), "200");
+        ASSERT_EQ (response.reason (), "OK");
+
+        ASSERT_EQ (response.contentLength (), large.size ());
+        std::string payload;
+        payload.resize (large.size ());
+        client.read (&payload[0], payload.size ());
+        ASSERT_EQ (payload, large);
+    }
+
+    client.close ();
+    ASSERT_TRUE (client.good ()) << join::lastError.message ();
+
+    unlink ((_basePath + "/large.txt").c_str ());
+}
+
 /**
  * @brief Test post
  */
@@ -23,6 +23,7 @@
  */
 
 // libjoin.
+#include <join/http_client_pool.hpp>
 #include <join/http_client.hpp>
 #include <join/http_server.hpp>
 
@@ -31,6 +32,7 @@
 
 // C++.
 #include <fstream>
+#include <thread>
 
 using namespace std::chrono;
 
@@ -891,6 +893,44 @@ TEST_F (HttpsTest, post)
     ASSERT_TRUE (client.good ()) << join::lastError.message ();
 }
 
+/**
+ * @brief Test that a warmed connection is reused
+ */
+TEST_F (HttpsTest, poolWarm)
+{
+    int connections = 0;
+    Https::ClientPool pool (
+        [&connections] (const std::string& host, uint16_t port) {
+            ++connections;
+            return Https::ClientPool::ClientPtr (new Https::Client (clientContext (), host, port));
+        },
+        1);
+
+    ASSERT_EQ (pool.warm (_host, _port), 0) << join::lastError.message ();
+    ASSERT_EQ (pool.idle (_host, _port), 1);
+    ASSERT_EQ (connections, 1);
+
+    // let the post-handshake messages (TLS 1.3 session tickets) reach the idle connection.
+    std::this_thread::sleep_for (milliseconds (100));
+
+    auto lease = pool.acquire (_host, _port);
+    ASSERT_TRUE (lease) << join::lastError.message ();
+    ASSERT_EQ (connections, 1);
+
+    HttpRequest request;
+    request.method (HttpMethod::Get);
+    ASSERT_EQ (lease->send (request), 0) << join::lastError.message ();
+
+    HttpResponse response;
+    ASSERT_EQ (lease->receive (response), 0) << join::lastError.message ();
+    ASSERT_EQ (response.status (), "200");
+
+    std::string payload;
+    payload.resize (response.contentLength ());
+    lease->read (&payload[0], payload.size ());
+    ASSERT_EQ (payload, _sample);
+}
+
 /**
  * @brief main function.
  */